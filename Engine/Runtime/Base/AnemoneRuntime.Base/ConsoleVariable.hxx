@@ -3,6 +3,12 @@
 #include "AnemoneRuntime.Base/FunctionRef.hxx"
 #include "AnemoneRuntime.Base/Intrusive.hxx"
 
+#include <fmt/format.h>
+
+#include <charconv>
+#include <string>
+#include <type_traits>
+
 namespace Anemone
 {
     class IConsoleVariable;
@@ -61,6 +67,19 @@ namespace Anemone
         {
             return this->m_name;
         }
+
+        //! Formats current value of variable for display. Variables which cannot be formatted return empty string.
+        [[nodiscard]] virtual std::string ToString() const
+        {
+            return {};
+        }
+
+        //! Sets value of variable from text. Returns false when text is not valid value or variable is read-only.
+        virtual bool FromString(std::string_view value)
+        {
+            (void)value;
+            return false;
+        }
     };
 
     template <typename T>
@@ -90,5 +109,59 @@ namespace Anemone
         {
             this->m_value = value;
         }
+
+        [[nodiscard]] std::string ToString() const override
+        {
+            if constexpr (fmt::is_formattable<T>::value)
+            {
+                return fmt::format("{}", this->m_value);
+            }
+            else
+            {
+                return {};
+            }
+        }
+
+        bool FromString(std::string_view value) override
+        {
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                if ((value == "true") or (value == "1"))
+                {
+                    this->m_value = true;
+                    return true;
+                }
+
+                if ((value == "false") or (value == "0"))
+                {
+                    this->m_value = false;
+                    return true;
+                }
+
+                return false;
+            }
+            else if constexpr (std::is_arithmetic_v<T>)
+            {
+                T parsed{};
+                auto const [end, error] = std::from_chars(value.data(), value.data() + value.size(), parsed);
+
+                if ((error != std::errc{}) or (end != (value.data() + value.size())))
+                {
+                    return false;
+                }
+
+                this->m_value = parsed;
+                return true;
+            }
+            else if constexpr (std::is_constructible_v<T, std::string_view>)
+            {
+                this->m_value = T{value};
+                return true;
+            }
+            else
+            {
+                return false;
+            }
+        }
     };
 }
@@ -0,0 +1,39 @@
+#include "AnemoneRuntime.Base/Memory/Allocator.hxx"
+#include "AnemoneRuntime.Base/Memory/SystemAllocator.hxx"
+#include "AnemoneRuntime.Base/Memory/ThreadCachingAllocator.hxx"
+
+#include <atomic>
+
+namespace Anemone::Memory
+{
+    namespace
+    {
+        std::atomic<Allocator*> gDefaultAllocator{};
+    }
+
+    Allocator& GetDefaultAllocator()
+    {
+        if (Allocator* const allocator = gDefaultAllocator.load(std::memory_order::acquire))
+            [[likely]]
+        {
+            return *allocator;
+        }
+
+        // Never destroyed; memory allocated from it may be released during static destruction.
+        static ThreadCachingAllocator* const fallback = new ThreadCachingAllocator{*new SystemAllocator{}};
+
+        Allocator* expected = nullptr;
+
+        if (gDefaultAllocator.compare_exchange_strong(expected, fallback, std::memory_order::acq_rel, std::memory_order::acquire))
+        {
+            return *fallback;
+        }
+
+        return *expected;
+    }
+
+    void SetDefaultAllocator(Allocator& allocator)
+    {
+        gDefaultAllocator.store(&allocator, std::memory_order::release);
+    }
+}
@@ -31,3 +31,16 @@ namespace Anemone::Memory
         virtual Allocation Reallocate(Allocation const& allocation, Layout const& layout) = 0;
     };
 }
+
+namespace Anemone::Memory
+{
+    //! Gets allocator used by engine by default. Unless other allocator was installed, this is thread-caching
+    //! allocator backed by system allocator.
+    ANEMONE_RUNTIME_BASE_API Allocator& GetDefaultAllocator();
+
+    //! Installs allocator used by engine by default.
+    //!
+    //! Memory must be returned to allocator which allocated it, so this should be done at startup, before
+    //! any allocation was made through default allocator. Allocator must outlive all of its users.
+    ANEMONE_RUNTIME_BASE_API void SetDefaultAllocator(Allocator& allocator);
+}
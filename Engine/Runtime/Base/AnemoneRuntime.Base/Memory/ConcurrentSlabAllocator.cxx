@@ -0,0 +1,271 @@
+#include "AnemoneRuntime.Base/Memory/ConcurrentSlabAllocator.hxx"
+#include "AnemoneRuntime.Base/Bitwise.hxx"
+#include "AnemoneRuntime.System/ProcessorProperties.hxx"
+#include "AnemoneRuntime.Threading/Lock.hxx"
+#include "AnemoneRuntime.Diagnostics/Trace.hxx"
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+namespace Anemone::Memory
+{
+    namespace
+    {
+        std::atomic_size_t gNextCacheSlot{};
+
+        thread_local size_t const tlsCacheSlot = gNextCacheSlot.fetch_add(1, std::memory_order::relaxed);
+
+        // Magazine refilled from slabs is filled only half way, so following frees don't spill it immediately.
+        constexpr size_t RefillCount = ConcurrentSlabAllocator::MagazineCapacity / 2;
+    }
+
+    ConcurrentSlabAllocator::ConcurrentSlabAllocator(Allocator* allocator, size_t allocationSize, size_t allocationAlignment, size_t emptySlabReserve)
+        : m_Slabs{allocator, allocationSize, allocationAlignment, emptySlabReserve}
+    {
+        size_t const count = BitCeil(std::max<size_t>(1, ProcessorProperties::GetLogicalCoresCount()));
+
+        this->m_Slots = std::make_unique<CacheSlot[]>(count);
+        this->m_SlotMask = count - 1;
+        this->m_MaxFullMagazines = count * 2;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            this->m_Slots[i].Loaded = new Magazine{};
+            this->m_Slots[i].Previous = new Magazine{};
+        }
+    }
+
+    ConcurrentSlabAllocator::~ConcurrentSlabAllocator()
+    {
+        this->Flush();
+
+        for (size_t i = 0; i <= this->m_SlotMask; ++i)
+        {
+            delete this->m_Slots[i].Loaded;
+            delete this->m_Slots[i].Previous;
+        }
+
+        for (Magazine* magazine : this->m_EmptyMagazines)
+        {
+            delete magazine;
+        }
+    }
+
+    void* ConcurrentSlabAllocator::Allocate()
+    {
+        CacheSlot& slot = this->GetCacheSlot();
+        UniqueLock scope{slot.Lock};
+
+        if (slot.Loaded->Count == 0)
+            [[unlikely]]
+        {
+            if (slot.Previous->Count != 0)
+            {
+                std::swap(slot.Loaded, slot.Previous);
+            }
+            else
+            {
+                slot.Loaded = this->Refill(slot.Loaded);
+
+                if (slot.Loaded->Count == 0)
+                {
+                    // Backing allocator is out of memory.
+                    return nullptr;
+                }
+            }
+        }
+
+        Magazine& magazine = *slot.Loaded;
+        return magazine.Elements[--magazine.Count];
+    }
+
+    void ConcurrentSlabAllocator::Deallocate(void* pointer)
+    {
+        AE_ASSERT(pointer != nullptr);
+        AE_ASSERT(SlabAllocator::GetOwner(pointer) == &this->m_Slabs);
+
+        CacheSlot& slot = this->GetCacheSlot();
+        UniqueLock scope{slot.Lock};
+
+        if (slot.Loaded->Count == MagazineCapacity)
+            [[unlikely]]
+        {
+            if (slot.Previous->Count != MagazineCapacity)
+            {
+                std::swap(slot.Loaded, slot.Previous);
+            }
+            else
+            {
+                // Both magazines are full; hand previous one over and continue with empty one.
+                Magazine* const empty = this->Spill(slot.Previous);
+                slot.Previous = slot.Loaded;
+                slot.Loaded = empty;
+            }
+        }
+
+        Magazine& magazine = *slot.Loaded;
+        magazine.Elements[magazine.Count++] = pointer;
+    }
+
+    void ConcurrentSlabAllocator::SetEmptySlabReserve(size_t count)
+    {
+        UniqueLock scope{this->m_SlabLock};
+        this->m_Slabs.SetEmptySlabReserve(count);
+    }
+
+    void ConcurrentSlabAllocator::Flush()
+    {
+        for (size_t i = 0; i <= this->m_SlotMask; ++i)
+        {
+            CacheSlot& slot = this->m_Slots[i];
+            UniqueLock scope{slot.Lock};
+
+            this->ReturnToSlabs(*slot.Loaded);
+            this->ReturnToSlabs(*slot.Previous);
+        }
+
+        std::vector<Magazine*> full{};
+
+        {
+            UniqueLock scope{this->m_DepotLock};
+            full.swap(this->m_FullMagazines);
+        }
+
+        for (Magazine* magazine : full)
+        {
+            this->ReturnToSlabs(*magazine);
+        }
+
+        UniqueLock scope{this->m_DepotLock};
+        this->m_EmptyMagazines.insert(this->m_EmptyMagazines.end(), full.begin(), full.end());
+    }
+
+    ConcurrentSlabAllocatorStatistics ConcurrentSlabAllocator::GetStatistics()
+    {
+        ConcurrentSlabAllocatorStatistics result{};
+
+        for (size_t i = 0; i <= this->m_SlotMask; ++i)
+        {
+            CacheSlot& slot = this->m_Slots[i];
+            UniqueLock scope{slot.Lock};
+
+            result.Cached += slot.Loaded->Count + slot.Previous->Count;
+        }
+
+        {
+            UniqueLock scope{this->m_DepotLock};
+
+            result.FullMagazines = this->m_FullMagazines.size();
+            result.EmptyMagazines = this->m_EmptyMagazines.size();
+            result.Cached += result.FullMagazines * MagazineCapacity;
+        }
+
+        {
+            UniqueLock scope{this->m_SlabLock};
+            result.Slabs = this->m_Slabs.GetStatistics();
+        }
+
+        return result;
+    }
+
+    void ConcurrentSlabAllocator::ReportStatistics(std::string_view name)
+    {
+        ConcurrentSlabAllocatorStatistics const statistics = this->GetStatistics();
+
+        Trace::Get().TraceInformation(
+            "slab allocator '{}': size = {}, live = {}, cached = {}, slabs = {} partial + {} full + {} empty, occupancy = {:.1f}%, fragmented slabs = {}, created = {}, released = {}",
+            name,
+            statistics.Slabs.AllocationSize,
+            statistics.GetLive(),
+            statistics.Cached,
+            statistics.Slabs.PartialSlabs,
+            statistics.Slabs.FullSlabs,
+            statistics.Slabs.EmptySlabs,
+            statistics.GetOccupancy() * 100.0,
+            statistics.Slabs.GetFragmentedSlabs(),
+            statistics.Slabs.SlabsCreated,
+            statistics.Slabs.SlabsReleased);
+    }
+
+    ConcurrentSlabAllocator::CacheSlot& ConcurrentSlabAllocator::GetCacheSlot() const
+    {
+        return this->m_Slots[tlsCacheSlot & this->m_SlotMask];
+    }
+
+    ConcurrentSlabAllocator::Magazine* ConcurrentSlabAllocator::Refill(Magazine* empty)
+    {
+        AE_ASSERT(empty->Count == 0);
+
+        {
+            UniqueLock scope{this->m_DepotLock};
+
+            if (not this->m_FullMagazines.empty())
+            {
+                Magazine* const full = this->m_FullMagazines.back();
+                this->m_FullMagazines.pop_back();
+                this->m_EmptyMagazines.push_back(empty);
+                return full;
+            }
+        }
+
+        UniqueLock scope{this->m_SlabLock};
+
+        while (empty->Count < RefillCount)
+        {
+            void* const element = this->m_Slabs.Allocate();
+
+            if (element == nullptr)
+            {
+                break;
+            }
+
+            empty->Elements[empty->Count++] = element;
+        }
+
+        return empty;
+    }
+
+    ConcurrentSlabAllocator::Magazine* ConcurrentSlabAllocator::Spill(Magazine* full)
+    {
+        AE_ASSERT(full->Count == MagazineCapacity);
+
+        {
+            UniqueLock scope{this->m_DepotLock};
+
+            if (this->m_FullMagazines.size() < this->m_MaxFullMagazines)
+            {
+                this->m_FullMagazines.push_back(full);
+
+                if (not this->m_EmptyMagazines.empty())
+                {
+                    Magazine* const empty = this->m_EmptyMagazines.back();
+                    this->m_EmptyMagazines.pop_back();
+                    return empty;
+                }
+
+                return new Magazine{};
+            }
+        }
+
+        // Depot is full; elements go back to slabs and magazine is reused.
+        this->ReturnToSlabs(*full);
+        return full;
+    }
+
+    void ConcurrentSlabAllocator::ReturnToSlabs(Magazine& magazine)
+    {
+        if (magazine.Count != 0)
+        {
+            UniqueLock scope{this->m_SlabLock};
+
+            for (size_t i = 0; i < magazine.Count; ++i)
+            {
+                this->m_Slabs.Deallocate(magazine.Elements[i]);
+            }
+
+            magazine.Count = 0;
+        }
+    }
+}
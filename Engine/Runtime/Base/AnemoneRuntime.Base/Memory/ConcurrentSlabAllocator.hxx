@@ -0,0 +1,122 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+#include "AnemoneRuntime.Base/Memory/SlabAllocator.hxx"
+#include "AnemoneRuntime.Threading/Spinlock.hxx"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace Anemone::Memory
+{
+    struct ConcurrentSlabAllocatorStatistics final
+    {
+        //! Statistics of underlying slabs. Elements cached in magazines are counted as allocated there.
+        SlabAllocatorStatistics Slabs;
+
+        //! Number of elements held by magazines, ready for allocation without touching slabs.
+        size_t Cached;
+
+        //! Number of full magazines in depot.
+        size_t FullMagazines;
+
+        //! Number of empty magazines in depot.
+        size_t EmptyMagazines;
+
+        //! Number of elements allocated by users of allocator.
+        size_t GetLive() const
+        {
+            return this->Slabs.Allocated - this->Cached;
+        }
+
+        //! Gets ratio of live elements to capacity of slabs in use.
+        double GetOccupancy() const
+        {
+            size_t const capacity = (this->Slabs.PartialSlabs + this->Slabs.FullSlabs) * this->Slabs.SlabCapacity;
+            return (capacity != 0) ? static_cast<double>(this->GetLive()) / static_cast<double>(capacity) : 1.0;
+        }
+    };
+
+    //! Thread-safe slab allocator with magazine caching.
+    //!
+    //! Elements are cached in magazines - fixed-size stacks of free elements. Each cache slot holds loaded and
+    //! previous magazine; threads are assigned to slots round-robin, so with enough slots each thread uses its
+    //! own. Allocation and deallocation only touch slot magazines and lock slabs once per magazine worth of
+    //! elements, when magazines are exchanged with depot or refilled from slabs.
+    //!
+    //! Elements may be freed by any thread. Owner of element is found from slab header.
+    class ANEMONE_RUNTIME_BASE_API ConcurrentSlabAllocator final
+    {
+    public:
+        //! Number of elements held by single magazine.
+        static constexpr size_t MagazineCapacity = 32;
+
+    private:
+        struct Magazine final
+        {
+            size_t Count{};
+            void* Elements[MagazineCapacity];
+        };
+
+        struct alignas(64) CacheSlot final
+        {
+            Spinlock Lock{};
+            Magazine* Loaded{};
+            Magazine* Previous{};
+        };
+
+        std::unique_ptr<CacheSlot[]> m_Slots{};
+        size_t m_SlotMask{};
+
+        // Guards depot.
+        Spinlock m_DepotLock{};
+        std::vector<Magazine*> m_FullMagazines{};
+        std::vector<Magazine*> m_EmptyMagazines{};
+        size_t m_MaxFullMagazines{};
+
+        // Guards slabs.
+        Spinlock m_SlabLock{};
+        SlabAllocator m_Slabs;
+
+    public:
+        //! \param emptySlabReserve Number of empty slabs kept for reuse instead of returning them to allocator.
+        ConcurrentSlabAllocator(Allocator* allocator, size_t allocationSize, size_t allocationAlignment, size_t emptySlabReserve = 1);
+        ConcurrentSlabAllocator(ConcurrentSlabAllocator const&) = delete;
+        ConcurrentSlabAllocator(ConcurrentSlabAllocator&&) = delete;
+        ConcurrentSlabAllocator& operator=(ConcurrentSlabAllocator const&) = delete;
+        ConcurrentSlabAllocator& operator=(ConcurrentSlabAllocator&&) = delete;
+        ~ConcurrentSlabAllocator();
+
+    public:
+        void* Allocate();
+
+        void Deallocate(void* pointer);
+
+        size_t GetAllocationSize() const
+        {
+            return this->m_Slabs.GetAllocationSize();
+        }
+
+        //! Sets number of empty slabs kept in reserve, releasing excess ones.
+        void SetEmptySlabReserve(size_t count);
+
+        //! Returns all cached elements to slabs, so empty slabs can be released.
+        void Flush();
+
+        ConcurrentSlabAllocatorStatistics GetStatistics();
+
+        //! Writes statistics to trace.
+        void ReportStatistics(std::string_view name);
+
+    private:
+        CacheSlot& GetCacheSlot() const;
+
+        //! Exchanges empty magazine for full one from depot, or refills it from slabs.
+        Magazine* Refill(Magazine* empty);
+
+        //! Exchanges full magazine for empty one from depot, or returns its elements to slabs when depot is full.
+        Magazine* Spill(Magazine* full);
+
+        void ReturnToSlabs(Magazine& magazine);
+    };
+}
@@ -0,0 +1,217 @@
+#include "AnemoneRuntime.Base/Memory/MemoryTracking.hxx"
+#include "AnemoneRuntime.Base/ConsoleFunction.hxx"
+#include "AnemoneRuntime.Base/Instant.hxx"
+#include "AnemoneRuntime.Threading/Spinlock.hxx"
+#include "AnemoneRuntime.Threading/Lock.hxx"
+#include "AnemoneRuntime.Diagnostics/Trace.hxx"
+
+#include <atomic>
+#include <iterator>
+#include <string>
+#include <utility>
+
+namespace Anemone::Memory
+{
+    namespace
+    {
+        constexpr std::array<std::string_view, MemoryTagCount> MemoryTagNames{
+            "Untagged",
+            "Core",
+            "Tasks",
+            "Assets",
+            "Renderer",
+            "Audio",
+            "Physics",
+            "Network",
+            "Scripting",
+            "UserInterface",
+            "Tools",
+        };
+
+        struct alignas(64) TrackingShard final
+        {
+            //! Live bytes not yet published to global counter.
+            std::array<std::atomic_int64_t, MemoryTagCount> Pending{};
+            std::array<std::atomic_uint64_t, MemoryTagCount> Allocations{};
+            std::array<std::atomic_uint64_t, MemoryTagCount> AllocatedBytes{};
+        };
+
+        struct TrackingState final
+        {
+            std::array<TrackingShard, MemoryTracking::ShardCount> Shards{};
+            std::array<std::atomic_int64_t, MemoryTagCount> Live{};
+            std::array<std::atomic_int64_t, MemoryTagCount> Peak{};
+
+            // Previous snapshot, used to compute rates.
+            Spinlock SnapshotLock{};
+            Instant SnapshotTime{Instant::Now()};
+            std::array<uint64_t, MemoryTagCount> SnapshotAllocations{};
+            std::array<uint64_t, MemoryTagCount> SnapshotAllocatedBytes{};
+        };
+
+        TrackingState& GetTrackingState()
+        {
+            // Allocations may be tracked during static destruction; never destroy state.
+            alignas(TrackingState) static std::byte storage[sizeof(TrackingState)];
+            static TrackingState* const state = new (storage) TrackingState{};
+            return *state;
+        }
+
+        std::atomic_size_t gNextTrackingShard{};
+
+        thread_local size_t const tlsTrackingShard = gNextTrackingShard.fetch_add(1, std::memory_order::relaxed) % MemoryTracking::ShardCount;
+
+        thread_local MemoryTag tlsCurrentMemoryTag{MemoryTag::Untagged};
+
+        void UpdatePeak(std::atomic_int64_t& peak, int64_t value)
+        {
+            int64_t current = peak.load(std::memory_order::relaxed);
+
+            while ((value > current) and not peak.compare_exchange_weak(current, value, std::memory_order::relaxed))
+            {
+            }
+        }
+
+        void FormatTagStatistics(std::string& output, size_t index, MemoryTagStatistics const& tag)
+        {
+            fmt::format_to(
+                std::back_inserter(output),
+                "{}: live = {} KiB, peak = {} KiB, allocations = {}, rate = {:.0f}/s ({:.0f} KiB/s)",
+                MemoryTagNames[index],
+                tag.Live >> 10,
+                tag.Peak >> 10,
+                tag.Allocations,
+                tag.AllocationRate,
+                tag.ByteRate / 1024.0);
+        }
+
+        // Writes statistics of tags with any allocations to trace.
+        ConsoleFunction gMemoryTagsFunction{"Memory.Tags", [](std::string_view args)
+        {
+            (void)args;
+            MemoryTracking::ReportSnapshot();
+        }};
+    }
+
+    std::string_view GetMemoryTagName(MemoryTag tag)
+    {
+        size_t const index = static_cast<size_t>(tag);
+        return (index < MemoryTagCount) ? MemoryTagNames[index] : std::string_view{"Unknown"};
+    }
+
+#if ANEMONE_FEATURE_MEMORY_TRACKING
+    void MemoryTracking::TrackAllocation(MemoryTag tag, size_t size)
+    {
+        size_t const index = static_cast<size_t>(tag);
+        int64_t const delta = static_cast<int64_t>(size);
+
+        TrackingState& state = GetTrackingState();
+        TrackingShard& shard = state.Shards[tlsTrackingShard];
+
+        shard.Allocations[index].fetch_add(1, std::memory_order::relaxed);
+        shard.AllocatedBytes[index].fetch_add(size, std::memory_order::relaxed);
+
+        if ((shard.Pending[index].fetch_add(delta, std::memory_order::relaxed) + delta) >= PublishThreshold)
+            [[unlikely]]
+        {
+            int64_t const pending = shard.Pending[index].exchange(0, std::memory_order::relaxed);
+            int64_t const live = state.Live[index].fetch_add(pending, std::memory_order::relaxed) + pending;
+            UpdatePeak(state.Peak[index], live);
+        }
+    }
+
+    void MemoryTracking::TrackDeallocation(MemoryTag tag, size_t size)
+    {
+        size_t const index = static_cast<size_t>(tag);
+        int64_t const delta = static_cast<int64_t>(size);
+
+        TrackingState& state = GetTrackingState();
+        TrackingShard& shard = state.Shards[tlsTrackingShard];
+
+        if ((shard.Pending[index].fetch_sub(delta, std::memory_order::relaxed) - delta) <= -PublishThreshold)
+            [[unlikely]]
+        {
+            int64_t const pending = shard.Pending[index].exchange(0, std::memory_order::relaxed);
+            state.Live[index].fetch_add(pending, std::memory_order::relaxed);
+        }
+    }
+#endif
+
+    MemoryTag MemoryTracking::GetCurrentTag()
+    {
+        return tlsCurrentMemoryTag;
+    }
+
+    MemoryTag MemoryTracking::ExchangeCurrentTag(MemoryTag tag)
+    {
+        return std::exchange(tlsCurrentMemoryTag, tag);
+    }
+
+    MemoryTrackingSnapshot MemoryTracking::CaptureSnapshot()
+    {
+        TrackingState& state = GetTrackingState();
+
+        MemoryTrackingSnapshot result{};
+
+        for (size_t i = 0; i < MemoryTagCount; ++i)
+        {
+            MemoryTagStatistics& tag = result.Tags[i];
+
+            tag.Live = state.Live[i].load(std::memory_order::relaxed);
+
+            for (TrackingShard const& shard : state.Shards)
+            {
+                tag.Live += shard.Pending[i].load(std::memory_order::relaxed);
+                tag.Allocations += shard.Allocations[i].load(std::memory_order::relaxed);
+                tag.AllocatedBytes += shard.AllocatedBytes[i].load(std::memory_order::relaxed);
+            }
+
+            // Include unpublished bytes, so peak is never below current value.
+            UpdatePeak(state.Peak[i], tag.Live);
+            tag.Peak = state.Peak[i].load(std::memory_order::relaxed);
+        }
+
+        UniqueLock scope{state.SnapshotLock};
+
+        Instant const now = Instant::Now();
+        result.Interval = now - state.SnapshotTime;
+        state.SnapshotTime = now;
+
+        double const seconds = static_cast<double>(result.Interval.ToNanoseconds()) / 1'000'000'000.0;
+
+        for (size_t i = 0; i < MemoryTagCount; ++i)
+        {
+            MemoryTagStatistics& tag = result.Tags[i];
+
+            if (seconds > 0.0)
+            {
+                tag.AllocationRate = static_cast<double>(tag.Allocations - state.SnapshotAllocations[i]) / seconds;
+                tag.ByteRate = static_cast<double>(tag.AllocatedBytes - state.SnapshotAllocatedBytes[i]) / seconds;
+            }
+
+            state.SnapshotAllocations[i] = tag.Allocations;
+            state.SnapshotAllocatedBytes[i] = tag.AllocatedBytes;
+        }
+
+        return result;
+    }
+
+    void MemoryTracking::ReportSnapshot()
+    {
+        MemoryTrackingSnapshot const snapshot = CaptureSnapshot();
+
+        TraceDispatcher& trace = Trace::Get();
+
+        std::string line{};
+
+        for (size_t i = 0; i < MemoryTagCount; ++i)
+        {
+            if (snapshot.Tags[i].Allocations != 0)
+            {
+                line.clear();
+                FormatTagStatistics(line, i, snapshot.Tags[i]);
+                trace.TraceInformation("memory: {}", line);
+            }
+        }
+    }
+}
@@ -0,0 +1,132 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+#include "AnemoneRuntime.Base/Duration.hxx"
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace Anemone::Memory
+{
+    //! Identifies subsystem which owns memory.
+    enum class MemoryTag : uint8_t
+    {
+        Untagged,
+        Core,
+        Tasks,
+        Assets,
+        Renderer,
+        Audio,
+        Physics,
+        Network,
+        Scripting,
+        UserInterface,
+        Tools,
+    };
+
+    inline constexpr size_t MemoryTagCount = static_cast<size_t>(MemoryTag::Tools) + 1;
+
+    ANEMONE_RUNTIME_BASE_API std::string_view GetMemoryTagName(MemoryTag tag);
+
+    struct MemoryTagStatistics final
+    {
+        //! Number of bytes currently allocated.
+        int64_t Live;
+
+        //! Largest observed number of live bytes. Live bytes are published in batches, so peak may be
+        //! underestimated by up to MemoryTracking::PublishThreshold per shard.
+        int64_t Peak;
+
+        //! Number of allocations made since startup.
+        uint64_t Allocations;
+
+        //! Number of bytes allocated since startup.
+        uint64_t AllocatedBytes;
+
+        //! Allocations per second since previous snapshot.
+        double AllocationRate;
+
+        //! Bytes allocated per second since previous snapshot.
+        double ByteRate;
+    };
+
+    struct MemoryTrackingSnapshot final
+    {
+        std::array<MemoryTagStatistics, MemoryTagCount> Tags;
+
+        //! Time since previous snapshot, used to compute rates.
+        Duration Interval;
+    };
+
+    //! Per-tag accounting of allocations.
+    //!
+    //! Counters are sharded; threads update shard selected by their index with relaxed atomics, so tracking
+    //! costs few uncontended atomic additions per allocation. Live bytes of each shard are published to global
+    //! counter once they exceed PublishThreshold, which is when peak is updated.
+    //!
+    //! Snapshot is written to trace by "Memory.Tags" console function.
+    class ANEMONE_RUNTIME_BASE_API MemoryTracking final
+    {
+    public:
+        static constexpr size_t ShardCount = 16;
+        static constexpr int64_t PublishThreshold = int64_t{64} << 10;
+
+    public:
+        MemoryTracking() = delete;
+
+#if ANEMONE_FEATURE_MEMORY_TRACKING
+        static void TrackAllocation(MemoryTag tag, size_t size);
+
+        static void TrackDeallocation(MemoryTag tag, size_t size);
+#else
+        static void TrackAllocation(MemoryTag tag, size_t size)
+        {
+            (void)tag;
+            (void)size;
+        }
+
+        static void TrackDeallocation(MemoryTag tag, size_t size)
+        {
+            (void)tag;
+            (void)size;
+        }
+#endif
+
+        //! Gets tag from innermost MemoryTagScope of calling thread.
+        static MemoryTag GetCurrentTag();
+
+        //! Captures counters of all tags. Rates are computed relative to previous snapshot.
+        static MemoryTrackingSnapshot CaptureSnapshot();
+
+        //! Writes snapshot of tags with any allocations to trace.
+        static void ReportSnapshot();
+
+    private:
+        friend class MemoryTagScope;
+
+        static MemoryTag ExchangeCurrentTag(MemoryTag tag);
+    };
+
+    //! Sets tag used by allocations made on current thread until end of scope.
+    class MemoryTagScope final
+    {
+    private:
+        MemoryTag m_Previous;
+
+    public:
+        explicit MemoryTagScope(MemoryTag tag)
+            : m_Previous{MemoryTracking::ExchangeCurrentTag(tag)}
+        {
+        }
+
+        MemoryTagScope(MemoryTagScope const&) = delete;
+        MemoryTagScope(MemoryTagScope&&) = delete;
+        MemoryTagScope& operator=(MemoryTagScope const&) = delete;
+        MemoryTagScope& operator=(MemoryTagScope&&) = delete;
+
+        ~MemoryTagScope()
+        {
+            MemoryTracking::ExchangeCurrentTag(this->m_Previous);
+        }
+    };
+}
@@ -1,8 +1,53 @@
 #pragma once
-#include "AnemoneRuntime.Platform/Detect.hxx"
+#include "AnemoneRuntime.Interop/Headers.hxx"
+#include "AnemoneRuntime.Base/Memory/Allocator.hxx"
+#include "AnemoneRuntime.Base/Bitwise.hxx"
+#include "AnemoneRuntime.Base/Intrusive.hxx"
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
+
+#include <cstdint>
+#include <new>
 
 namespace Anemone::Memory
 {
+    struct SlabAllocatorStatistics final
+    {
+        //! Size of single allocation.
+        size_t AllocationSize;
+
+        //! Number of allocations which fit in single slab.
+        size_t SlabCapacity;
+
+        size_t PartialSlabs;
+        size_t FullSlabs;
+
+        //! Number of empty slabs kept in reserve.
+        size_t EmptySlabs;
+
+        //! Number of allocations currently handed out.
+        size_t Allocated;
+
+        //! Number of slabs obtained from backing allocator over lifetime of slab allocator.
+        size_t SlabsCreated;
+
+        //! Number of slabs returned to backing allocator over lifetime of slab allocator.
+        size_t SlabsReleased;
+
+        //! Gets ratio of allocated elements to capacity of slabs in use, ignoring reserve.
+        double GetOccupancy() const
+        {
+            size_t const capacity = (this->PartialSlabs + this->FullSlabs) * this->SlabCapacity;
+            return (capacity != 0) ? static_cast<double>(this->Allocated) / static_cast<double>(capacity) : 1.0;
+        }
+
+        //! Gets number of slabs which could be released if allocated elements were packed tightly.
+        size_t GetFragmentedSlabs() const
+        {
+            size_t const required = (this->Allocated + this->SlabCapacity - 1) / this->SlabCapacity;
+            return this->PartialSlabs + this->FullSlabs - required;
+        }
+    };
+
     class SlabAllocator
     {
     private:
@@ -26,29 +71,107 @@ namespace Anemone::Memory
     private:
         IntrusiveList<SlabHeader, SlabAllocator> m_partial{};
         IntrusiveList<SlabHeader, SlabAllocator> m_full{};
+        IntrusiveList<SlabHeader, SlabAllocator> m_empty{};
         Allocator* m_allocator{};
         size_t m_allocationSize{};
         size_t m_allocationAlignment{};
         size_t m_slabCapacity{};
+        size_t m_emptySlabReserve{};
 
+        // Statistics.
+        size_t m_partialCount{};
+        size_t m_fullCount{};
+        size_t m_emptyCount{};
+        size_t m_allocated{};
+        size_t m_slabsCreated{};
+        size_t m_slabsReleased{};
+
+    public:
         static constexpr size_t SlabSize = 64u << 10u;
 
     private:
         static SlabHeader* GetSlabHeaderFromPointer(void* pointer)
         {
-            return static_cast<SlabHeader*>(Bitwise::AlignDown(pointer, SlabSize));
+            return static_cast<SlabHeader*>(AlignDown(pointer, SlabSize));
         }
 
     public:
-        SlabAllocator(Allocator* allocator, size_t allocationSize, size_t allocationAlignment)
+        //! Gets slab allocator which owns given allocation.
+        static SlabAllocator* GetOwner(void* pointer)
+        {
+            SlabHeader const* const slab = GetSlabHeaderFromPointer(pointer);
+            AE_ASSERT(slab->m_signature == SlabHeaderSignature);
+            return slab->m_owner;
+        }
+
+    public:
+        //! \param emptySlabReserve Number of empty slabs kept for reuse instead of returning them to allocator,
+        //!     so pool oscillating around slab boundary doesn't allocate and release slab every time.
+        SlabAllocator(Allocator* allocator, size_t allocationSize, size_t allocationAlignment, size_t emptySlabReserve = 0)
             : m_allocator{allocator}
             , m_allocationSize{allocationSize}
             , m_allocationAlignment{allocationAlignment}
+            , m_emptySlabReserve{emptySlabReserve}
+        {
+            AE_ASSERT(IsAligned(allocationSize, allocationAlignment));
+            AE_ASSERT(IsPowerOf2(allocationAlignment));
+
+            // First element is aligned, so account for padding after header.
+            this->m_slabCapacity = (SlabSize - AlignUp(sizeof(SlabHeader), allocationAlignment)) / allocationSize;
+            AE_ASSERT(this->m_slabCapacity != 0);
+        }
+
+        SlabAllocator(SlabAllocator const&) = delete;
+        SlabAllocator(SlabAllocator&&) = delete;
+        SlabAllocator& operator=(SlabAllocator const&) = delete;
+        SlabAllocator& operator=(SlabAllocator&&) = delete;
+
+        //! Releases reserved empty slabs. Slabs with live allocations are not tracked past this point.
+        ~SlabAllocator()
+        {
+            this->SetEmptySlabReserve(0);
+        }
+
+        size_t GetAllocationSize() const
+        {
+            return this->m_allocationSize;
+        }
+
+        size_t GetSlabCapacity() const
         {
-            AE_ASSERT(Bitwise::IsAligned(allocationSize, allocationAlignment));
-            AE_ASSERT(Bitwise::IsPowerOf2(allocationAlignment));
+            return this->m_slabCapacity;
+        }
 
-            this->m_slabCapacity = (SlabSize - sizeof(SlabHeader)) / allocationSize;
+        size_t GetEmptySlabReserve() const
+        {
+            return this->m_emptySlabReserve;
+        }
+
+        //! Sets number of empty slabs kept in reserve, releasing excess ones.
+        void SetEmptySlabReserve(size_t count)
+        {
+            this->m_emptySlabReserve = count;
+
+            while (this->m_emptyCount > count)
+            {
+                SlabHeader* const slab = this->m_empty.PopFront();
+                --this->m_emptyCount;
+                this->DeleteSlab(slab);
+            }
+        }
+
+        SlabAllocatorStatistics GetStatistics() const
+        {
+            return SlabAllocatorStatistics{
+                .AllocationSize = this->m_allocationSize,
+                .SlabCapacity = this->m_slabCapacity,
+                .PartialSlabs = this->m_partialCount,
+                .FullSlabs = this->m_fullCount,
+                .EmptySlabs = this->m_emptyCount,
+                .Allocated = this->m_allocated,
+                .SlabsCreated = this->m_slabsCreated,
+                .SlabsReleased = this->m_slabsReleased,
+            };
         }
 
         void* Allocate()
@@ -58,10 +181,26 @@ namespace Anemone::Memory
             if (slab == nullptr)
                 [[unlikely]]
             {
-                // Allocate new slab.
-                slab = this->NewSlab();
+                if (this->m_emptyCount != 0)
+                {
+                    // Reuse reserved slab; its free list is still intact.
+                    slab = this->m_empty.PopFront();
+                    --this->m_emptyCount;
+                }
+                else
+                {
+                    // Allocate new slab.
+                    slab = this->NewSlab();
+
+                    if (slab == nullptr)
+                    {
+                        return nullptr;
+                    }
+                }
+
                 // Push it to list of partial slabs.
                 this->m_partial.PushFront(slab);
+                ++this->m_partialCount;
             }
 
             AE_ASSERT(slab != nullptr);
@@ -77,12 +216,15 @@ namespace Anemone::Memory
 
             // Update count of allocated elements.
             --slab->m_capacity;
+            ++this->m_allocated;
 
             if (slab->m_capacity == 0)
             {
                 // Move that slab to the full list.
                 this->m_partial.Remove(slab);
                 this->m_full.PushFront(slab);
+                --this->m_partialCount;
+                ++this->m_fullCount;
             }
 
             // Return the allocated element.
@@ -102,6 +244,7 @@ namespace Anemone::Memory
 
             // Update capacity.
             ++slab->m_capacity;
+            --this->m_allocated;
 
             // Link item back to free list
             slab->m_first = new (ptr) FreeEntry{.m_next = slab->m_first};
@@ -111,12 +254,25 @@ namespace Anemone::Memory
                 // Slab was full. Move it back to the partial list.
                 this->m_full.Remove(slab);
                 this->m_partial.PushFront(slab);
+                --this->m_fullCount;
+                ++this->m_partialCount;
             }
-            else if (slab->m_capacity == this->m_slabCapacity)
+
+            if (slab->m_capacity == this->m_slabCapacity)
             {
-                // Slab was on the partial list and now became empty. Deallocate it.
+                // Slab was on the partial list and now became empty. Keep it in reserve or deallocate it.
                 this->m_partial.Remove(slab);
-                this->DeleteSlab(slab);
+                --this->m_partialCount;
+
+                if (this->m_emptyCount < this->m_emptySlabReserve)
+                {
+                    this->m_empty.PushFront(slab);
+                    ++this->m_emptyCount;
+                }
+                else
+                {
+                    this->DeleteSlab(slab);
+                }
             }
         }
 
@@ -129,7 +285,12 @@ namespace Anemone::Memory
                 .Alignment = SlabSize,
             });
 
-            std::byte* it = Bitwise::AlignUp(static_cast<std::byte*>(buffer.Address) + sizeof(SlabHeader), this->m_allocationAlignment);
+            if (buffer.Address == nullptr)
+            {
+                return nullptr;
+            }
+
+            std::byte* it = AlignUp(static_cast<std::byte*>(buffer.Address) + sizeof(SlabHeader), this->m_allocationAlignment);
 
             // First entry in free list.
             FreeEntry* const first = new (it) FreeEntry;
@@ -156,6 +317,8 @@ namespace Anemone::Memory
             // Last entry in the slab.
             last->m_next = nullptr;
 
+            ++this->m_slabsCreated;
+
             return new (buffer.Address) SlabHeader{
                 .m_signature = SlabHeaderSignature,
                 .m_owner = this,
@@ -172,6 +335,7 @@ namespace Anemone::Memory
             AE_ASSERT(slab->m_owner == this);
 
             slab->~SlabHeader();
+            ++this->m_slabsReleased;
 
             this->m_allocator->Deallocate(Allocation{
                 .Address = slab,
@@ -0,0 +1,625 @@
+#include "AnemoneRuntime.Base/Memory/ThreadCachingAllocator.hxx"
+#include "AnemoneRuntime.Base/Memory/SlabAllocator.hxx"
+#include "AnemoneRuntime.Base/Bitwise.hxx"
+#include "AnemoneRuntime.Threading/Lock.hxx"
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+
+namespace Anemone::Memory
+{
+    namespace
+    {
+        struct SizeClassInfo final
+        {
+            uint32_t Size;
+            uint32_t Alignment;
+        };
+
+        // Classes are spaced by 16 bytes up to 128 bytes, then by quarter of power of two.
+        consteval std::array<SizeClassInfo, ThreadCachingAllocator::SizeClassCount> BuildSizeClasses()
+        {
+            std::array<SizeClassInfo, ThreadCachingAllocator::SizeClassCount> result{};
+
+            size_t index = 0;
+
+            for (uint32_t size = 16; size <= 128; size += 16)
+            {
+                result[index++].Size = size;
+            }
+
+            for (uint32_t base = 128; base < ThreadCachingAllocator::MaxSmallSize; base *= 2)
+            {
+                for (uint32_t step = 1; step <= 4; ++step)
+                {
+                    result[index++].Size = base + (step * (base / 4));
+                }
+            }
+
+            for (SizeClassInfo& info : result)
+            {
+                // Elements of slab are aligned to largest power of two dividing their size.
+                info.Alignment = std::min<uint32_t>(info.Size & (~info.Size + 1), ThreadCachingAllocator::MaxSmallAlignment);
+            }
+
+            return result;
+        }
+
+        constexpr std::array<SizeClassInfo, ThreadCachingAllocator::SizeClassCount> SizeClasses = BuildSizeClasses();
+
+        static_assert(SizeClasses.back().Size == ThreadCachingAllocator::MaxSmallSize);
+
+        // Maps size rounded up to minimal alignment to smallest size class which fits it.
+        consteval std::array<uint8_t, (ThreadCachingAllocator::MaxSmallSize / ThreadCachingAllocator::MinAlignment) + 1> BuildSizeClassLookup()
+        {
+            std::array<uint8_t, (ThreadCachingAllocator::MaxSmallSize / ThreadCachingAllocator::MinAlignment) + 1> result{};
+
+            size_t sizeClass = 0;
+
+            for (size_t i = 0; i < result.size(); ++i)
+            {
+                while (SizeClasses[sizeClass].Size < (i * ThreadCachingAllocator::MinAlignment))
+                {
+                    ++sizeClass;
+                }
+
+                result[i] = static_cast<uint8_t>(sizeClass);
+            }
+
+            return result;
+        }
+
+        constexpr auto SizeClassLookup = BuildSizeClassLookup();
+
+        size_t GetSizeClass(size_t size, size_t alignment)
+        {
+            size_t sizeClass = SizeClassLookup[(size + ThreadCachingAllocator::MinAlignment - 1) / ThreadCachingAllocator::MinAlignment];
+
+            // Power of two classes guarantee that suitable class is always found.
+            while (SizeClasses[sizeClass].Alignment < alignment)
+            {
+                ++sizeClass;
+            }
+
+            return sizeClass;
+        }
+
+        // Block freed by thread other than owner of its heap.
+        struct RemoteBlock final
+        {
+            RemoteBlock* Next{};
+        };
+
+        // Registry of live allocators; exiting threads use it to skip heaps of destroyed allocators.
+        struct Registry final
+        {
+            Spinlock Lock{};
+            std::vector<std::pair<ThreadCachingAllocator const*, uint64_t>> Live{};
+            uint64_t LastId{};
+
+            bool IsLive(ThreadCachingAllocator const* allocator, uint64_t id) const
+            {
+                return std::ranges::find(this->Live, std::pair{allocator, id}) != this->Live.end();
+            }
+        };
+
+        Registry& GetRegistry()
+        {
+            // Never destroyed; threads may exit after static destructors were run.
+            static Registry* const instance = new Registry{};
+            return *instance;
+        }
+
+        // Set when thread state of current thread was destroyed; allocations fall back to shared heap.
+        thread_local bool tlsThreadStateDestroyed{};
+    }
+
+    static_assert(SlabAllocator::SlabSize == ThreadCachingAllocator::SpanSize);
+
+    struct ThreadCachingAllocator::Heap final : IntrusiveListNode<Heap>
+    {
+        struct SizeClass final : SlabAllocator
+        {
+            Heap* Owner;
+
+            SizeClass(Allocator* spans, size_t index, Heap* owner)
+                : SlabAllocator{spans, SizeClasses[index].Size, SizeClasses[index].Alignment}
+                , Owner{owner}
+            {
+            }
+        };
+
+        // Written by other threads; keep it away from data used only by owner.
+        alignas(ANEMONE_CACHELINE_SIZE) std::atomic<RemoteBlock*> RemoteFrees{};
+
+        alignas(ANEMONE_CACHELINE_SIZE) std::array<SizeClass, SizeClassCount> Classes;
+
+        // Written only by owning thread; read by statistics.
+        std::atomic_uint64_t Allocations{};
+        std::atomic_uint64_t Deallocations{};
+
+        explicit Heap(Allocator& spans)
+            : Classes{MakeClasses(spans, this, std::make_index_sequence<SizeClassCount>{})}
+        {
+        }
+
+        Heap(Heap const&) = delete;
+        Heap(Heap&&) = delete;
+        Heap& operator=(Heap const&) = delete;
+        Heap& operator=(Heap&&) = delete;
+        ~Heap() = default;
+
+        template <size_t... Indices>
+        static std::array<SizeClass, SizeClassCount> MakeClasses(Allocator& spans, Heap* owner, std::index_sequence<Indices...>)
+        {
+            return {{SizeClass{&spans, Indices, owner}...}};
+        }
+
+        static SizeClass* GetSizeClass(void* pointer)
+        {
+            return static_cast<SizeClass*>(SlabAllocator::GetOwner(pointer));
+        }
+    };
+
+    struct ThreadCachingAllocator::ThreadState final
+    {
+        struct Entry final
+        {
+            ThreadCachingAllocator const* Allocator{};
+            uint64_t Id{};
+            Heap* ThreadHeap{};
+        };
+
+        // Threads rarely use more than one or two allocators; evicted heaps are abandoned.
+        std::array<Entry, 4> Entries{};
+
+        ThreadState() = default;
+        ThreadState(ThreadState const&) = delete;
+        ThreadState(ThreadState&&) = delete;
+        ThreadState& operator=(ThreadState const&) = delete;
+        ThreadState& operator=(ThreadState&&) = delete;
+
+        ~ThreadState()
+        {
+            tlsThreadStateDestroyed = true;
+
+            for (Entry& entry : this->Entries)
+            {
+                Release(entry);
+            }
+        }
+
+        static void Release(Entry& entry)
+        {
+            if (entry.ThreadHeap != nullptr)
+            {
+                Registry& registry = GetRegistry();
+                UniqueLock scope{registry.Lock};
+
+                if (registry.IsLive(entry.Allocator, entry.Id))
+                {
+                    ThreadCachingAllocator& allocator = const_cast<ThreadCachingAllocator&>(*entry.Allocator);
+                    UniqueLock heapScope{allocator.m_Lock};
+                    allocator.AbandonHeap(entry.ThreadHeap);
+                }
+            }
+
+            entry = {};
+        }
+    };
+
+    ThreadCachingAllocator::SpanCache::~SpanCache()
+    {
+        // Releases spans still used by slabs as well; allocator is destroyed at this point.
+        for (void* span : this->m_Spans)
+        {
+            this->m_Backing.Deallocate(Allocation{
+                .Address = span,
+                .Size = SpanSize,
+            });
+        }
+    }
+
+    Allocation ThreadCachingAllocator::SpanCache::Allocate(Layout const& layout)
+    {
+        AE_ASSERT(layout.Size == SpanSize);
+        AE_ASSERT(layout.Alignment == SpanSize);
+
+        {
+            UniqueLock scope{this->m_Lock};
+
+            if (not this->m_Free.empty())
+            {
+                void* const span = this->m_Free.back();
+                this->m_Free.pop_back();
+
+                return Allocation{
+                    .Address = span,
+                    .Size = SpanSize,
+                };
+            }
+        }
+
+        Allocation const result = this->m_Backing.Allocate(layout);
+
+        if (result.Address != nullptr)
+        {
+            UniqueLock scope{this->m_Lock};
+            this->m_Spans.insert(result.Address);
+        }
+
+        return result;
+    }
+
+    void ThreadCachingAllocator::SpanCache::Deallocate(Allocation const& allocation)
+    {
+        {
+            UniqueLock scope{this->m_Lock};
+
+            if (this->m_Free.size() < MaxCachedSpans)
+            {
+                this->m_Free.push_back(allocation.Address);
+                return;
+            }
+
+            this->m_Spans.erase(allocation.Address);
+        }
+
+        this->m_Backing.Deallocate(Allocation{
+            .Address = allocation.Address,
+            .Size = SpanSize,
+        });
+    }
+
+    Allocation ThreadCachingAllocator::SpanCache::Reallocate(Allocation const& allocation, Layout const& layout)
+    {
+        (void)allocation;
+        (void)layout;
+        AE_PANIC("Not supported");
+    }
+
+    void ThreadCachingAllocator::SpanCache::GetStatistics(ThreadCachingAllocatorStatistics& statistics)
+    {
+        UniqueLock scope{this->m_Lock};
+        statistics.Spans = this->m_Spans.size();
+        statistics.CachedSpans = this->m_Free.size();
+    }
+
+    ThreadCachingAllocator::ThreadCachingAllocator(Allocator& backing)
+        : m_Backing{backing}
+        , m_Spans{backing}
+    {
+        this->m_FallbackHeap = new Heap{this->m_Spans};
+        this->m_Heaps.PushBack(this->m_FallbackHeap);
+
+        Registry& registry = GetRegistry();
+        UniqueLock scope{registry.Lock};
+        this->m_Id = ++registry.LastId;
+        registry.Live.emplace_back(this, this->m_Id);
+    }
+
+    ThreadCachingAllocator::~ThreadCachingAllocator()
+    {
+        {
+            Registry& registry = GetRegistry();
+            UniqueLock scope{registry.Lock};
+            std::erase(registry.Live, std::pair<ThreadCachingAllocator const*, uint64_t>{this, this->m_Id});
+        }
+
+        // Thread states may still refer to these heaps; registry tells them this allocator is gone.
+        while (Heap* heap = this->m_Heaps.PopFront())
+        {
+            delete heap;
+        }
+    }
+
+    Allocation ThreadCachingAllocator::Allocate(Layout const& layout)
+    {
+        AE_ASSERT(layout.Size != 0);
+        AE_ASSERT(IsPowerOf2(layout.Alignment));
+
+        if ((layout.Size > MaxSmallSize) or (layout.Alignment > MaxSmallAlignment))
+            [[unlikely]]
+        {
+            return this->AllocateLarge(layout);
+        }
+
+        size_t const sizeClass = GetSizeClass(layout.Size, layout.Alignment);
+
+        if (Heap* const heap = this->AcquireThreadHeap())
+            [[likely]]
+        {
+            return Allocation{
+                .Address = this->AllocateSmall(*heap, sizeClass),
+                .Size = SizeClasses[sizeClass].Size,
+            };
+        }
+
+        // Thread is exiting; allocate from shared heap.
+        UniqueLock scope{this->m_Lock};
+
+        return Allocation{
+            .Address = this->AllocateSmall(*this->m_FallbackHeap, sizeClass),
+            .Size = SizeClasses[sizeClass].Size,
+        };
+    }
+
+    void ThreadCachingAllocator::Deallocate(Allocation const& allocation)
+    {
+        if (allocation.Address == nullptr)
+        {
+            return;
+        }
+
+        // Slab elements are never span-aligned, as slab header is placed at the beginning of span.
+        if (IsAligned(allocation.Address, SpanSize))
+        {
+            this->DeallocateLarge(allocation);
+        }
+        else
+        {
+            this->DeallocateSmall(allocation.Address);
+        }
+    }
+
+    Allocation ThreadCachingAllocator::Reallocate(Allocation const& allocation, Layout const& layout)
+    {
+        if (allocation.Address == nullptr)
+        {
+            return this->Allocate(layout);
+        }
+
+        if ((not IsAligned(allocation.Address, SpanSize)) and (layout.Size <= MaxSmallSize) and (layout.Alignment <= MaxSmallAlignment))
+        {
+            size_t const capacity = Heap::GetSizeClass(allocation.Address)->GetAllocationSize();
+
+            if (SizeClasses[GetSizeClass(layout.Size, layout.Alignment)].Size == capacity)
+            {
+                // Same size class; block can be reused as is.
+                return Allocation{
+                    .Address = allocation.Address,
+                    .Size = capacity,
+                };
+            }
+        }
+
+        Allocation const result = this->Allocate(layout);
+
+        if (result.Address != nullptr)
+        {
+            std::memcpy(result.Address, allocation.Address, std::min(allocation.Size, layout.Size));
+            this->Deallocate(allocation);
+        }
+
+        return result;
+    }
+
+    ThreadCachingAllocatorStatistics ThreadCachingAllocator::GetStatistics()
+    {
+        ThreadCachingAllocatorStatistics result{
+            .RemoteDeallocations = this->m_RemoteDeallocations.load(std::memory_order::relaxed),
+            .LargeAllocations = this->m_LargeAllocations.load(std::memory_order::relaxed),
+        };
+
+        this->m_Spans.GetStatistics(result);
+
+        UniqueLock scope{this->m_Lock};
+
+        this->m_Heaps.ForEach([&](Heap const& heap)
+        {
+            result.Allocations += heap.Allocations.load(std::memory_order::relaxed);
+            result.Deallocations += heap.Deallocations.load(std::memory_order::relaxed);
+
+            if (&heap != this->m_FallbackHeap)
+            {
+                ++result.Heaps;
+            }
+        });
+
+        return result;
+    }
+
+    void ThreadCachingAllocator::CollectRemoteFrees()
+    {
+        if (Heap* const heap = this->FindThreadHeap())
+        {
+            CollectRemoteFrees(*heap);
+        }
+    }
+
+    ThreadCachingAllocator::ThreadState& ThreadCachingAllocator::GetThreadState()
+    {
+        thread_local ThreadState state{};
+        return state;
+    }
+
+    ThreadCachingAllocator::Heap* ThreadCachingAllocator::FindThreadHeap() const
+    {
+        if (tlsThreadStateDestroyed)
+            [[unlikely]]
+        {
+            return nullptr;
+        }
+
+        for (ThreadState::Entry const& entry : GetThreadState().Entries)
+        {
+            if ((entry.Allocator == this) and (entry.Id == this->m_Id))
+            {
+                return entry.ThreadHeap;
+            }
+        }
+
+        return nullptr;
+    }
+
+    ThreadCachingAllocator::Heap* ThreadCachingAllocator::AcquireThreadHeap()
+    {
+        if (Heap* const heap = this->FindThreadHeap())
+            [[likely]]
+        {
+            return heap;
+        }
+
+        if (tlsThreadStateDestroyed)
+        {
+            return nullptr;
+        }
+
+        return this->AttachThreadHeap();
+    }
+
+    ThreadCachingAllocator::Heap* ThreadCachingAllocator::AttachThreadHeap()
+    {
+        ThreadState& state = GetThreadState();
+
+        auto it = std::ranges::find_if(state.Entries, [](ThreadState::Entry const& entry)
+        {
+            return entry.ThreadHeap == nullptr;
+        });
+
+        if (it == state.Entries.end())
+        {
+            // No free slot; abandon heap of the oldest entry.
+            it = state.Entries.begin();
+            ThreadState::Release(*it);
+            std::rotate(state.Entries.begin(), state.Entries.begin() + 1, state.Entries.end());
+            it = state.Entries.end() - 1;
+        }
+
+        Heap* heap = nullptr;
+
+        {
+            UniqueLock scope{this->m_Lock};
+
+            if (not this->m_Abandoned.empty())
+            {
+                heap = this->m_Abandoned.back();
+                this->m_Abandoned.pop_back();
+            }
+        }
+
+        if (heap == nullptr)
+        {
+            heap = new Heap{this->m_Spans};
+
+            UniqueLock scope{this->m_Lock};
+            this->m_Heaps.PushBack(heap);
+        }
+
+        *it = ThreadState::Entry{
+            .Allocator = this,
+            .Id = this->m_Id,
+            .ThreadHeap = heap,
+        };
+
+        return heap;
+    }
+
+    void ThreadCachingAllocator::AbandonHeap(Heap* heap)
+    {
+        AE_ASSERT(heap != this->m_FallbackHeap);
+        this->m_Abandoned.push_back(heap);
+    }
+
+    void* ThreadCachingAllocator::AllocateSmall(Heap& heap, size_t sizeClass)
+    {
+        if (heap.RemoteFrees.load(std::memory_order::relaxed) != nullptr)
+            [[unlikely]]
+        {
+            CollectRemoteFrees(heap);
+        }
+
+        heap.Allocations.store(heap.Allocations.load(std::memory_order::relaxed) + 1, std::memory_order::relaxed);
+
+        return heap.Classes[sizeClass].Allocate();
+    }
+
+    void ThreadCachingAllocator::CollectRemoteFrees(Heap& heap)
+    {
+        RemoteBlock* block = heap.RemoteFrees.exchange(nullptr, std::memory_order::acquire);
+
+        uint64_t count = 0;
+
+        while (block != nullptr)
+        {
+            RemoteBlock* const next = block->Next;
+            block->~RemoteBlock();
+
+            Heap::SizeClass* const sizeClass = Heap::GetSizeClass(block);
+            AE_ASSERT(sizeClass->Owner == &heap);
+            sizeClass->Deallocate(block);
+
+            block = next;
+            ++count;
+        }
+
+        heap.Deallocations.store(heap.Deallocations.load(std::memory_order::relaxed) + count, std::memory_order::relaxed);
+    }
+
+    void ThreadCachingAllocator::DeallocateSmall(void* pointer)
+    {
+        Heap::SizeClass* const sizeClass = Heap::GetSizeClass(pointer);
+        Heap* const owner = sizeClass->Owner;
+
+        if (owner == this->FindThreadHeap())
+            [[likely]]
+        {
+            sizeClass->Deallocate(pointer);
+            owner->Deallocations.store(owner->Deallocations.load(std::memory_order::relaxed) + 1, std::memory_order::relaxed);
+            return;
+        }
+
+        // Block belongs to other thread, abandoned heap or fallback heap; let owner return it to its slab.
+        RemoteBlock* const block = new (pointer) RemoteBlock{};
+        RemoteBlock* head = owner->RemoteFrees.load(std::memory_order::relaxed);
+
+        do
+        {
+            block->Next = head;
+        } while (not owner->RemoteFrees.compare_exchange_weak(head, block, std::memory_order::release, std::memory_order::relaxed));
+
+        this->m_RemoteDeallocations.fetch_add(1, std::memory_order::relaxed);
+    }
+
+    Allocation ThreadCachingAllocator::AllocateLarge(Layout const& layout)
+    {
+        size_t const alignment = std::max(layout.Alignment, SpanSize);
+
+        Allocation const result = this->m_Backing.Allocate(Layout{
+            .Size = AlignUp(layout.Size, alignment),
+            .Alignment = alignment,
+        });
+
+        if (result.Address != nullptr)
+        {
+            this->m_LargeAllocations.fetch_add(1, std::memory_order::relaxed);
+
+            UniqueLock scope{this->m_LargeLock};
+            this->m_LargeSizes.emplace(result.Address, result.Size);
+        }
+
+        return result;
+    }
+
+    void ThreadCachingAllocator::DeallocateLarge(Allocation const& allocation)
+    {
+        size_t size;
+
+        {
+            UniqueLock scope{this->m_LargeLock};
+            auto const it = this->m_LargeSizes.find(allocation.Address);
+            AE_ASSERT(it != this->m_LargeSizes.end());
+            size = it->second;
+            this->m_LargeSizes.erase(it);
+        }
+
+        // Caller may pass requested size; mapping is released with size it was created with.
+        this->m_Backing.Deallocate(Allocation{
+            .Address = allocation.Address,
+            .Size = size,
+        });
+    }
+}
@@ -0,0 +1,161 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+#include "AnemoneRuntime.Base/Memory/Allocator.hxx"
+#include "AnemoneRuntime.Base/Intrusive.hxx"
+#include "AnemoneRuntime.Threading/Spinlock.hxx"
+
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Anemone::Memory
+{
+    struct ThreadCachingAllocatorStatistics final
+    {
+        //! Number of allocations served from size class slabs.
+        uint64_t Allocations;
+
+        //! Number of small allocations returned.
+        uint64_t Deallocations;
+
+        //! Number of small allocations freed by thread other than owner of the slab.
+        uint64_t RemoteDeallocations;
+
+        //! Number of allocations too large or too aligned for size classes, served by backing allocator.
+        uint64_t LargeAllocations;
+
+        //! Number of spans currently obtained from backing allocator.
+        uint64_t Spans;
+
+        //! Number of empty spans kept for reuse.
+        uint64_t CachedSpans;
+
+        //! Number of thread heaps, including abandoned ones.
+        uint64_t Heaps;
+    };
+
+    //! General purpose allocator with per-thread heaps.
+    //!
+    //! Every thread gets own heap with one slab allocator per size class, so allocations and frees made by
+    //! the same thread never synchronize. Memory freed by other thread is pushed onto lock-free remote free
+    //! list of owning heap and returned to slabs by owner on its next allocation. Slabs are carved from
+    //! 64 KiB spans shared by all heaps through central span cache.
+    //!
+    //! Heap of exiting thread is abandoned and adopted by next thread which starts using this allocator,
+    //! together with any memory still allocated from it.
+    //!
+    //! Allocations larger than MaxSmallSize or aligned above MaxSmallAlignment go directly to backing
+    //! allocator. Backing allocator must provide span-aligned blocks, as SystemAllocator does.
+    class ANEMONE_RUNTIME_BASE_API ThreadCachingAllocator final : public Allocator
+    {
+    public:
+        static constexpr size_t SpanSize = size_t{64} << 10u;
+        static constexpr size_t MinAlignment = 16;
+        static constexpr size_t MaxSmallSize = size_t{8} << 10u;
+        static constexpr size_t MaxSmallAlignment = size_t{4} << 10u;
+        static constexpr size_t SizeClassCount = 32;
+
+        //! Number of empty spans kept by central cache before they are returned to backing allocator.
+        static constexpr size_t MaxCachedSpans = 64;
+
+    private:
+        struct Heap;
+        struct ThreadState;
+
+        //! Source of spans for slab allocators of all heaps.
+        class SpanCache final : public Allocator
+        {
+        private:
+            Allocator& m_Backing;
+            Spinlock m_Lock{};
+            std::vector<void*> m_Free{};
+            std::unordered_set<void*> m_Spans{};
+
+        public:
+            explicit SpanCache(Allocator& backing)
+                : m_Backing{backing}
+            {
+            }
+
+            SpanCache(SpanCache const&) = delete;
+            SpanCache(SpanCache&&) = delete;
+            SpanCache& operator=(SpanCache const&) = delete;
+            SpanCache& operator=(SpanCache&&) = delete;
+            ~SpanCache() override;
+
+        public:
+            Allocation Allocate(Layout const& layout) override;
+            void Deallocate(Allocation const& allocation) override;
+            Allocation Reallocate(Allocation const& allocation, Layout const& layout) override;
+
+            void GetStatistics(ThreadCachingAllocatorStatistics& statistics);
+        };
+
+    private:
+        Allocator& m_Backing;
+        SpanCache m_Spans;
+        uint64_t m_Id{};
+
+        // Guards registry of heaps.
+        Spinlock m_Lock{};
+        IntrusiveList<Heap> m_Heaps{};
+        std::vector<Heap*> m_Abandoned{};
+
+        // Heap used by threads which already destroyed their thread state. Guarded by m_Lock.
+        Heap* m_FallbackHeap{};
+
+        // Size mapped for each large allocation; over-aligned ones are rounded to their alignment.
+        Spinlock m_LargeLock{};
+        std::unordered_map<void*, size_t> m_LargeSizes{};
+
+        std::atomic_uint64_t m_RemoteDeallocations{};
+        std::atomic_uint64_t m_LargeAllocations{};
+
+    public:
+        explicit ThreadCachingAllocator(Allocator& backing);
+        ThreadCachingAllocator(ThreadCachingAllocator const&) = delete;
+        ThreadCachingAllocator(ThreadCachingAllocator&&) = delete;
+        ThreadCachingAllocator& operator=(ThreadCachingAllocator const&) = delete;
+        ThreadCachingAllocator& operator=(ThreadCachingAllocator&&) = delete;
+
+        //! All threads which used this allocator must be finished, or must not use it anymore.
+        ~ThreadCachingAllocator() override;
+
+    public: // api v0
+        Allocation Allocate(Layout const& layout) override;
+        void Deallocate(Allocation const& allocation) override;
+        Allocation Reallocate(Allocation const& allocation, Layout const& layout) override;
+
+    public:
+        ThreadCachingAllocatorStatistics GetStatistics();
+
+        //! Returns memory freed remotely to slabs of calling thread heap.
+        void CollectRemoteFrees();
+
+    private:
+        static ThreadState& GetThreadState();
+
+        //! Gets heap of calling thread without creating one.
+        Heap* FindThreadHeap() const;
+
+        //! Gets heap of calling thread, adopting abandoned or creating new one when needed.
+        Heap* AcquireThreadHeap();
+
+        Heap* AttachThreadHeap();
+
+        //! Detaches heap from its thread. Must be called with m_Lock held.
+        void AbandonHeap(Heap* heap);
+
+        void* AllocateSmall(Heap& heap, size_t sizeClass);
+
+        static void CollectRemoteFrees(Heap& heap);
+
+        void DeallocateSmall(void* pointer);
+
+        Allocation AllocateLarge(Layout const& layout);
+
+        void DeallocateLarge(Allocation const& allocation);
+    };
+}
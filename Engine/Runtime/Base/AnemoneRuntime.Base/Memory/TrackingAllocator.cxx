@@ -0,0 +1,77 @@
+#include "AnemoneRuntime.Base/Memory/TrackingAllocator.hxx"
+#include "AnemoneRuntime.Base/Bitwise.hxx"
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace Anemone::Memory
+{
+    Allocation TrackingAllocator::Allocate(Layout const& layout)
+    {
+        size_t const alignment = std::max(layout.Alignment, alignof(Prefix));
+        size_t const offset = AlignUp(sizeof(Prefix), alignment);
+
+        Allocation const block = this->m_Inner.Allocate(Layout{
+            .Size = offset + layout.Size,
+            .Alignment = alignment,
+        });
+
+        if (block.Address == nullptr)
+        {
+            return block;
+        }
+
+        MemoryTag const tag = this->m_Scoped ? MemoryTracking::GetCurrentTag() : this->m_Tag;
+
+        std::byte* const address = static_cast<std::byte*>(block.Address) + offset;
+        new (address - sizeof(Prefix)) Prefix{
+            .Size = block.Size,
+            .Offset = static_cast<uint32_t>(offset),
+            .Tag = tag,
+        };
+
+        MemoryTracking::TrackAllocation(tag, block.Size);
+
+        return Allocation{
+            .Address = address,
+            .Size = block.Size - offset,
+        };
+    }
+
+    void TrackingAllocator::Deallocate(Allocation const& allocation)
+    {
+        if (allocation.Address == nullptr)
+        {
+            return;
+        }
+
+        std::byte* const address = static_cast<std::byte*>(allocation.Address);
+        Prefix const prefix = *std::launder(reinterpret_cast<Prefix const*>(address - sizeof(Prefix)));
+
+        MemoryTracking::TrackDeallocation(prefix.Tag, prefix.Size);
+
+        this->m_Inner.Deallocate(Allocation{
+            .Address = address - prefix.Offset,
+            .Size = prefix.Size,
+        });
+    }
+
+    Allocation TrackingAllocator::Reallocate(Allocation const& allocation, Layout const& layout)
+    {
+        // Prefix offset depends on alignment, so block is always moved.
+        Allocation const result = this->Allocate(layout);
+
+        if ((result.Address != nullptr) and (allocation.Address != nullptr))
+        {
+            std::byte* const address = static_cast<std::byte*>(allocation.Address);
+            Prefix const prefix = *std::launder(reinterpret_cast<Prefix const*>(address - sizeof(Prefix)));
+
+            std::memcpy(result.Address, allocation.Address, std::min(prefix.Size - prefix.Offset, layout.Size));
+            this->Deallocate(allocation);
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+#include "AnemoneRuntime.Base/Memory/Allocator.hxx"
+#include "AnemoneRuntime.Base/Memory/MemoryTracking.hxx"
+
+namespace Anemone::Memory
+{
+    //! Allocator which accounts allocations of inner allocator to memory tag.
+    //!
+    //! Tag is either fixed at construction, or taken from MemoryTagScope active when allocation is made. Small
+    //! prefix in front of every allocation records its tag and size of block received from inner allocator, so
+    //! deallocation subtracts exactly what was accounted, regardless of size passed by caller.
+    class ANEMONE_RUNTIME_BASE_API TrackingAllocator final : public Allocator
+    {
+    private:
+        struct Prefix final
+        {
+            size_t Size;
+            uint32_t Offset;
+            MemoryTag Tag;
+        };
+
+        Allocator& m_Inner;
+        MemoryTag m_Tag{};
+        bool m_Scoped{};
+
+    public:
+        //! Accounts allocations to tag of current MemoryTagScope.
+        explicit TrackingAllocator(Allocator& inner)
+            : m_Inner{inner}
+            , m_Scoped{true}
+        {
+        }
+
+        //! Accounts all allocations to given tag.
+        TrackingAllocator(Allocator& inner, MemoryTag tag)
+            : m_Inner{inner}
+            , m_Tag{tag}
+        {
+        }
+
+        TrackingAllocator(TrackingAllocator const&) = delete;
+        TrackingAllocator(TrackingAllocator&&) = delete;
+        TrackingAllocator& operator=(TrackingAllocator const&) = delete;
+        TrackingAllocator& operator=(TrackingAllocator&&) = delete;
+        ~TrackingAllocator() override = default;
+
+    public: // api v0
+        Allocation Allocate(Layout const& layout) override;
+        void Deallocate(Allocation const& allocation) override;
+        Allocation Reallocate(Allocation const& allocation, Layout const& layout) override;
+    };
+}
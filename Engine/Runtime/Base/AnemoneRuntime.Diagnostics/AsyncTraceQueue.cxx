@@ -0,0 +1,487 @@
+#include "AnemoneRuntime.Diagnostics/AsyncTraceQueue.hxx"
+#include "AnemoneRuntime.Diagnostics/TraceDispatcher.hxx"
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
+#include "AnemoneRuntime.Base/Bitwise.hxx"
+#include "AnemoneRuntime.Threading/CurrentThread.hxx"
+#include "AnemoneRuntime.Threading/Lock.hxx"
+#include "AnemoneRuntime.Threading/Runnable.hxx"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iterator>
+
+namespace Anemone
+{
+    namespace
+    {
+        enum class RecordKind : uint8_t
+        {
+            //! Formatted message, followed by null terminator.
+            Text,
+
+            //! Pointer to trace site, followed by argument payload.
+            Deferred,
+        };
+
+        struct RecordHeader final
+        {
+            //! Length of message or payload.
+            uint32_t Size;
+            TraceLevel Level;
+            RecordKind Kind;
+            uint8_t Reserved[2];
+        };
+
+        static_assert(sizeof(RecordHeader) == 8);
+
+        //! Header size value of record which skips remaining space at end of ring buffer.
+        constexpr uint32_t WrapMarker = UINT32_MAX;
+
+        constexpr size_t RecordAlignment = alignof(uint64_t);
+
+        constexpr size_t MinRingCapacity = 4u << 10u;
+
+        constexpr size_t GetRecordSize(RecordKind kind, size_t size)
+        {
+            // Messages are stored with null terminator, as listeners may pass them to C APIs.
+            size_t const extra = (kind == RecordKind::Text) ? 1 : sizeof(TraceSite const*);
+            return AlignUp<size_t>(sizeof(RecordHeader) + size + extra, RecordAlignment);
+        }
+
+        std::atomic_uint64_t gNextQueueGeneration{1};
+
+        // Set on sink threads; their trace calls are delivered synchronously.
+        thread_local bool tlsIsTraceSink{};
+    }
+
+    //! Single producer, single consumer ring of variable sized trace records.
+    class AsyncTraceRing final : public ThreadsafeReferenceCounted<AsyncTraceRing>
+    {
+    public:
+        //! Generation of queue which owns this ring.
+        uint64_t const Generation;
+        size_t const Capacity;
+        size_t const MaxMessageSize;
+        std::unique_ptr<std::byte[]> const Buffer;
+
+        //! Set by thread local state of producer on thread exit.
+        std::atomic_bool Abandoned{};
+
+        //! Set when owning queue is destroyed.
+        std::atomic_bool Detached{};
+
+        alignas(ANEMONE_CACHELINE_SIZE) std::atomic_uint64_t Head{};
+        uint64_t CachedTail{};
+        uint32_t SampleCounter{};
+
+        alignas(ANEMONE_CACHELINE_SIZE) std::atomic_uint64_t Tail{};
+
+    public:
+        AsyncTraceRing(uint64_t generation, size_t capacity)
+            : Generation{generation}
+            , Capacity{capacity}
+            , MaxMessageSize{(capacity / 4) - sizeof(RecordHeader) - sizeof(TraceSite const*)}
+            , Buffer{std::make_unique<std::byte[]>(capacity)}
+        {
+            AE_ASSERT(std::has_single_bit(capacity));
+        }
+
+        bool IsEmpty() const
+        {
+            return this->Tail.load(std::memory_order::relaxed) == this->Head.load(std::memory_order::acquire);
+        }
+    };
+
+    namespace
+    {
+        struct AsyncTraceThreadState final
+        {
+            //! Last used ring, cached by queue generation.
+            uint64_t Generation{};
+            AsyncTraceRing* Current{};
+
+            //! Rings of calling thread, one per queue.
+            std::vector<Reference<AsyncTraceRing>> Rings{};
+
+            ~AsyncTraceThreadState();
+        };
+
+        // Set when thread local state of current thread was destroyed; trace calls fall back to synchronous path.
+        thread_local bool tlsAsyncTraceStateDestroyed{};
+
+        thread_local AsyncTraceThreadState tlsAsyncTraceState{};
+
+        AsyncTraceThreadState::~AsyncTraceThreadState()
+        {
+            tlsAsyncTraceStateDestroyed = true;
+
+            // Sink releases rings once it delivered their remaining records.
+            for (Reference<AsyncTraceRing> const& ring : this->Rings)
+            {
+                ring->Abandoned.store(true, std::memory_order::release);
+            }
+        }
+    }
+
+    AsyncTraceQueue::AsyncTraceQueue(TraceDispatcher& dispatcher, AsyncTraceOptions const& options)
+        : m_Dispatcher{dispatcher}
+        , m_Options{options}
+        , m_Generation{gNextQueueGeneration.fetch_add(1, std::memory_order::relaxed)}
+    {
+        this->m_Options.RingCapacity = std::bit_ceil(std::max(this->m_Options.RingCapacity, MinRingCapacity));
+        this->m_Options.SampleRate = std::max<uint32_t>(this->m_Options.SampleRate, 1);
+
+        this->m_Running.store(true, std::memory_order::release);
+
+        this->m_Thread = Thread::Start(
+            ThreadStart{
+                .Name = "TraceSink",
+                .Priority = ThreadPriority::Normal,
+                .Callback = MakeRunnable([this]
+                {
+                    this->ThreadEntryPoint();
+                }),
+            });
+    }
+
+    AsyncTraceQueue::~AsyncTraceQueue()
+    {
+        this->Stop();
+
+        // Producers may still hold rings of this queue; they prune them on next miss.
+        for (Reference<AsyncTraceRing> const& ring : this->m_Rings)
+        {
+            ring->Detached.store(true, std::memory_order::release);
+        }
+
+        for (Reference<AsyncTraceRing> const& ring : this->m_Registered)
+        {
+            ring->Detached.store(true, std::memory_order::release);
+        }
+    }
+
+    bool AsyncTraceQueue::Enqueue(TraceLevel level, const char* message, size_t size)
+    {
+        return this->Publish(level, nullptr, std::as_bytes(std::span{message, size}));
+    }
+
+    bool AsyncTraceQueue::Enqueue(TraceSite const& site, std::span<std::byte const> payload)
+    {
+        return this->Publish(site.Level, &site, payload);
+    }
+
+    bool AsyncTraceQueue::Publish(TraceLevel level, TraceSite const* site, std::span<std::byte const> data)
+    {
+        if (tlsIsTraceSink or not this->m_Running.load(std::memory_order::acquire))
+        {
+            return false;
+        }
+
+        if (level >= TraceLevel::Fatal)
+        {
+            // Fatal records usually precede crash. Deliver everything traced so far, then let caller deliver this
+            // record synchronously.
+            UniqueLock scope{this->m_DrainLock};
+            this->Drain();
+            return false;
+        }
+
+        AsyncTraceRing* const ring = this->GetCurrentRing();
+
+        if (ring == nullptr)
+        {
+            return false;
+        }
+
+        RecordKind const kind = (site != nullptr) ? RecordKind::Deferred : RecordKind::Text;
+
+        if ((kind == RecordKind::Deferred) and (data.size() > ring->MaxMessageSize))
+        {
+            // Payload can't be truncated.
+            return false;
+        }
+
+        size_t const length = std::min(data.size(), ring->MaxMessageSize);
+        size_t const recordSize = GetRecordSize(kind, length);
+
+        uint64_t const head = ring->Head.load(std::memory_order::relaxed);
+        size_t const offset = static_cast<size_t>(head) & (ring->Capacity - 1);
+        size_t const contiguous = ring->Capacity - offset;
+
+        // Record is never split; remaining space at end of buffer is skipped instead.
+        size_t const required = (contiguous < recordSize) ? (contiguous + recordSize) : recordSize;
+
+        size_t const highWatermark = ring->Capacity - (ring->Capacity / 4);
+        bool const sampling = (this->m_Options.OverflowPolicy == TraceOverflowPolicy::Sample) and (level < TraceLevel::Warning);
+
+        size_t used = static_cast<size_t>(head - ring->CachedTail);
+
+        if (((used + required) > ring->Capacity) or (sampling and (used >= highWatermark)))
+        {
+            ring->CachedTail = ring->Tail.load(std::memory_order::acquire);
+            used = static_cast<size_t>(head - ring->CachedTail);
+        }
+
+        if (sampling and (used >= highWatermark))
+        {
+            if ((ring->SampleCounter++ % this->m_Options.SampleRate) != 0)
+            {
+                this->m_Dropped.fetch_add(1, std::memory_order::relaxed);
+                this->Wake();
+                return true;
+            }
+        }
+
+        if ((used + required) > ring->Capacity)
+        {
+            this->Wake();
+
+            if (this->m_Options.OverflowPolicy != TraceOverflowPolicy::Block)
+            {
+                this->m_Dropped.fetch_add(1, std::memory_order::relaxed);
+                return true;
+            }
+
+            do
+            {
+                if (not this->m_Running.load(std::memory_order::acquire))
+                {
+                    // Queue stopped while waiting; it won't drain this ring anymore.
+                    return false;
+                }
+
+                CurrentThread::Yield();
+
+                ring->CachedTail = ring->Tail.load(std::memory_order::acquire);
+                used = static_cast<size_t>(head - ring->CachedTail);
+            } while ((used + required) > ring->Capacity);
+        }
+
+        std::byte* position = ring->Buffer.get() + offset;
+
+        if (contiguous < recordSize)
+        {
+            RecordHeader const marker{.Size = WrapMarker, .Level = level, .Kind = kind, .Reserved = {}};
+            std::memcpy(position, &marker, sizeof(marker));
+            position = ring->Buffer.get();
+        }
+
+        RecordHeader const header{.Size = static_cast<uint32_t>(length), .Level = level, .Kind = kind, .Reserved = {}};
+        std::memcpy(position, &header, sizeof(header));
+        position += sizeof(header);
+
+        if (kind == RecordKind::Text)
+        {
+            std::memcpy(position, data.data(), length);
+            position[length] = std::byte{};
+        }
+        else
+        {
+            std::memcpy(position, &site, sizeof(site));
+            std::memcpy(position + sizeof(site), data.data(), length);
+        }
+
+        ring->Head.store(head + required, std::memory_order::release);
+
+        if ((used + required) >= (ring->Capacity / 2))
+        {
+            // Sink would otherwise pick records up after drain interval.
+            this->Wake();
+        }
+
+        return true;
+    }
+
+    void AsyncTraceQueue::Flush()
+    {
+        if (not tlsIsTraceSink)
+        {
+            UniqueLock scope{this->m_DrainLock};
+            this->Drain();
+        }
+
+        this->m_Dispatcher.FlushListeners();
+    }
+
+    void AsyncTraceQueue::Stop()
+    {
+        if (not this->m_Running.exchange(false, std::memory_order::acq_rel))
+        {
+            return;
+        }
+
+        this->m_Wake.Release();
+        this->m_Thread->Join();
+        this->m_Thread = {};
+
+        // Pick up records published while sink was exiting.
+        {
+            UniqueLock scope{this->m_DrainLock};
+            this->Drain();
+        }
+
+        this->m_Dispatcher.FlushListeners();
+    }
+
+    AsyncTraceRing* AsyncTraceQueue::GetCurrentRing()
+    {
+        if (tlsAsyncTraceStateDestroyed)
+        {
+            return nullptr;
+        }
+
+        AsyncTraceThreadState& state = tlsAsyncTraceState;
+
+        if (state.Generation == this->m_Generation)
+            [[likely]]
+        {
+            return state.Current;
+        }
+
+        std::erase_if(state.Rings, [](Reference<AsyncTraceRing> const& ring)
+        {
+            return ring->Detached.load(std::memory_order::acquire);
+        });
+
+        auto const it = std::find_if(state.Rings.begin(), state.Rings.end(), [&](Reference<AsyncTraceRing> const& ring)
+        {
+            return ring->Generation == this->m_Generation;
+        });
+
+        AsyncTraceRing* ring{};
+
+        if (it != state.Rings.end())
+        {
+            ring = it->Get();
+        }
+        else
+        {
+            Reference<AsyncTraceRing> created = MakeReference<AsyncTraceRing>(this->m_Generation, this->m_Options.RingCapacity);
+            ring = created.Get();
+
+            {
+                UniqueLock scope{this->m_RegisterLock};
+                this->m_Registered.push_back(created);
+            }
+
+            state.Rings.push_back(std::move(created));
+        }
+
+        state.Generation = this->m_Generation;
+        state.Current = ring;
+        return ring;
+    }
+
+    void AsyncTraceQueue::Wake()
+    {
+        if (not this->m_WakeRequested.load(std::memory_order::relaxed) and not this->m_WakeRequested.exchange(true, std::memory_order::acq_rel))
+        {
+            this->m_Wake.Release();
+        }
+    }
+
+    void AsyncTraceQueue::ThreadEntryPoint()
+    {
+        tlsIsTraceSink = true;
+
+        while (true)
+        {
+            (void)this->m_Wake.TryAcquire(this->m_Options.DrainInterval);
+
+            // Producers may request another wake up while this batch is drained.
+            this->m_WakeRequested.store(false, std::memory_order::release);
+
+            bool const stopping = not this->m_Running.load(std::memory_order::acquire);
+
+            {
+                UniqueLock scope{this->m_DrainLock};
+                this->Drain();
+            }
+
+            if (stopping)
+            {
+                break;
+            }
+        }
+    }
+
+    size_t AsyncTraceQueue::Drain()
+    {
+        {
+            UniqueLock scope{this->m_RegisterLock};
+
+            for (Reference<AsyncTraceRing>& ring : this->m_Registered)
+            {
+                this->m_Rings.push_back(std::move(ring));
+            }
+
+            this->m_Registered.clear();
+        }
+
+        size_t count = 0;
+
+        for (Reference<AsyncTraceRing> const& ring : this->m_Rings)
+        {
+            std::byte const* const buffer = ring->Buffer.get();
+            size_t const mask = ring->Capacity - 1;
+
+            uint64_t tail = ring->Tail.load(std::memory_order::relaxed);
+            uint64_t const head = ring->Head.load(std::memory_order::acquire);
+
+            while (tail != head)
+            {
+                size_t const offset = static_cast<size_t>(tail) & mask;
+
+                RecordHeader header;
+                std::memcpy(&header, buffer + offset, sizeof(header));
+
+                if (header.Size == WrapMarker)
+                {
+                    tail += ring->Capacity - offset;
+                    continue;
+                }
+
+                std::byte const* const body = buffer + offset + sizeof(header);
+
+                if (header.Kind == RecordKind::Text)
+                {
+                    this->m_Dispatcher.Dispatch(header.Level, reinterpret_cast<const char*>(body), header.Size);
+                }
+                else
+                {
+                    // Arguments are formatted here, by listeners which need text.
+                    TraceSite const* site;
+                    std::memcpy(&site, body, sizeof(site));
+                    this->m_Dispatcher.DispatchRecord(*site, std::span{body + sizeof(site), header.Size});
+                }
+
+                tail += GetRecordSize(header.Kind, header.Size);
+                ++count;
+            }
+
+            ring->Tail.store(tail, std::memory_order::release);
+        }
+
+        // Abandoned flag is published after last record of exited thread.
+        std::erase_if(this->m_Rings, [](Reference<AsyncTraceRing> const& ring)
+        {
+            return ring->Abandoned.load(std::memory_order::acquire) and ring->IsEmpty();
+        });
+
+        uint64_t const dropped = this->m_Dropped.load(std::memory_order::relaxed);
+
+        if (dropped != this->m_DroppedReported)
+        {
+            fmt::memory_buffer buffer{};
+            fmt::format_to(std::back_inserter(buffer), "[W] trace: dropped {} records", dropped - this->m_DroppedReported);
+            size_t const size = buffer.size();
+            buffer.push_back('\0');
+
+            this->m_DroppedReported = dropped;
+            this->m_Dispatcher.Dispatch(TraceLevel::Warning, buffer.data(), size);
+        }
+
+        return count;
+    }
+}
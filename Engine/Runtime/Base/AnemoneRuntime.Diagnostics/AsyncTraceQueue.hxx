@@ -0,0 +1,125 @@
+#pragma once
+#include "AnemoneRuntime.Diagnostics/TraceListener.hxx"
+#include "AnemoneRuntime.Base/Duration.hxx"
+#include "AnemoneRuntime.Base/Reference.hxx"
+#include "AnemoneRuntime.Threading/CriticalSection.hxx"
+#include "AnemoneRuntime.Threading/Semaphore.hxx"
+#include "AnemoneRuntime.Threading/Spinlock.hxx"
+#include "AnemoneRuntime.Threading/Thread.hxx"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace Anemone
+{
+    class TraceDispatcher;
+    class AsyncTraceRing;
+
+    //! Behavior of producer when its ring buffer has no space left for record.
+    enum class TraceOverflowPolicy : uint8_t
+    {
+        //! Record is discarded and counted as dropped.
+        Drop,
+
+        //! Producer waits until sink thread frees space in ring buffer.
+        Block,
+
+        //! Above high watermark only every N-th record below warning level is kept. Records which still don't fit
+        //! are dropped.
+        Sample,
+    };
+
+    struct AsyncTraceOptions final
+    {
+        //! Size of ring buffer of each producing thread, in bytes. Rounded up to power of two.
+        size_t RingCapacity{64u << 10u};
+
+        TraceOverflowPolicy OverflowPolicy{TraceOverflowPolicy::Drop};
+
+        //! Used with sample policy; keeps one of that many records once ring buffer is three quarters full.
+        uint32_t SampleRate{16};
+
+        //! Maximum time records wait in ring buffer before sink thread picks them up.
+        Duration DrainInterval{Duration::FromMilliseconds(10)};
+    };
+
+    //! Moves trace records from producing threads to listeners of dispatcher on dedicated sink thread.
+    //!
+    //! Each producing thread writes records into its own single-producer ring buffer, without taking any
+    //! locks. Sink thread drains ring buffers in batches. Records of single thread are delivered in order; records
+    //! of different threads are not ordered relative to each other.
+    class ANEMONE_RUNTIME_BASE_API AsyncTraceQueue final
+    {
+    private:
+        TraceDispatcher& m_Dispatcher;
+        AsyncTraceOptions m_Options{};
+        uint64_t m_Generation{};
+
+        //! Rings drained by sink, guarded by drain lock.
+        std::vector<Reference<AsyncTraceRing>> m_Rings{};
+
+        //! Serializes sink thread and flush barriers.
+        CriticalSection m_DrainLock{};
+
+        //! Rings created by producers since last drain.
+        Spinlock m_RegisterLock{};
+        std::vector<Reference<AsyncTraceRing>> m_Registered{};
+
+        Semaphore m_Wake{0};
+        std::atomic_bool m_WakeRequested{};
+        std::atomic_bool m_Running{};
+        Reference<Thread> m_Thread{};
+
+        std::atomic_uint64_t m_Dropped{};
+        uint64_t m_DroppedReported{};
+
+    public:
+        AsyncTraceQueue(TraceDispatcher& dispatcher, AsyncTraceOptions const& options);
+        AsyncTraceQueue(AsyncTraceQueue const&) = delete;
+        AsyncTraceQueue(AsyncTraceQueue&&) = delete;
+        AsyncTraceQueue& operator=(AsyncTraceQueue const&) = delete;
+        AsyncTraceQueue& operator=(AsyncTraceQueue&&) = delete;
+        ~AsyncTraceQueue();
+
+    public:
+        //! Copies record into ring buffer of calling thread. Returns false when queue was stopped and record must
+        //! be delivered synchronously.
+        bool Enqueue(TraceLevel level, const char* message, size_t size);
+
+        //! Copies record with deferred formatting into ring buffer of calling thread. Trace site must have static
+        //! storage duration.
+        bool Enqueue(TraceSite const& site, std::span<std::byte const> payload);
+
+        //! Delivers every record enqueued before call to listeners, then flushes them. Runs on calling thread, so
+        //! it may be used on crash paths.
+        void Flush();
+
+        //! Stops sink thread after draining all pending records.
+        void Stop();
+
+        //! Number of records discarded by overflow policy.
+        uint64_t GetDroppedCount() const
+        {
+            return this->m_Dropped.load(std::memory_order::relaxed);
+        }
+
+        AsyncTraceOptions const& GetOptions() const
+        {
+            return this->m_Options;
+        }
+
+    private:
+        bool Publish(TraceLevel level, TraceSite const* site, std::span<std::byte const> data);
+
+        //! Returns null when thread local state of calling thread was already destroyed.
+        AsyncTraceRing* GetCurrentRing();
+
+        void Wake();
+
+        void ThreadEntryPoint();
+
+        //! Delivers pending records of all rings. Requires drain lock.
+        size_t Drain();
+    };
+}
@@ -0,0 +1,175 @@
+#include "AnemoneRuntime.Diagnostics/BinaryTraceFormat.hxx"
+
+#include <cstring>
+#include <iterator>
+
+namespace Anemone
+{
+    namespace
+    {
+        template <typename T>
+        bool ReadRecord(std::span<std::byte const>& source, T& value)
+        {
+            if (source.size() < sizeof(T))
+            {
+                return false;
+            }
+
+            std::memcpy(&value, source.data(), sizeof(T));
+            source = source.subspan(sizeof(T));
+            return true;
+        }
+
+        bool ReadBytes(std::span<std::byte const>& source, size_t size, std::span<std::byte const>& value)
+        {
+            if (source.size() < size)
+            {
+                return false;
+            }
+
+            value = source.first(size);
+            source = source.subspan(size);
+            return true;
+        }
+
+        std::string_view AsString(std::span<std::byte const> value)
+        {
+            return std::string_view{reinterpret_cast<char const*>(value.data()), value.size()};
+        }
+    }
+
+    BinaryTraceReader::BinaryTraceReader(std::span<std::byte const> records)
+        : m_Remaining{records}
+    {
+    }
+
+    std::expected<BinaryTraceReader, Error> BinaryTraceReader::Open(std::span<std::byte const> log)
+    {
+        BinaryTraceHeader header{};
+
+        if (not ReadRecord(log, header) or (header.Magic != BinaryTraceMagic))
+        {
+            return std::unexpected(Error::InvalidHeader);
+        }
+
+        if (header.Version != BinaryTraceVersion)
+        {
+            return std::unexpected(Error::NotSupported);
+        }
+
+        return BinaryTraceReader{log};
+    }
+
+    std::expected<bool, Error> BinaryTraceReader::Next(BinaryTraceEvent& event)
+    {
+        while (not this->m_Remaining.empty())
+        {
+            switch (static_cast<BinaryTraceRecordKind>(this->m_Remaining.front()))
+            {
+            case BinaryTraceRecordKind::Site:
+                {
+                    BinaryTraceSiteRecord record{};
+                    std::span<std::byte const> arguments{};
+                    std::span<std::byte const> format{};
+                    std::span<std::byte const> file{};
+
+                    if (not ReadRecord(this->m_Remaining, record) or
+                        not ReadBytes(this->m_Remaining, record.ArgumentCount, arguments) or
+                        not ReadBytes(this->m_Remaining, record.FormatLength, format) or
+                        not ReadBytes(this->m_Remaining, record.FileLength, file))
+                    {
+                        return std::unexpected(Error::InvalidData);
+                    }
+
+                    SiteEntry entry{};
+                    entry.Arguments.reserve(arguments.size());
+
+                    for (std::byte const type : arguments)
+                    {
+                        if (static_cast<TraceArgumentType>(type) > TraceArgumentType::String)
+                        {
+                            return std::unexpected(Error::InvalidData);
+                        }
+
+                        entry.Arguments.push_back(static_cast<TraceArgumentType>(type));
+                    }
+
+                    auto [it, inserted] = this->m_Sites.insert_or_assign(record.Id, std::move(entry));
+
+                    // Node and argument storage are stable, so events may keep pointer to site.
+                    it->second.Site = TraceSite{
+                        .Id = record.Id,
+                        .Level = record.Level,
+                        .Format = AsString(format),
+                        .File = AsString(file),
+                        .Line = record.Line,
+                        .Arguments = it->second.Arguments,
+                    };
+
+                    (void)inserted;
+                    break;
+                }
+
+            case BinaryTraceRecordKind::Event:
+                {
+                    BinaryTraceEventRecord record{};
+
+                    if (not ReadRecord(this->m_Remaining, record) or not ReadBytes(this->m_Remaining, record.PayloadSize, event.Data))
+                    {
+                        return std::unexpected(Error::InvalidData);
+                    }
+
+                    auto const it = this->m_Sites.find(record.SiteId);
+
+                    if (it == this->m_Sites.end())
+                    {
+                        return std::unexpected(Error::InvalidData);
+                    }
+
+                    event.Site = &it->second.Site;
+                    event.Level = it->second.Site.Level;
+                    event.Timestamp = Duration::FromNanoseconds(record.Timestamp);
+                    return true;
+                }
+
+            case BinaryTraceRecordKind::Text:
+                {
+                    BinaryTraceTextRecord record{};
+
+                    if (not ReadRecord(this->m_Remaining, record) or not ReadBytes(this->m_Remaining, record.Size, event.Data))
+                    {
+                        return std::unexpected(Error::InvalidData);
+                    }
+
+                    event.Site = nullptr;
+                    event.Level = record.Level;
+                    event.Timestamp = Duration::FromNanoseconds(record.Timestamp);
+                    return true;
+                }
+
+            default:
+                return std::unexpected(Error::InvalidData);
+            }
+        }
+
+        return false;
+    }
+
+    bool BinaryTraceReader::Format(fmt::memory_buffer& buffer, BinaryTraceEvent const& event)
+    {
+        if (event.Site == nullptr)
+        {
+            // Text events were formatted by producer already.
+            buffer.append(AsString(event.Data));
+            return true;
+        }
+
+        auto out = std::back_inserter(buffer);
+        (*out++) = '[';
+        (*out++) = GetTraceLevelMark(event.Level);
+        (*out++) = ']';
+        (*out++) = ' ';
+
+        return FormatTraceArguments(buffer, event.Site->Format, event.Site->Arguments, event.Data);
+    }
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include "AnemoneRuntime.Diagnostics/TraceListener.hxx"
+#include "AnemoneRuntime.Diagnostics/Error.hxx"
+#include "AnemoneRuntime.Base/Duration.hxx"
+
+#include <expected>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Binary trace log layout:
+//
+// - BinaryTraceHeader
+// - sequence of records, each starting with BinaryTraceRecordKind:
+//   - site definition: BinaryTraceSiteRecord, argument types, format string, file name
+//   - deferred event:  BinaryTraceEventRecord, argument payload
+//   - text event:      BinaryTraceTextRecord, formatted message
+//
+// Site is defined before its first event, so log can be decoded without binary which produced it. All values are
+// little endian; records are not aligned.
+
+namespace Anemone
+{
+    inline constexpr uint32_t BinaryTraceMagic = 0x52544541u; // 'AETR'
+
+    inline constexpr uint32_t BinaryTraceVersion = 1;
+
+    enum class BinaryTraceRecordKind : uint8_t
+    {
+        Site = 1,
+        Event = 2,
+        Text = 3,
+    };
+
+    struct BinaryTraceHeader final
+    {
+        uint32_t Magic;
+        uint32_t Version;
+    };
+
+    static_assert(sizeof(BinaryTraceHeader) == 8);
+
+    struct BinaryTraceSiteRecord final
+    {
+        BinaryTraceRecordKind Kind;
+        TraceLevel Level;
+        uint16_t ArgumentCount;
+        uint32_t Line;
+        uint64_t Id;
+        uint32_t FormatLength;
+        uint32_t FileLength;
+    };
+
+    static_assert(sizeof(BinaryTraceSiteRecord) == 24);
+
+    struct BinaryTraceEventRecord final
+    {
+        BinaryTraceRecordKind Kind;
+        uint8_t Reserved[3];
+        uint32_t PayloadSize;
+        uint64_t SiteId;
+
+        //! Time since log was started, in nanoseconds.
+        int64_t Timestamp;
+    };
+
+    static_assert(sizeof(BinaryTraceEventRecord) == 24);
+
+    struct BinaryTraceTextRecord final
+    {
+        BinaryTraceRecordKind Kind;
+        TraceLevel Level;
+        uint8_t Reserved[2];
+        uint32_t Size;
+
+        //! Time since log was started, in nanoseconds.
+        int64_t Timestamp;
+    };
+
+    static_assert(sizeof(BinaryTraceTextRecord) == 16);
+
+    //! Event read from binary trace log.
+    struct BinaryTraceEvent final
+    {
+        TraceLevel Level{};
+        Duration Timestamp{};
+
+        //! Site of deferred event; null for text events.
+        TraceSite const* Site{};
+
+        //! Argument payload of deferred event, or formatted message of text event.
+        std::span<std::byte const> Data{};
+    };
+
+    //! Reads events from binary trace log held in memory.
+    class ANEMONE_RUNTIME_BASE_API BinaryTraceReader final
+    {
+    private:
+        struct SiteEntry final
+        {
+            TraceSite Site;
+            std::vector<TraceArgumentType> Arguments;
+        };
+
+        std::span<std::byte const> m_Remaining{};
+        std::unordered_map<uint64_t, SiteEntry> m_Sites{};
+
+    private:
+        explicit BinaryTraceReader(std::span<std::byte const> records);
+
+    public:
+        //! Log must outlive reader and events returned by it.
+        static std::expected<BinaryTraceReader, Error> Open(std::span<std::byte const> log);
+
+        //! Reads next event. Returns false at end of log. Returns InvalidData when log is truncated or corrupted.
+        std::expected<bool, Error> Next(BinaryTraceEvent& event);
+
+        //! Formats event the same way as text listeners do, without trailing newline.
+        static bool Format(fmt::memory_buffer& buffer, BinaryTraceEvent const& event);
+    };
+}
@@ -0,0 +1,127 @@
+#include "AnemoneRuntime.Diagnostics/BinaryTraceListener.hxx"
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
+#include "AnemoneRuntime.Threading/Lock.hxx"
+
+namespace Anemone
+{
+    BinaryTraceListener::BinaryTraceListener(Reference<OutputStream> stream)
+        : m_Stream{std::move(stream)}
+        , m_Started{Instant::Now()}
+    {
+        AE_ASSERT(this->m_Stream, "OutputStream is null");
+
+        BinaryTraceHeader const header{
+            .Magic = BinaryTraceMagic,
+            .Version = BinaryTraceVersion,
+        };
+
+        this->Append(&header, sizeof(header));
+        this->Commit();
+    }
+
+    void BinaryTraceListener::TraceEvent(TraceLevel level, const char* message, size_t size)
+    {
+        UniqueLock scope{this->m_Lock};
+
+        if (this->m_Failed)
+        {
+            return;
+        }
+
+        BinaryTraceTextRecord const record{
+            .Kind = BinaryTraceRecordKind::Text,
+            .Level = level,
+            .Reserved = {},
+            .Size = static_cast<uint32_t>(size),
+            .Timestamp = this->m_Started.QueryElapsed().ToNanoseconds(),
+        };
+
+        this->Append(&record, sizeof(record));
+        this->Append(message, size);
+        this->Commit();
+    }
+
+    void BinaryTraceListener::TraceRecord(TraceSite const& site, std::span<std::byte const> payload)
+    {
+        UniqueLock scope{this->m_Lock};
+
+        if (this->m_Failed)
+        {
+            return;
+        }
+
+        BinaryTraceEventRecord const record{
+            .Kind = BinaryTraceRecordKind::Event,
+            .Reserved = {},
+            .PayloadSize = static_cast<uint32_t>(payload.size()),
+            .SiteId = site.Id,
+            .Timestamp = this->m_Started.QueryElapsed().ToNanoseconds(),
+        };
+
+        if (this->m_Sites.insert(site.Id).second)
+        {
+            // Site is defined once, before its first event.
+            BinaryTraceSiteRecord const definition{
+                .Kind = BinaryTraceRecordKind::Site,
+                .Level = site.Level,
+                .ArgumentCount = static_cast<uint16_t>(site.Arguments.size()),
+                .Line = site.Line,
+                .Id = site.Id,
+                .FormatLength = static_cast<uint32_t>(site.Format.size()),
+                .FileLength = static_cast<uint32_t>(site.File.size()),
+            };
+
+            this->Append(&definition, sizeof(definition));
+            this->Append(site.Arguments.data(), site.Arguments.size_bytes());
+            this->Append(site.Format.data(), site.Format.size());
+            this->Append(site.File.data(), site.File.size());
+        }
+
+        this->Append(&record, sizeof(record));
+        this->Append(payload.data(), payload.size());
+        this->Commit();
+    }
+
+    void BinaryTraceListener::Flush()
+    {
+        UniqueLock scope{this->m_Lock};
+
+        if (not this->m_Failed)
+        {
+            (void)this->m_Stream->Flush();
+        }
+    }
+
+    bool BinaryTraceListener::HasFailed()
+    {
+        UniqueLock scope{this->m_Lock};
+        return this->m_Failed;
+    }
+
+    void BinaryTraceListener::Append(void const* data, size_t size)
+    {
+        std::byte const* const bytes = static_cast<std::byte const*>(data);
+        this->m_Buffer.insert(this->m_Buffer.end(), bytes, bytes + size);
+    }
+
+    void BinaryTraceListener::Commit()
+    {
+        std::span<std::byte const> remaining{this->m_Buffer};
+
+        while (not remaining.empty())
+        {
+            auto const written = this->m_Stream->Write(remaining);
+
+            if (not written or (*written == 0))
+            {
+                // Partially written record can't be skipped by decoder; stop recording.
+                this->m_Failed = true;
+                break;
+            }
+
+            remaining = remaining.subspan(*written);
+        }
+
+        this->m_Buffer.clear();
+    }
+}
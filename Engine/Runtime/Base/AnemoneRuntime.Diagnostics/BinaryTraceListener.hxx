@@ -0,0 +1,49 @@
+#pragma once
+#include "AnemoneRuntime.Diagnostics/BinaryTraceFormat.hxx"
+#include "AnemoneRuntime.Base/Instant.hxx"
+#include "AnemoneRuntime.Storage/OutputStream.hxx"
+#include "AnemoneRuntime.Threading/CriticalSection.hxx"
+
+#include <unordered_set>
+#include <vector>
+
+namespace Anemone
+{
+    //! Writes trace records to stream in binary trace log format. Deferred records are stored unformatted; logs are
+    //! turned into text offline by trace decoder tool.
+    class ANEMONE_RUNTIME_BASE_API BinaryTraceListener final : public TraceListener
+    {
+    private:
+        CriticalSection m_Lock{};
+        Reference<OutputStream> m_Stream{};
+        Instant m_Started{};
+
+        //! Sites already defined in log.
+        std::unordered_set<uint64_t> m_Sites{};
+
+        //! Staging buffer, so every record is written to stream at once.
+        std::vector<std::byte> m_Buffer{};
+
+        //! Set when writing to stream failed; log would be corrupted by following records, so they are dropped.
+        bool m_Failed{};
+
+    public:
+        explicit BinaryTraceListener(Reference<OutputStream> stream);
+
+    public:
+        void TraceEvent(TraceLevel level, const char* message, size_t size) override;
+
+        void TraceRecord(TraceSite const& site, std::span<std::byte const> payload) override;
+
+        void Flush() override;
+
+        //! Checks whether writing to stream failed and listener stopped recording.
+        bool HasFailed();
+
+    private:
+        void Append(void const* data, size_t size);
+
+        //! Writes staged record to stream. Records in log are ordered by timestamp, as both are done under lock.
+        void Commit();
+    };
+}
@@ -9,6 +9,8 @@
 #error Not implemented
 #endif
 
+AE_DEFINE_TRACE_CATEGORY(General, Verbose)
+
 namespace Anemone
 {
     namespace
@@ -1,5 +1,6 @@
 #pragma once
 #include "AnemoneRuntime.Interop/Headers.hxx"
+#include "AnemoneRuntime.Diagnostics/TraceCategory.hxx"
 #include "AnemoneRuntime.Diagnostics/TraceDispatcher.hxx"
 
 namespace Anemone
@@ -15,12 +16,32 @@ namespace Anemone
     };
 }
 
-#define AE_TRACE(level, format, ...) \
+AE_DECLARE_TRACE_CATEGORY(General, Verbose, ANEMONE_RUNTIME_BASE_API)
+
+// Call site is described by local type, so format string, location and argument types are known at compile time
+// and arguments may be formatted later, on sink thread or offline. Arguments are evaluated only when category
+// accepts level.
+#define AE_TRACE_CATEGORY_IMPL(category, level, format, ...) \
     do \
     { \
-        if constexpr (::Anemone::TraceLevel::level >= ::Anemone::TraceLevel::Default) \
+        if constexpr ((::Anemone::TraceLevel::level >= ::Anemone::TraceLevel::Default) and (::Anemone::TraceLevel::level >= ::Anemone::TraceCategories::category##Floor)) \
         { \
-            using namespace std::string_view_literals; \
-            ::Anemone::Trace::Get().Trace##level(format##sv __VA_OPT__(, ) __VA_ARGS__); \
+            if (::Anemone::TraceCategories::category.IsEnabled(::Anemone::TraceLevel::level)) \
+            { \
+                struct AeTraceSite final \
+                { \
+                    static constexpr ::Anemone::TraceLevel Level() { return ::Anemone::TraceLevel::level; } \
+                    static constexpr std::string_view Format() { return format; } \
+                    static constexpr std::string_view File() { return __FILE__; } \
+                    static constexpr uint32_t Line() { return __LINE__; } \
+                }; \
+                ::Anemone::Trace::Get().TraceDeferred<AeTraceSite>(__VA_ARGS__); \
+            } \
         } \
     } while (false)
+
+// Traces message in General category.
+#define AE_TRACE(level, format, ...) AE_TRACE_CATEGORY_IMPL(General, level, format, __VA_ARGS__)
+
+// Traces message in category declared with AE_DECLARE_TRACE_CATEGORY. Message is prefixed with category name.
+#define AE_TRACE_CATEGORY(category, level, format, ...) AE_TRACE_CATEGORY_IMPL(category, level, #category ": " format, __VA_ARGS__)
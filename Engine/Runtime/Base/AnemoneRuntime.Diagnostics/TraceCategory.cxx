@@ -0,0 +1,59 @@
+#include "AnemoneRuntime.Diagnostics/TraceCategory.hxx"
+
+namespace Anemone
+{
+    namespace
+    {
+        constexpr std::string_view TraceLevelNames[]{
+            "Verbose",
+            "Debug",
+            "Information",
+            "Warning",
+            "Error",
+            "Fatal",
+            "None",
+        };
+    }
+
+    std::string_view GetTraceLevelName(TraceLevel level)
+    {
+        size_t const index = static_cast<size_t>(level);
+        return (index < std::size(TraceLevelNames)) ? TraceLevelNames[index] : std::string_view{"Unknown"};
+    }
+
+    std::optional<TraceLevel> ParseTraceLevel(std::string_view value)
+    {
+        for (size_t i = 0; i < std::size(TraceLevelNames); ++i)
+        {
+            if (TraceLevelNames[i] == value)
+            {
+                return static_cast<TraceLevel>(i);
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    TraceCategory::TraceCategory(std::string_view variable, std::string_view name, TraceLevel level)
+        : IConsoleVariable{variable}
+        , m_Name{name}
+        , m_Level{level}
+    {
+    }
+
+    std::string TraceCategory::ToString() const
+    {
+        return std::string{GetTraceLevelName(this->GetLevel())};
+    }
+
+    bool TraceCategory::FromString(std::string_view value)
+    {
+        if (std::optional<TraceLevel> const level = ParseTraceLevel(value))
+        {
+            this->SetLevel(*level);
+            return true;
+        }
+
+        return false;
+    }
+}
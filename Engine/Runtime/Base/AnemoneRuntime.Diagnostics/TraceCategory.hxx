@@ -0,0 +1,72 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+#include "AnemoneRuntime.Diagnostics/TraceListener.hxx"
+#include "AnemoneRuntime.Base/ConsoleVariable.hxx"
+
+#include <atomic>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace Anemone
+{
+    //! Returns name of trace level, as accepted by ParseTraceLevel.
+    ANEMONE_RUNTIME_BASE_API std::string_view GetTraceLevelName(TraceLevel level);
+
+    ANEMONE_RUNTIME_BASE_API std::optional<TraceLevel> ParseTraceLevel(std::string_view value);
+
+    //! Named trace category with level adjustable at runtime. Registered as console variable "Trace.<Name>".
+    //!
+    //! Categories are declared with AE_DECLARE_TRACE_CATEGORY and defined with AE_DEFINE_TRACE_CATEGORY.
+    class ANEMONE_RUNTIME_BASE_API TraceCategory final : public IConsoleVariable
+    {
+    private:
+        std::string_view m_Name{};
+        std::atomic<TraceLevel> m_Level{};
+
+    public:
+        TraceCategory(std::string_view variable, std::string_view name, TraceLevel level);
+
+    public:
+        [[nodiscard]] std::string_view GetName() const
+        {
+            return this->m_Name;
+        }
+
+        [[nodiscard]] TraceLevel GetLevel() const
+        {
+            return this->m_Level.load(std::memory_order::relaxed);
+        }
+
+        void SetLevel(TraceLevel level)
+        {
+            this->m_Level.store(level, std::memory_order::relaxed);
+        }
+
+        [[nodiscard]] bool IsEnabled(TraceLevel level) const
+        {
+            return level >= this->m_Level.load(std::memory_order::relaxed);
+        }
+
+    public:
+        [[nodiscard]] std::string ToString() const override;
+
+        bool FromString(std::string_view value) override;
+    };
+}
+
+// Declares trace category. Levels below `floor` are removed from build, as are levels below TraceLevel::Default;
+// `None` removes whole category. Optional last argument is export specifier of module defining category.
+#define AE_DECLARE_TRACE_CATEGORY(name, floor, ...) \
+    namespace Anemone::TraceCategories \
+    { \
+        extern __VA_ARGS__ ::Anemone::TraceCategory name; \
+        inline constexpr ::Anemone::TraceLevel name##Floor = ::Anemone::TraceLevel::floor; \
+    }
+
+// Defines trace category declared with AE_DECLARE_TRACE_CATEGORY, with initial runtime level.
+#define AE_DEFINE_TRACE_CATEGORY(name, level) \
+    namespace Anemone::TraceCategories \
+    { \
+        ::Anemone::TraceCategory name{"Trace." #name, #name, ::Anemone::TraceLevel::level}; \
+    }
@@ -2,24 +2,47 @@
 
 namespace Anemone
 {
+    TraceDispatcher::~TraceDispatcher()
+    {
+        this->DisableAsync();
+    }
+
     void TraceDispatcher::TraceEvent(TraceLevel level, const char* message, size_t size)
     {
-        SharedLock scope{this->_lock};
+        if (AsyncTraceQueue* const queue = this->_async.load(std::memory_order::acquire))
+        {
+            if (queue->Enqueue(level, message, size))
+            {
+                return;
+            }
+        }
 
-        this->_listeners.ForEach([&](TraceListener& listener)
+        this->Dispatch(level, message, size);
+    }
+
+    void TraceDispatcher::TraceRecord(TraceSite const& site, std::span<std::byte const> payload)
+    {
+        if (AsyncTraceQueue* const queue = this->_async.load(std::memory_order::acquire))
         {
-            listener.TraceEvent(level, message, size);
-        });
+            if (queue->Enqueue(site, payload))
+            {
+                return;
+            }
+        }
+
+        this->DispatchRecord(site, payload);
     }
 
     void TraceDispatcher::Flush()
     {
-        SharedLock scope{this->_lock};
-
-        this->_listeners.ForEach([](TraceListener& listener)
+        if (AsyncTraceQueue* const queue = this->_async.load(std::memory_order::acquire))
         {
-            listener.Flush();
-        });
+            queue->Flush();
+        }
+        else
+        {
+            this->FlushListeners();
+        }
     }
 
     void TraceDispatcher::Register(TraceListener& listener)
@@ -33,4 +56,57 @@ namespace Anemone
         UniqueLock scope{this->_lock};
         this->_listeners.Remove(&listener);
     }
+
+    void TraceDispatcher::EnableAsync(AsyncTraceOptions const& options)
+    {
+        UniqueLock scope{this->_asyncLock};
+
+        if (AsyncTraceQueue* const previous = this->_async.exchange(nullptr, std::memory_order::acq_rel))
+        {
+            previous->Stop();
+        }
+
+        this->_asyncQueues.push_back(std::make_unique<AsyncTraceQueue>(*this, options));
+        this->_async.store(this->_asyncQueues.back().get(), std::memory_order::release);
+    }
+
+    void TraceDispatcher::DisableAsync()
+    {
+        UniqueLock scope{this->_asyncLock};
+
+        if (AsyncTraceQueue* const queue = this->_async.exchange(nullptr, std::memory_order::acq_rel))
+        {
+            queue->Stop();
+        }
+    }
+
+    void TraceDispatcher::Dispatch(TraceLevel level, const char* message, size_t size)
+    {
+        SharedLock scope{this->_lock};
+
+        this->_listeners.ForEach([&](TraceListener& listener)
+        {
+            listener.TraceEvent(level, message, size);
+        });
+    }
+
+    void TraceDispatcher::DispatchRecord(TraceSite const& site, std::span<std::byte const> payload)
+    {
+        SharedLock scope{this->_lock};
+
+        this->_listeners.ForEach([&](TraceListener& listener)
+        {
+            listener.TraceRecord(site, payload);
+        });
+    }
+
+    void TraceDispatcher::FlushListeners()
+    {
+        SharedLock scope{this->_lock};
+
+        this->_listeners.ForEach([](TraceListener& listener)
+        {
+            listener.Flush();
+        });
+    }
 }
@@ -1,21 +1,61 @@
 #pragma once
 #include "AnemoneRuntime.Diagnostics/TraceListener.hxx"
+#include "AnemoneRuntime.Diagnostics/AsyncTraceQueue.hxx"
+
+#include <atomic>
+#include <memory>
+#include <vector>
 
 namespace Anemone
 {
     class ANEMONE_RUNTIME_BASE_API TraceDispatcher : public TraceListener
     {
+        friend class AsyncTraceQueue;
+
     private:
         ReaderWriterLock _lock{};
         IntrusiveList<TraceListener> _listeners{};
 
+        std::atomic<AsyncTraceQueue*> _async{};
+
+        //! Serializes switching between synchronous and asynchronous mode.
+        CriticalSection _asyncLock{};
+
+        //! Stopped queues are kept alive, as producers may still hold pointer to them.
+        std::vector<std::unique_ptr<AsyncTraceQueue>> _asyncQueues{};
+
+    public:
+        TraceDispatcher() = default;
+        ~TraceDispatcher() override;
+
     public:
         void TraceEvent(TraceLevel level, const char* message, size_t size) override;
 
+        void TraceRecord(TraceSite const& site, std::span<std::byte const> payload) override;
+
+        //! Delivers pending asynchronous records before flushing listeners.
         void Flush() override;
 
         void Register(TraceListener& listener);
 
         void Unregister(TraceListener& listener);
+
+        //! Delivers records to listeners on dedicated sink thread instead of calling thread.
+        void EnableAsync(AsyncTraceOptions const& options = {});
+
+        //! Drains pending records and switches back to synchronous delivery.
+        void DisableAsync();
+
+        AsyncTraceQueue* GetAsyncQueue() const
+        {
+            return this->_async.load(std::memory_order::acquire);
+        }
+
+    private:
+        void Dispatch(TraceLevel level, const char* message, size_t size);
+
+        void DispatchRecord(TraceSite const& site, std::span<std::byte const> payload);
+
+        void FlushListeners();
     };
 }
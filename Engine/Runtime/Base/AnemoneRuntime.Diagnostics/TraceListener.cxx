@@ -1,4 +1,5 @@
 #include "AnemoneRuntime.Diagnostics/TraceListener.hxx"
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
 
 #include <iterator>
 #include <array>
@@ -18,7 +19,7 @@ namespace Anemone
         };
     }();
 
-    static constexpr char GetCharacter(TraceLevel level)
+    char GetTraceLevelMark(TraceLevel level)
     {
         auto const index = std::to_underlying(level);
         if (index < TraceLevelMarks.size())
@@ -28,13 +29,36 @@ namespace Anemone
 
         return 'N';
     }
+
+    void TraceListener::TraceRecord(TraceSite const& site, std::span<std::byte const> payload)
+    {
+        fmt::memory_buffer buffer{};
+
+        auto out = std::back_inserter(buffer);
+        (*out++) = '[';
+        (*out++) = GetTraceLevelMark(site.Level);
+        (*out++) = ']';
+        (*out++) = ' ';
+
+        if (not FormatTraceArguments(buffer, site.Format, site.Arguments, payload))
+        {
+            AE_PANIC("Malformed trace record payload");
+        }
+
+        size_t const size = buffer.size();
+
+        buffer.push_back('\0');
+
+        this->TraceEvent(site.Level, buffer.data(), size);
+    }
+
     void TraceListener::TraceFormatted(TraceLevel level, std::string_view format, fmt::format_args args)
     {
         fmt::memory_buffer buffer{};
 
         auto out = std::back_inserter(buffer);
         (*out++) = '[';
-        (*out++) = GetCharacter(level);
+        (*out++) = GetTraceLevelMark(level);
         (*out++) = ']';
         (*out++) = ' ';
         out = fmt::vformat_to(out, format, args);
@@ -1,6 +1,7 @@
 #pragma once
 #include "AnemoneRuntime.Interop/Headers.hxx"
 #include "AnemoneRuntime.Base/Intrusive.hxx"
+#include "AnemoneRuntime.Diagnostics/TraceRecord.hxx"
 #include "AnemoneRuntime.Threading/ReaderWriterLock.hxx"
 
 #include <string_view>
@@ -27,6 +28,9 @@ namespace Anemone
 #endif
     };
 
+    //! Returns character which marks level in formatted messages.
+    ANEMONE_RUNTIME_BASE_API char GetTraceLevelMark(TraceLevel level);
+
     class ANEMONE_RUNTIME_BASE_API TraceListener
         : private IntrusiveListNode<TraceListener>
     {
@@ -44,8 +48,45 @@ namespace Anemone
         virtual void TraceEvent(TraceLevel level, const char* message, size_t size) = 0;
         virtual void Flush() { }
 
+        //! Receives record with deferred formatting. Default implementation formats record and passes it to
+        //! TraceEvent.
+        virtual void TraceRecord(TraceSite const& site, std::span<std::byte const> payload);
+
         void TraceFormatted(TraceLevel level, std::string_view format, fmt::format_args args);
 
+        //! Traces message of call site described by Site. Arguments are captured in binary form and formatted
+        //! only by listeners which need text. Arguments without binary representation are formatted immediately.
+        template <typename Site, typename... Args>
+        void TraceDeferred(Args const&... args)
+        {
+            // Validates format string against argument types at compile time.
+            [[maybe_unused]] static constexpr fmt::format_string<Args const&...> format{Site::Format()};
+
+            if constexpr ((Internal::TraceArgumentEncodable<std::decay_t<Args>> and ...))
+            {
+                static constexpr std::array<TraceArgumentType, sizeof...(Args)> arguments{
+                    Internal::TraceArgumentCodec<std::decay_t<Args>>::Type...,
+                };
+
+                static constexpr TraceSite site{
+                    .Id = Internal::MakeTraceSiteId<Site, Args...>(),
+                    .Level = Site::Level(),
+                    .Format = Site::Format(),
+                    .File = Site::File(),
+                    .Line = Site::Line(),
+                    .Arguments = arguments,
+                };
+
+                std::array<std::byte, TracePayloadCapacity> payload;
+                size_t const size = Internal::EncodeTraceArguments(std::span{payload}, args...);
+                this->TraceRecord(site, std::span{payload}.first(size));
+            }
+            else
+            {
+                this->TraceFormatted(Site::Level(), Site::Format(), fmt::make_format_args(args...));
+            }
+        }
+
         template <typename... Args>
         void Trace(TraceLevel level, const char* format, Args const&... args)
         {
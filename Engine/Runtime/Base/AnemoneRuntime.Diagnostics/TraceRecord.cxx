@@ -0,0 +1,169 @@
+#include "AnemoneRuntime.Diagnostics/TraceRecord.hxx"
+
+#include <fmt/args.h>
+
+namespace Anemone
+{
+    namespace
+    {
+        class PayloadReader final
+        {
+        private:
+            std::span<std::byte const> m_Payload;
+
+        public:
+            explicit PayloadReader(std::span<std::byte const> payload)
+                : m_Payload{payload}
+            {
+            }
+
+            template <typename T>
+            bool Read(T& value)
+            {
+                if (this->m_Payload.size() < sizeof(T))
+                {
+                    return false;
+                }
+
+                std::memcpy(&value, this->m_Payload.data(), sizeof(T));
+                this->m_Payload = this->m_Payload.subspan(sizeof(T));
+                return true;
+            }
+
+            bool ReadString(std::string_view& value)
+            {
+                uint32_t length{};
+
+                if (not this->Read(length) or (this->m_Payload.size() < length))
+                {
+                    return false;
+                }
+
+                value = std::string_view{reinterpret_cast<char const*>(this->m_Payload.data()), length};
+                this->m_Payload = this->m_Payload.subspan(length);
+                return true;
+            }
+
+            bool IsEmpty() const
+            {
+                return this->m_Payload.empty();
+            }
+        };
+
+        template <typename T>
+        bool PushValue(fmt::dynamic_format_arg_store<fmt::format_context>& store, PayloadReader& reader)
+        {
+            T value{};
+
+            if (not reader.Read(value))
+            {
+                return false;
+            }
+
+            store.push_back(value);
+            return true;
+        }
+    }
+
+    bool FormatTraceArguments(
+        fmt::memory_buffer& buffer,
+        std::string_view format,
+        std::span<TraceArgumentType const> arguments,
+        std::span<std::byte const> payload)
+    {
+        fmt::dynamic_format_arg_store<fmt::format_context> store{};
+        store.reserve(arguments.size(), 0);
+
+        PayloadReader reader{payload};
+
+        for (TraceArgumentType const type : arguments)
+        {
+            bool valid = false;
+
+            switch (type)
+            {
+            case TraceArgumentType::Bool:
+                {
+                    uint8_t value{};
+                    valid = reader.Read(value);
+                    store.push_back(value != 0);
+                    break;
+                }
+
+            case TraceArgumentType::Char:
+                valid = PushValue<char>(store, reader);
+                break;
+
+            case TraceArgumentType::Int8:
+                valid = PushValue<int8_t>(store, reader);
+                break;
+
+            case TraceArgumentType::Int16:
+                valid = PushValue<int16_t>(store, reader);
+                break;
+
+            case TraceArgumentType::Int32:
+                valid = PushValue<int32_t>(store, reader);
+                break;
+
+            case TraceArgumentType::Int64:
+                valid = PushValue<int64_t>(store, reader);
+                break;
+
+            case TraceArgumentType::UInt8:
+                valid = PushValue<uint8_t>(store, reader);
+                break;
+
+            case TraceArgumentType::UInt16:
+                valid = PushValue<uint16_t>(store, reader);
+                break;
+
+            case TraceArgumentType::UInt32:
+                valid = PushValue<uint32_t>(store, reader);
+                break;
+
+            case TraceArgumentType::UInt64:
+                valid = PushValue<uint64_t>(store, reader);
+                break;
+
+            case TraceArgumentType::Float32:
+                valid = PushValue<float>(store, reader);
+                break;
+
+            case TraceArgumentType::Float64:
+                valid = PushValue<double>(store, reader);
+                break;
+
+            case TraceArgumentType::Pointer:
+                {
+                    uint64_t value{};
+                    valid = reader.Read(value);
+                    store.push_back(std::bit_cast<void const*>(static_cast<uintptr_t>(value)));
+                    break;
+                }
+
+            case TraceArgumentType::String:
+                {
+                    // View points into payload, which outlives formatting.
+                    std::string_view value{};
+                    valid = reader.ReadString(value);
+                    store.push_back(value);
+                    break;
+                }
+            }
+
+            if (not valid)
+            {
+                return false;
+            }
+        }
+
+        if (not reader.IsEmpty())
+        {
+            return false;
+        }
+
+        fmt::vformat_to(std::back_inserter(buffer), format, store);
+        return true;
+    }
+}
@@ -0,0 +1,258 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+#include "AnemoneRuntime.Base/FNV.hxx"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <fmt/format.h>
+
+namespace Anemone
+{
+    enum class TraceLevel : uint8_t;
+
+    //! Type of argument stored in payload of trace record.
+    enum class TraceArgumentType : uint8_t
+    {
+        Bool,
+        Char,
+        Int8,
+        Int16,
+        Int32,
+        Int64,
+        UInt8,
+        UInt16,
+        UInt32,
+        UInt64,
+        Float32,
+        Float64,
+        Pointer,
+
+        //! 32-bit length followed by characters.
+        String,
+    };
+
+    //! Describes trace call site. Created at compile time for every AE_TRACE invocation.
+    struct TraceSite final
+    {
+        //! Identifies site in binary trace logs.
+        uint64_t Id;
+        TraceLevel Level;
+        std::string_view Format;
+        std::string_view File;
+        uint32_t Line;
+        std::span<TraceArgumentType const> Arguments;
+    };
+
+    //! Maximum size of arguments of single trace record. Strings are truncated to fit.
+    inline constexpr size_t TracePayloadCapacity = 512;
+
+    //! Formats arguments stored in payload of trace record. Returns false when payload does not match argument types.
+    ANEMONE_RUNTIME_BASE_API bool FormatTraceArguments(
+        fmt::memory_buffer& buffer,
+        std::string_view format,
+        std::span<TraceArgumentType const> arguments,
+        std::span<std::byte const> payload);
+}
+
+namespace Anemone::Internal
+{
+    //! Converts argument of trace call to its binary representation. Not specialized for types which must be
+    //! formatted at call site.
+    template <typename T>
+    struct TraceArgumentCodec;
+
+    template <typename T>
+    concept TraceArgumentEncodable = requires {
+        TraceArgumentCodec<T>::Type;
+    };
+
+    template <typename T, TraceArgumentType TypeT, typename StorageT>
+    struct TraceValueArgumentCodec
+    {
+        static constexpr TraceArgumentType Type = TypeT;
+
+        static constexpr size_t FixedSize = sizeof(StorageT);
+
+        static size_t Encode(std::byte* output, size_t capacity, T value)
+        {
+            (void)capacity;
+            StorageT const stored = static_cast<StorageT>(value);
+            std::memcpy(output, &stored, sizeof(stored));
+            return sizeof(stored);
+        }
+    };
+
+    template <typename T>
+    constexpr TraceArgumentType GetTraceIntegerType()
+    {
+        if constexpr (std::is_signed_v<T>)
+        {
+            if constexpr (sizeof(T) == 1)
+            {
+                return TraceArgumentType::Int8;
+            }
+            else if constexpr (sizeof(T) == 2)
+            {
+                return TraceArgumentType::Int16;
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                return TraceArgumentType::Int32;
+            }
+            else
+            {
+                static_assert(sizeof(T) == 8);
+                return TraceArgumentType::Int64;
+            }
+        }
+        else
+        {
+            if constexpr (sizeof(T) == 1)
+            {
+                return TraceArgumentType::UInt8;
+            }
+            else if constexpr (sizeof(T) == 2)
+            {
+                return TraceArgumentType::UInt16;
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                return TraceArgumentType::UInt32;
+            }
+            else
+            {
+                static_assert(sizeof(T) == 8);
+                return TraceArgumentType::UInt64;
+            }
+        }
+    }
+
+    template <typename T>
+        requires(std::is_integral_v<T> and not std::is_same_v<T, bool> and not std::is_same_v<T, char>)
+    struct TraceArgumentCodec<T> : TraceValueArgumentCodec<T, GetTraceIntegerType<T>(), T>
+    {
+    };
+
+    template <>
+    struct TraceArgumentCodec<bool> : TraceValueArgumentCodec<bool, TraceArgumentType::Bool, uint8_t>
+    {
+    };
+
+    template <>
+    struct TraceArgumentCodec<char> : TraceValueArgumentCodec<char, TraceArgumentType::Char, char>
+    {
+    };
+
+    template <>
+    struct TraceArgumentCodec<float> : TraceValueArgumentCodec<float, TraceArgumentType::Float32, float>
+    {
+    };
+
+    template <>
+    struct TraceArgumentCodec<double> : TraceValueArgumentCodec<double, TraceArgumentType::Float64, double>
+    {
+    };
+
+    template <typename T>
+        requires(std::is_void_v<T>)
+    struct TraceArgumentCodec<T*>
+    {
+        static constexpr TraceArgumentType Type = TraceArgumentType::Pointer;
+
+        static constexpr size_t FixedSize = sizeof(uint64_t);
+
+        static size_t Encode(std::byte* output, size_t capacity, T* value)
+        {
+            (void)capacity;
+            uint64_t const stored = std::bit_cast<uintptr_t>(value);
+            std::memcpy(output, &stored, sizeof(stored));
+            return sizeof(stored);
+        }
+    };
+
+    struct TraceStringArgumentCodec
+    {
+        static constexpr TraceArgumentType Type = TraceArgumentType::String;
+
+        static constexpr size_t FixedSize = sizeof(uint32_t);
+
+        static size_t Encode(std::byte* output, size_t capacity, std::string_view value)
+        {
+            uint32_t const length = static_cast<uint32_t>(std::min(value.size(), capacity - sizeof(uint32_t)));
+            std::memcpy(output, &length, sizeof(length));
+            std::memcpy(output + sizeof(length), value.data(), length);
+            return sizeof(length) + length;
+        }
+    };
+
+    template <>
+    struct TraceArgumentCodec<std::string_view> : TraceStringArgumentCodec
+    {
+    };
+
+    template <>
+    struct TraceArgumentCodec<std::string> : TraceStringArgumentCodec
+    {
+    };
+
+    template <>
+    struct TraceArgumentCodec<char const*> : TraceStringArgumentCodec
+    {
+        static size_t Encode(std::byte* output, size_t capacity, char const* value)
+        {
+            return TraceStringArgumentCodec::Encode(output, capacity, (value != nullptr) ? std::string_view{value} : std::string_view{});
+        }
+    };
+
+    template <>
+    struct TraceArgumentCodec<char*> : TraceArgumentCodec<char const*>
+    {
+    };
+
+    //! Writes arguments into payload. Fixed size arguments always fit; only strings are truncated.
+    template <typename... Args>
+    size_t EncodeTraceArguments([[maybe_unused]] std::span<std::byte, TracePayloadCapacity> payload, Args const&... args)
+    {
+        static_assert((TraceArgumentCodec<std::decay_t<Args>>::FixedSize + ... + 0) <= TracePayloadCapacity);
+
+        // Space reserved for fixed part of arguments not written yet.
+        [[maybe_unused]] size_t reserved = (TraceArgumentCodec<std::decay_t<Args>>::FixedSize + ... + 0);
+        size_t size = 0;
+
+        ([&]
+        {
+            using Codec = TraceArgumentCodec<std::decay_t<Args>>;
+            reserved -= Codec::FixedSize;
+            size += Codec::Encode(payload.data() + size, payload.size() - size - reserved, args);
+        }(), ...);
+
+        return size;
+    }
+
+    template <typename Site, typename... Args>
+    constexpr uint64_t MakeTraceSiteId()
+    {
+        FNV1A64 hash{};
+        hash.Update(Site::File());
+        hash.Update(std::string_view{"\0", 1});
+        hash.Update(Site::Format());
+
+        std::array<std::byte, 5 + sizeof...(Args)> suffix{
+            static_cast<std::byte>(Site::Level()),
+            static_cast<std::byte>(Site::Line()),
+            static_cast<std::byte>(Site::Line() >> 8u),
+            static_cast<std::byte>(Site::Line() >> 16u),
+            static_cast<std::byte>(Site::Line() >> 24u),
+            static_cast<std::byte>(TraceArgumentCodec<std::decay_t<Args>>::Type)...,
+        };
+
+        hash.Update(suffix);
+        return hash.Finalize();
+    }
+}
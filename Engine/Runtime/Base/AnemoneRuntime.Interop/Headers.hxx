@@ -557,6 +557,24 @@
 #define ANEMONE_FEATURE_ASSERTIONS false
 #endif
 
+// Memory tracking: per-tag accounting of allocations; cheap enough for profiling builds
+#if !ANEMONE_BUILD_SHIPPING || ANEMONE_BUILD_PROFILING
+#define ANEMONE_FEATURE_MEMORY_TRACKING true
+#endif
+
+#ifndef ANEMONE_FEATURE_MEMORY_TRACKING
+#define ANEMONE_FEATURE_MEMORY_TRACKING false
+#endif
+
+// Frame allocator validation: poisoning of reclaimed frames and detection of pointers escaping their frame
+#if !ANEMONE_BUILD_SHIPPING
+#define ANEMONE_FEATURE_FRAME_ALLOCATOR_VALIDATION true
+#endif
+
+#ifndef ANEMONE_FEATURE_FRAME_ALLOCATOR_VALIDATION
+#define ANEMONE_FEATURE_FRAME_ALLOCATOR_VALIDATION false
+#endif
+
 // Just-in-time debugger support
 #if !ANEMONE_BUILD_SHIPPING
 #define ANEMONE_FEATURE_JITDEBUGGER true
@@ -53,6 +53,11 @@ namespace Anemone
         {
         }
 
+        explicit MemoryArena(RawMemoryArenaReservation const& reservation)
+            : _arena{reservation}
+        {
+        }
+
         MemoryArena(MemoryArena const&) = delete;
 
         MemoryArena(MemoryArena&&) = delete;
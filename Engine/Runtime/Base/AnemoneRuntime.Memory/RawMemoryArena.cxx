@@ -1,9 +1,36 @@
 #include "AnemoneRuntime.Memory/MemoryArena.hxx"
 #include "AnemoneRuntime.Diagnostics/Debug.hxx"
 #include "AnemoneRuntime.Base/Bitwise.hxx"
+#include "AnemoneRuntime.System/SystemAllocator.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
+
+#include <algorithm>
 
 namespace Anemone
 {
+    RawMemoryArena::RawMemoryArena(RawMemoryArenaReservation const& reservation)
+    {
+        AE_ASSERT(reservation.Reserve != 0);
+
+        size_t const granularity = static_cast<size_t>(Environment::GetMemoryProperties().SystemAllocationGranularity);
+
+        this->_commitGranularity = AlignUp(std::max(reservation.CommitGranularity, granularity), granularity);
+        this->_reserved = AlignUp(reservation.Reserve, this->_commitGranularity);
+        this->_trimAfterIdleResets = reservation.TrimAfterIdleResets;
+        this->_base = static_cast<std::byte*>(SystemAllocator::ReserveUncommitted(this->_reserved, true, false));
+    }
+
+    RawMemoryArena::~RawMemoryArena()
+    {
+        this->Reset();
+
+        if (this->_base != nullptr)
+        {
+            Memory::MemoryTracking::TrackDeallocation(this->_tag, this->_committed);
+            SystemAllocator::DecommitAndRelease(this->_base, this->_reserved);
+        }
+    }
+
     void* RawMemoryArena::Segment::Allocate(size_t size, size_t alignment)
     {
         AE_ASSERT(size != 0);
@@ -33,6 +60,7 @@ namespace Anemone
     RawMemoryArena::Segment* RawMemoryArena::AllocateSegment(size_t segmentSize)
     {
         void* const allocation = ::operator new(segmentSize);
+        Memory::MemoryTracking::TrackAllocation(this->_tag, segmentSize);
         AE_ASSERT(allocation != nullptr);
         AE_ASSERT(IsAligned(allocation, alignof(Segment)));
 
@@ -54,6 +82,7 @@ namespace Anemone
         size_t totalSize = AlignUp(allocationOffset + size, totalAlignment);
 
         void* const allocation = ::operator new(totalSize, std::align_val_t{totalAlignment});
+        Memory::MemoryTracking::TrackAllocation(this->_tag, totalSize);
         AE_ASSERT(allocation != nullptr);
 
         Oversized* const header = std::construct_at(static_cast<Oversized*>(allocation), totalSize, totalAlignment);
@@ -63,8 +92,97 @@ namespace Anemone
         return result;
     }
 
+    void* RawMemoryArena::AllocateVirtual(size_t size, size_t alignment)
+    {
+        AE_ASSERT(size != 0);
+        AE_ASSERT(alignment != 0);
+
+        uintptr_t const base = std::bit_cast<uintptr_t>(this->_base);
+        size_t const start = AlignUp(base + this->_offset, alignment) - base;
+        size_t const end = start + AlignUp(size, alignment);
+
+        if (end > this->_reserved)
+        {
+            // Reservation exhausted.
+            return nullptr;
+        }
+
+        if (end > this->_committed)
+            [[unlikely]]
+        {
+            size_t const committed = AlignUp(end, this->_commitGranularity);
+
+            if (SystemAllocator::Commit(this->_base + this->_committed, committed - this->_committed, true, false) == nullptr)
+            {
+                // Commit limit reached; caller falls back to oversized allocation.
+                if (this->_offset == 0)
+                {
+                    // No live allocations in reservation, so release it and use segments from now on.
+                    Memory::MemoryTracking::TrackDeallocation(this->_tag, this->_committed);
+                    SystemAllocator::DecommitAndRelease(this->_base, this->_reserved);
+                    this->_base = nullptr;
+                    this->_reserved = 0;
+                    this->_committed = 0;
+                }
+
+                return nullptr;
+            }
+
+            Memory::MemoryTracking::TrackAllocation(this->_tag, committed - this->_committed);
+            this->_committed = committed;
+        }
+
+        this->_offset = end;
+        return this->_base + start;
+    }
+
+    void RawMemoryArena::ResetVirtual()
+    {
+        size_t const used = this->_offset;
+        this->_offset = 0;
+
+        if (this->_trimAfterIdleResets == 0)
+        {
+            return;
+        }
+
+        // Frame is idle when it didn't touch the topmost commit granule.
+        if ((used + this->_commitGranularity) > this->_committed)
+        {
+            this->_idleResets = 0;
+            this->_idlePeak = 0;
+            return;
+        }
+
+        this->_idlePeak = std::max(this->_idlePeak, used);
+
+        if (++this->_idleResets >= this->_trimAfterIdleResets)
+        {
+            // Keep enough memory for the busiest of idle frames.
+            size_t const keep = AlignUp(this->_idlePeak, this->_commitGranularity);
+
+            SystemAllocator::Decommit(this->_base + keep, this->_committed - keep);
+            Memory::MemoryTracking::TrackDeallocation(this->_tag, this->_committed - keep);
+            this->_committed = keep;
+
+            this->_idleResets = 0;
+            this->_idlePeak = 0;
+        }
+    }
+
     void* RawMemoryArena::Allocate(size_t size, size_t alignment)
     {
+        if (this->_base != nullptr)
+        {
+            if (void* const result = this->AllocateVirtual(size, alignment))
+                [[likely]]
+            {
+                return result;
+            }
+
+            return this->AllocateOversized(size, alignment);
+        }
+
         if (size > (this->_defaultSegmentSize / 4))
         {
             // Allocate oversized memory separately.
@@ -99,19 +217,29 @@ namespace Anemone
 
     void RawMemoryArena::Reset()
     {
+        if (this->_base != nullptr)
+        {
+            this->ResetVirtual();
+        }
+
         while (Segment* current = this->_segments.PopFront())
         {
+            Memory::MemoryTracking::TrackDeallocation(this->_tag, current->Size);
             ::operator delete(current);
         }
 
         while (Oversized* current = this->_oversized.PopFront())
         {
+            Memory::MemoryTracking::TrackDeallocation(this->_tag, current->Size);
             ::operator delete(current, std::align_val_t{current->Alignment});
         }
     }
 
     void RawMemoryArena::QueryMemoryUsage(size_t& reserved, size_t& allocated) const
     {
+        reserved += this->_committed;
+        allocated += this->_offset;
+
         this->_segments.ForEach(
             [&](Segment const& segment)
         {
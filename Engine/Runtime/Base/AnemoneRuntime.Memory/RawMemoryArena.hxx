@@ -1,8 +1,27 @@
 #pragma once
 #include "AnemoneRuntime.Base/Intrusive.hxx"
+#include "AnemoneRuntime.Base/Memory/MemoryTracking.hxx"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
 
 namespace Anemone
 {
+    //! Describes arena backed by single contiguous range of virtual memory.
+    struct RawMemoryArenaReservation final
+    {
+        //! Size of virtual address range reserved up front. Allocations exceeding it fall back to oversized blocks.
+        size_t Reserve;
+
+        //! Granularity in which reserved range is committed. Rounded up to system allocation granularity.
+        size_t CommitGranularity = size_t{64} << 10u;
+
+        //! Number of consecutive resets which didn't use top of committed range, after which that unused part is
+        //! decommitted. Zero disables trimming.
+        uint32_t TrimAfterIdleResets = 0;
+    };
+
     class ANEMONE_RUNTIME_BASE_API RawMemoryArena final
     {
     public:
@@ -49,11 +68,28 @@ namespace Anemone
         IntrusiveList<Oversized> _oversized{};
         size_t _defaultSegmentSize{DefaultSegmentSize};
 
+        // Memory owned by arena is accounted to tag active when it was created.
+        Memory::MemoryTag _tag{Memory::MemoryTracking::GetCurrentTag()};
+
+        // Virtual memory mode.
+        std::byte* _base{};
+        size_t _reserved{};
+        size_t _committed{};
+        size_t _offset{};
+        size_t _commitGranularity{};
+        uint32_t _trimAfterIdleResets{};
+        uint32_t _idleResets{};
+        size_t _idlePeak{};
+
     private:
         Segment* AllocateSegment(size_t segmentSize);
 
         void* AllocateOversized(size_t size, size_t alignment);
 
+        void* AllocateVirtual(size_t size, size_t alignment);
+
+        void ResetVirtual();
+
     public:
         RawMemoryArena()
             : RawMemoryArena{DefaultSegmentSize}
@@ -65,6 +101,10 @@ namespace Anemone
         {
         }
 
+        //! Creates arena which reserves contiguous virtual range and commits it lazily as allocations advance.
+        //! Reset only rewinds allocation pointer, so steady state performs no system calls.
+        explicit RawMemoryArena(RawMemoryArenaReservation const& reservation);
+
         RawMemoryArena(RawMemoryArena const&) = delete;
 
         RawMemoryArena(RawMemoryArena&&) = delete;
@@ -73,10 +113,7 @@ namespace Anemone
 
         RawMemoryArena& operator=(RawMemoryArena&&) = delete;
 
-        ~RawMemoryArena()
-        {
-            this->Reset();
-        }
+        ~RawMemoryArena();
 
     public:
         [[nodiscard]] void* Allocate(size_t size, size_t alignment);
@@ -84,6 +121,24 @@ namespace Anemone
         // Resets the arena, releasing all allocated memory.
         void Reset();
 
+        [[nodiscard]] bool IsVirtual() const
+        {
+            return this->_base != nullptr;
+        }
+
+        //! Checks whether address belongs to reserved virtual range.
+        [[nodiscard]] bool IsReserved(void const* address) const
+        {
+            std::byte const* const p = static_cast<std::byte const*>(address);
+            return (this->_base <= p) and (p < (this->_base + this->_reserved));
+        }
+
+        //! Gets part of reserved virtual range used by allocations since last reset.
+        [[nodiscard]] std::span<std::byte> GetVirtualAllocated() const
+        {
+            return std::span{this->_base, this->_offset};
+        }
+
         void QueryMemoryUsage(size_t& reserved, size_t& allocated) const;
     };
 }
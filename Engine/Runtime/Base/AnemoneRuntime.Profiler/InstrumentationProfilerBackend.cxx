@@ -0,0 +1,565 @@
+#include "AnemoneRuntime.Profiler/InstrumentationProfilerBackend.hxx"
+
+#if ANEMONE_BUILD_PROFILING
+
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
+#include "AnemoneRuntime.Storage/FilePath.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
+#include "AnemoneRuntime.Threading/CurrentThread.hxx"
+#include "AnemoneRuntime.Threading/Lock.hxx"
+
+#if ANEMONE_COMPILER_MSVC
+#include <intrin.h>
+#elif ANEMONE_ARCHITECTURE_X64
+#include <x86intrin.h>
+#endif
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <iterator>
+
+#include <fmt/format.h>
+
+namespace Anemone
+{
+    namespace
+    {
+        std::atomic_uint64_t gNextBackendInstance{1};
+
+        // Invariant processor timestamp; converted to time when trace is exported.
+        anemone_forceinline uint64_t ReadTimestampCounter()
+        {
+#if ANEMONE_ARCHITECTURE_X64
+            return __rdtsc();
+#elif ANEMONE_ARCHITECTURE_ARM64 && ANEMONE_COMPILER_MSVC
+            return _ReadStatusReg(ARM64_CNTVCT);
+#elif ANEMONE_ARCHITECTURE_ARM64
+            uint64_t value;
+            asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+            return value;
+#else
+            return static_cast<uint64_t>(Instant::Now().SinceEpoch().ToNanoseconds());
+#endif
+        }
+
+        void WriteJsonString(fmt::memory_buffer& buffer, std::string_view value)
+        {
+            auto out = std::back_inserter(buffer);
+            (*out++) = '"';
+
+            for (char const c : value)
+            {
+                if ((c == '"') or (c == '\\'))
+                {
+                    (*out++) = '\\';
+                    (*out++) = c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    fmt::format_to(out, "\\u{:04x}", static_cast<unsigned>(c));
+                }
+                else
+                {
+                    (*out++) = c;
+                }
+            }
+
+            (*out++) = '"';
+        }
+
+        std::expected<void, Error> WriteBuffer(OutputStream& stream, fmt::memory_buffer& buffer)
+        {
+            std::span<std::byte const> remaining = std::as_bytes(std::span{buffer.data(), buffer.size()});
+
+            while (not remaining.empty())
+            {
+                auto const written = stream.Write(remaining);
+
+                if (not written)
+                {
+                    return std::unexpected(written.error());
+                }
+
+                if (*written == 0)
+                {
+                    return std::unexpected(Error::IoError);
+                }
+
+                remaining = remaining.subspan(*written);
+            }
+
+            buffer.clear();
+            return {};
+        }
+    }
+
+    struct InstrumentationProfilerBackend::Chunk final
+    {
+        //! Number of events published by owning thread.
+        std::atomic_size_t Count{};
+        std::atomic<Chunk*> Next{};
+        std::unique_ptr<Event[]> Events{};
+
+        //! Number of events already exported. Guarded by backend lock.
+        size_t Consumed{};
+    };
+
+    struct InstrumentationProfilerBackend::ThreadBuffer final
+    {
+        ThreadId Id{};
+
+        //! Guarded by backend lock.
+        std::string Name{};
+
+        //! Scopes left open by previous export; reopened by next one. Guarded by backend lock.
+        std::vector<Event> OpenScopes{};
+
+        std::atomic<Chunk*> Head{};
+
+        //! Decremented by export when it releases chunks.
+        std::atomic_size_t ChunkCount{};
+
+        //! Accessed only by owning thread.
+        Chunk* Tail{};
+
+        //! Whether each open scope was recorded; accessed only by owning thread.
+        std::vector<bool> Scopes{};
+
+        //! Written only by owning thread.
+        std::atomic_uint64_t Dropped{};
+    };
+
+    InstrumentationProfilerBackend::InstrumentationProfilerBackend(InstrumentationProfilerOptions const& options)
+        : m_Options{options}
+        , m_Instance{gNextBackendInstance.fetch_add(1, std::memory_order::relaxed)}
+        , m_StartedTicks{ReadTimestampCounter()}
+        , m_Started{Instant::Now()}
+    {
+        AE_ASSERT(this->m_Options.ChunkCapacity != 0);
+        AE_ASSERT(this->m_Options.MaxChunksPerThread != 0);
+    }
+
+    InstrumentationProfilerBackend::~InstrumentationProfilerBackend()
+    {
+        for (std::unique_ptr<ThreadBuffer> const& thread : this->m_Threads)
+        {
+            Chunk* chunk = thread->Head.load(std::memory_order::acquire);
+
+            while (chunk != nullptr)
+            {
+                Chunk* const next = chunk->Next.load(std::memory_order::acquire);
+                delete chunk;
+                chunk = next;
+            }
+        }
+    }
+
+    void InstrumentationProfilerBackend::BeginFrame()
+    {
+        this->Record(EventType::BeginFrame, "Frame", this->m_Frame.fetch_add(1, std::memory_order::relaxed));
+    }
+
+    void InstrumentationProfilerBackend::EndFrame()
+    {
+        this->Record(EventType::EndFrame, "Frame", 0);
+    }
+
+    void InstrumentationProfilerBackend::BeginMarker(ProfilerMarker& marker)
+    {
+        this->Record(EventType::Begin, marker.Name(), 0);
+    }
+
+    void InstrumentationProfilerBackend::EndMarker(ProfilerMarker& marker)
+    {
+        this->Record(EventType::End, marker.Name(), 0);
+    }
+
+    void InstrumentationProfilerBackend::EventMarker(ProfilerMarker& marker)
+    {
+        this->Record(EventType::Instant, marker.Name(), 0);
+    }
+
+    void InstrumentationProfilerBackend::SetThreadName(std::string_view name)
+    {
+        ThreadBuffer& buffer = this->GetThreadBuffer();
+
+        UniqueLock scope{this->m_Lock};
+        buffer.Name = name;
+    }
+
+    void InstrumentationProfilerBackend::CounterValue(ProfilerCounter<int64_t>& counter, int64_t value)
+    {
+        this->Record(EventType::IntegerCounter, counter.Name(), std::bit_cast<uint64_t>(value));
+    }
+
+    void InstrumentationProfilerBackend::CounterValue(ProfilerCounter<double>& counter, double value)
+    {
+        this->Record(EventType::FloatCounter, counter.Name(), std::bit_cast<uint64_t>(value));
+    }
+
+    void InstrumentationProfilerBackend::MemoryAllocate(ProfilerMarker& marker, void const* pointer, size_t size)
+    {
+        this->Record(EventType::Allocate, marker.Name(), std::bit_cast<uintptr_t>(pointer), size);
+    }
+
+    void InstrumentationProfilerBackend::MemoryFree(ProfilerMarker& marker, void const* pointer)
+    {
+        this->Record(EventType::Free, marker.Name(), std::bit_cast<uintptr_t>(pointer));
+    }
+
+    void InstrumentationProfilerBackend::BeginFlow(ProfilerMarker& marker, uint64_t id)
+    {
+        this->Record(EventType::BeginFlow, marker.Name(), id);
+    }
+
+    void InstrumentationProfilerBackend::EndFlow(ProfilerMarker& marker, uint64_t id)
+    {
+        this->Record(EventType::EndFlow, marker.Name(), id);
+    }
+
+    std::expected<void, Error> InstrumentationProfilerBackend::WriteChromeTrace(OutputStream& stream)
+    {
+        UniqueLock scope{this->m_Lock};
+
+        // Calibrate timestamp counter against monotonic clock over whole recording.
+        uint64_t const elapsedTicks = ReadTimestampCounter() - this->m_StartedTicks;
+        int64_t const elapsedNanoseconds = this->m_Started.QueryElapsed().ToNanoseconds();
+        double const microsecondsPerTick = ((elapsedTicks != 0) and (elapsedNanoseconds > 0))
+            ? (static_cast<double>(elapsedNanoseconds) / 1000.0) / static_cast<double>(elapsedTicks)
+            : 0.001;
+
+        constexpr int ProcessId = 1;
+        constexpr size_t FlushThreshold = 64u << 10u;
+
+        fmt::memory_buffer buffer{};
+        auto out = std::back_inserter(buffer);
+
+        auto writeEvent = [&](Event const& event, ThreadId threadId)
+        {
+            double const timestamp = static_cast<double>(event.Timestamp - this->m_StartedTicks) * microsecondsPerTick;
+
+            switch (event.Type)
+            {
+            case EventType::Begin:
+            case EventType::BeginFrame:
+                fmt::format_to(out, ",\n{{\"name\":");
+                WriteJsonString(buffer, event.Name);
+                fmt::format_to(out, ",\"ph\":\"B\",\"ts\":{:.3f},\"pid\":{},\"tid\":{}", timestamp, ProcessId, threadId);
+
+                if (event.Type == EventType::BeginFrame)
+                {
+                    fmt::format_to(out, ",\"args\":{{\"frame\":{}}}", event.Value);
+                }
+
+                fmt::format_to(out, "}}");
+                break;
+
+            case EventType::End:
+            case EventType::EndFrame:
+                fmt::format_to(out, ",\n{{\"ph\":\"E\",\"ts\":{:.3f},\"pid\":{},\"tid\":{}}}", timestamp, ProcessId, threadId);
+                break;
+
+            case EventType::Instant:
+                fmt::format_to(out, ",\n{{\"name\":");
+                WriteJsonString(buffer, event.Name);
+                fmt::format_to(out, ",\"ph\":\"i\",\"s\":\"t\",\"ts\":{:.3f},\"pid\":{},\"tid\":{}}}", timestamp, ProcessId, threadId);
+                break;
+
+            case EventType::IntegerCounter:
+            case EventType::FloatCounter:
+                // Counters are tracks of process; values from all threads form one plot.
+                fmt::format_to(out, ",\n{{\"name\":");
+                WriteJsonString(buffer, event.Name);
+                fmt::format_to(out, ",\"ph\":\"C\",\"ts\":{:.3f},\"pid\":{},\"args\":{{\"value\":", timestamp, ProcessId);
+
+                if (event.Type == EventType::IntegerCounter)
+                {
+                    fmt::format_to(out, "{}}}}}", std::bit_cast<int64_t>(event.Value));
+                }
+                else
+                {
+                    // JSON has no representation of infinities and NaNs.
+                    double const value = std::bit_cast<double>(event.Value);
+                    fmt::format_to(out, "{}}}}}", std::isfinite(value) ? value : 0.0);
+                }
+                break;
+
+            case EventType::Allocate:
+            case EventType::Free:
+                fmt::format_to(out, ",\n{{\"name\":");
+                WriteJsonString(buffer, event.Name);
+                fmt::format_to(out, ",\"cat\":\"memory\",\"ph\":\"i\",\"s\":\"t\",\"ts\":{:.3f},\"pid\":{},\"tid\":{}", timestamp, ProcessId, threadId);
+
+                if (event.Type == EventType::Allocate)
+                {
+                    fmt::format_to(out, ",\"args\":{{\"operation\":\"allocate\",\"address\":\"0x{:x}\",\"size\":{}}}}}", event.Value, event.Size);
+                }
+                else
+                {
+                    fmt::format_to(out, ",\"args\":{{\"operation\":\"free\",\"address\":\"0x{:x}\"}}}}", event.Value);
+                }
+                break;
+
+            case EventType::BeginFlow:
+            case EventType::EndFlow:
+                // Flow end binds to enclosing slice instead of next one.
+                fmt::format_to(out, ",\n{{\"name\":");
+                WriteJsonString(buffer, event.Name);
+                fmt::format_to(out, ",\"cat\":\"flow\",\"ph\":{},\"id\":{},\"ts\":{:.3f},\"pid\":{},\"tid\":{}}}",
+                    (event.Type == EventType::BeginFlow) ? "\"s\"" : "\"f\",\"bp\":\"e\"",
+                    event.Value,
+                    timestamp,
+                    ProcessId,
+                    threadId);
+                break;
+            }
+        };
+
+        fmt::format_to(out, "{{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+        fmt::format_to(out, "{{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":{},\"args\":{{\"name\":", ProcessId);
+        WriteJsonString(buffer, FilePath::GetFileName(Environment::GetExecutablePath()));
+        fmt::format_to(out, "}}}}");
+
+        for (std::unique_ptr<ThreadBuffer> const& thread : this->m_Threads)
+        {
+            if (not thread->Name.empty())
+            {
+                fmt::format_to(out, ",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":{},\"tid\":{},\"args\":{{\"name\":", ProcessId, thread->Id);
+                WriteJsonString(buffer, thread->Name);
+                fmt::format_to(out, "}}}}");
+            }
+
+            // Scopes closed at end of previous export are still running; reopen them with original timestamps.
+            for (Event const& open : thread->OpenScopes)
+            {
+                writeEvent(open, thread->Id);
+            }
+
+            uint64_t lastTimestamp = this->m_StartedTicks;
+
+            for (Chunk* chunk = thread->Head.load(std::memory_order::acquire); chunk != nullptr;)
+            {
+                // Owning thread no longer touches chunk once it has linked next one; load link first, so count is final then.
+                Chunk* const next = chunk->Next.load(std::memory_order::acquire);
+                size_t const count = chunk->Count.load(std::memory_order::acquire);
+
+                for (size_t i = chunk->Consumed; i < count; ++i)
+                {
+                    Event const& event = chunk->Events[i];
+                    lastTimestamp = event.Timestamp;
+
+                    if ((event.Type == EventType::Begin) or (event.Type == EventType::BeginFrame))
+                    {
+                        thread->OpenScopes.push_back(event);
+                    }
+                    else if ((event.Type == EventType::End) or (event.Type == EventType::EndFrame))
+                    {
+                        // Recording thread never records end of scope which was not recorded.
+                        AE_ASSERT(not thread->OpenScopes.empty());
+                        thread->OpenScopes.pop_back();
+                    }
+
+                    writeEvent(event, thread->Id);
+
+                    if (buffer.size() >= FlushThreshold)
+                    {
+                        if (auto rc = WriteBuffer(stream, buffer); not rc)
+                        {
+                            return rc;
+                        }
+                    }
+                }
+
+                chunk->Consumed = count;
+
+                if (next != nullptr)
+                {
+                    // Exported events are released, so recording can continue within budget.
+                    thread->Head.store(next, std::memory_order::release);
+                    thread->ChunkCount.fetch_sub(1, std::memory_order::relaxed);
+                    delete chunk;
+                }
+
+                chunk = next;
+            }
+
+            // Close scopes which are still running, so exported trace is balanced.
+            uint64_t const closed = std::max(ReadTimestampCounter(), lastTimestamp);
+
+            for (auto it = thread->OpenScopes.rbegin(); it != thread->OpenScopes.rend(); ++it)
+            {
+                writeEvent(
+                    Event{
+                        .Timestamp = closed,
+                        .Name = it->Name,
+                        .Value = 0,
+                        .Size = 0,
+                        .Type = (it->Type == EventType::BeginFrame) ? EventType::EndFrame : EventType::End,
+                    },
+                    thread->Id);
+            }
+        }
+
+        fmt::format_to(out, "\n]}}\n");
+
+        if (auto rc = WriteBuffer(stream, buffer); not rc)
+        {
+            return rc;
+        }
+
+        if (auto rc = stream.Flush(); not rc)
+        {
+            return std::unexpected(rc.error());
+        }
+
+        return {};
+    }
+
+    uint64_t InstrumentationProfilerBackend::GetDroppedCount() const
+    {
+        UniqueLock scope{this->m_Lock};
+
+        uint64_t result = 0;
+
+        for (std::unique_ptr<ThreadBuffer> const& thread : this->m_Threads)
+        {
+            result += thread->Dropped.load(std::memory_order::relaxed);
+        }
+
+        return result;
+    }
+
+    auto InstrumentationProfilerBackend::GetThreadBuffer() -> ThreadBuffer&
+    {
+        struct ThreadState final
+        {
+            uint64_t Instance{};
+            ThreadBuffer* Buffer{};
+        };
+
+        static thread_local ThreadState tlsState{};
+
+        if (tlsState.Instance == this->m_Instance) [[likely]]
+        {
+            return *tlsState.Buffer;
+        }
+
+        ThreadId const id = CurrentThread::Id();
+
+        UniqueLock scope{this->m_Lock};
+
+        ThreadBuffer* buffer = nullptr;
+
+        // Thread may have recorded events into this backend while other backend was active.
+        for (std::unique_ptr<ThreadBuffer> const& thread : this->m_Threads)
+        {
+            if (thread->Id == id)
+            {
+                buffer = thread.get();
+                break;
+            }
+        }
+
+        if (buffer == nullptr)
+        {
+            buffer = this->m_Threads.emplace_back(std::make_unique<ThreadBuffer>()).get();
+            buffer->Id = id;
+            buffer->Name = Profiler::GetThreadName();
+        }
+
+        tlsState = ThreadState{
+            .Instance = this->m_Instance,
+            .Buffer = buffer,
+        };
+
+        return *buffer;
+    }
+
+    void InstrumentationProfilerBackend::Record(EventType type, char const* name, uint64_t value, uint64_t size)
+    {
+        ThreadBuffer& buffer = this->GetThreadBuffer();
+
+        switch (type)
+        {
+        case EventType::Begin:
+        case EventType::BeginFrame:
+            buffer.Scopes.push_back(this->Append(buffer, type, name, value, size, false));
+            break;
+
+        case EventType::End:
+        case EventType::EndFrame:
+            if (buffer.Scopes.empty())
+            {
+                // Scope was opened before this backend was installed.
+                break;
+            }
+
+            // End of recorded scope is recorded even past budget, so exported scopes stay balanced; end of dropped
+            // scope is dropped as well.
+            if (buffer.Scopes.back())
+            {
+                this->Append(buffer, type, name, value, size, true);
+            }
+            else
+            {
+                buffer.Dropped.store(buffer.Dropped.load(std::memory_order::relaxed) + 1, std::memory_order::relaxed);
+            }
+
+            buffer.Scopes.pop_back();
+            break;
+
+        default:
+            this->Append(buffer, type, name, value, size, false);
+            break;
+        }
+    }
+
+    bool InstrumentationProfilerBackend::Append(ThreadBuffer& buffer, EventType type, char const* name, uint64_t value, uint64_t size, bool force)
+    {
+        Chunk* chunk = buffer.Tail;
+        size_t count = (chunk != nullptr) ? chunk->Count.load(std::memory_order::relaxed) : this->m_Options.ChunkCapacity;
+
+        if (count == this->m_Options.ChunkCapacity) [[unlikely]]
+        {
+            if ((not force) and (buffer.ChunkCount.load(std::memory_order::relaxed) >= this->m_Options.MaxChunksPerThread))
+            {
+                // Budget is exhausted until next export releases exported chunks.
+                buffer.Dropped.store(buffer.Dropped.load(std::memory_order::relaxed) + 1, std::memory_order::relaxed);
+                return false;
+            }
+
+            Chunk* const next = new Chunk{};
+            next->Events = std::make_unique_for_overwrite<Event[]>(this->m_Options.ChunkCapacity);
+
+            buffer.ChunkCount.fetch_add(1, std::memory_order::relaxed);
+
+            if (chunk != nullptr)
+            {
+                chunk->Next.store(next, std::memory_order::release);
+            }
+            else
+            {
+                buffer.Head.store(next, std::memory_order::release);
+            }
+
+            buffer.Tail = next;
+
+            chunk = next;
+            count = 0;
+        }
+
+        chunk->Events[count] = Event{
+            .Timestamp = ReadTimestampCounter(),
+            .Name = name,
+            .Value = value,
+            .Size = size,
+            .Type = type,
+        };
+
+        chunk->Count.store(count + 1, std::memory_order::release);
+        return true;
+    }
+}
+
+#endif
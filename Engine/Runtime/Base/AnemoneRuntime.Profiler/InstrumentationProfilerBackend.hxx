@@ -0,0 +1,143 @@
+#pragma once
+#include "AnemoneRuntime.Profiler/Profiler.hxx"
+
+#if ANEMONE_BUILD_PROFILING
+
+#include "AnemoneRuntime.Diagnostics/Error.hxx"
+#include "AnemoneRuntime.Base/Instant.hxx"
+#include "AnemoneRuntime.Storage/OutputStream.hxx"
+#include "AnemoneRuntime.Threading/CriticalSection.hxx"
+#include "AnemoneRuntime.Threading/Thread.hxx"
+
+#include <atomic>
+#include <expected>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Anemone
+{
+    struct InstrumentationProfilerOptions final
+    {
+        //! Number of events stored per chunk of thread buffer.
+        size_t ChunkCapacity = 4096;
+
+        //! Maximum number of chunks per thread not yet exported. Events recorded while thread buffer is full are
+        //! dropped; export releases exported chunks.
+        size_t MaxChunksPerThread = 16;
+    };
+
+    //! Built-in profiler backend. Records events with processor timestamps into per-thread buffers and exports them
+    //! in Chrome trace event format, readable by chrome://tracing and Perfetto.
+    //!
+    //! Recording thread only appends to its own buffer; exporting may run concurrently with recording.
+    //! Each export drains recorded events, so thread buffers stay within budget for long sessions.
+    class ANEMONE_RUNTIME_BASE_API InstrumentationProfilerBackend final : public IProfilerBackend
+    {
+    private:
+        enum class EventType : uint32_t
+        {
+            Begin,
+            End,
+            Instant,
+            BeginFrame,
+            EndFrame,
+            IntegerCounter,
+            FloatCounter,
+            Allocate,
+            Free,
+            BeginFlow,
+            EndFlow,
+        };
+
+        struct Event final
+        {
+            uint64_t Timestamp;
+            char const* Name;
+
+            //! Frame index, counter value, address or flow id, depending on event type.
+            uint64_t Value;
+
+            //! Size of allocation.
+            uint64_t Size;
+
+            EventType Type;
+        };
+
+        struct Chunk;
+        struct ThreadBuffer;
+
+        InstrumentationProfilerOptions m_Options{};
+
+        //! Distinguishes backends, so thread local state of destroyed backend is not reused.
+        uint64_t m_Instance{};
+
+        uint64_t m_StartedTicks{};
+        Instant m_Started{};
+
+        std::atomic_uint64_t m_Frame{};
+
+        //! Protects list of threads and their names.
+        mutable CriticalSection m_Lock{};
+        std::vector<std::unique_ptr<ThreadBuffer>> m_Threads{};
+
+    public:
+        explicit InstrumentationProfilerBackend(InstrumentationProfilerOptions const& options = {});
+
+        InstrumentationProfilerBackend(InstrumentationProfilerBackend const&) = delete;
+
+        InstrumentationProfilerBackend(InstrumentationProfilerBackend&&) = delete;
+
+        ~InstrumentationProfilerBackend() override;
+
+        InstrumentationProfilerBackend& operator=(InstrumentationProfilerBackend const&) = delete;
+
+        InstrumentationProfilerBackend& operator=(InstrumentationProfilerBackend&&) = delete;
+
+    public:
+        void BeginFrame() override;
+
+        void EndFrame() override;
+
+        void BeginMarker(ProfilerMarker& marker) override;
+
+        void EndMarker(ProfilerMarker& marker) override;
+
+        void EventMarker(ProfilerMarker& marker) override;
+
+        void SetThreadName(std::string_view name) override;
+
+        void CounterValue(ProfilerCounter<int64_t>& counter, int64_t value) override;
+
+        void CounterValue(ProfilerCounter<double>& counter, double value) override;
+
+        void MemoryAllocate(ProfilerMarker& marker, void const* pointer, size_t size) override;
+
+        void MemoryFree(ProfilerMarker& marker, void const* pointer) override;
+
+        void BeginFlow(ProfilerMarker& marker, uint64_t id) override;
+
+        void EndFlow(ProfilerMarker& marker, uint64_t id) override;
+
+    public:
+        //! Writes events recorded since previous export as Chrome trace event JSON and releases them.
+        //!
+        //! Scopes still running are closed at export time and reopened by next export.
+        std::expected<void, Error> WriteChromeTrace(OutputStream& stream);
+
+        //! Number of events dropped because thread buffers were full.
+        uint64_t GetDroppedCount() const;
+
+    private:
+        ThreadBuffer& GetThreadBuffer();
+
+        void Record(EventType type, char const* name, uint64_t value, uint64_t size = 0);
+
+        //! Appends event to thread buffer. Budget is not checked when forced.
+        //!
+        //! \return False when event was dropped.
+        bool Append(ThreadBuffer& buffer, EventType type, char const* name, uint64_t value, uint64_t size, bool force);
+    };
+}
+
+#endif
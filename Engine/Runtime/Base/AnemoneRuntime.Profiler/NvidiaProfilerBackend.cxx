@@ -2,6 +2,9 @@
 
 #if ANEMONE_BUILD_PROFILING
 
+#include "AnemoneRuntime.Interop/StringBuffer.hxx"
+#include "AnemoneRuntime.Threading/CurrentThread.hxx"
+
 #include <nvtx3/nvToolsExt.h>
 
 namespace Anemone
@@ -55,6 +58,80 @@ namespace Anemone
         attributes.message.ascii = marker.Name();
         nvtxMarkEx(&attributes);
     }
+
+    void NvidiaProfilerBackend::SetThreadName(std::string_view name)
+    {
+        Interop::string_buffer<char, 64> buffer{name};
+        nvtxNameOsThreadA(static_cast<uint32_t>(CurrentThread::Id().Inner), buffer.c_str());
+    }
+
+    // NVTX core API has no counters, memory or flow events. Counters and allocations are reported as marks with
+    // payload; frees and flows are not reported.
+
+    void NvidiaProfilerBackend::CounterValue(ProfilerCounter<int64_t>& counter, int64_t value)
+    {
+        nvtxEventAttributes_t attributes{};
+        attributes.version = NVTX_VERSION;
+        attributes.size = NVTX_EVENT_ATTRIB_STRUCT_SIZE;
+        attributes.category = 0;
+        attributes.colorType = NVTX_COLOR_UNKNOWN;
+        attributes.color = 0;
+        attributes.payloadType = NVTX_PAYLOAD_TYPE_INT64;
+        attributes.payload.llValue = value;
+        attributes.messageType = NVTX_MESSAGE_TYPE_ASCII;
+        attributes.message.ascii = counter.Name();
+        nvtxMarkEx(&attributes);
+    }
+
+    void NvidiaProfilerBackend::CounterValue(ProfilerCounter<double>& counter, double value)
+    {
+        nvtxEventAttributes_t attributes{};
+        attributes.version = NVTX_VERSION;
+        attributes.size = NVTX_EVENT_ATTRIB_STRUCT_SIZE;
+        attributes.category = 0;
+        attributes.colorType = NVTX_COLOR_UNKNOWN;
+        attributes.color = 0;
+        attributes.payloadType = NVTX_PAYLOAD_TYPE_DOUBLE;
+        attributes.payload.dValue = value;
+        attributes.messageType = NVTX_MESSAGE_TYPE_ASCII;
+        attributes.message.ascii = counter.Name();
+        nvtxMarkEx(&attributes);
+    }
+
+    void NvidiaProfilerBackend::MemoryAllocate(ProfilerMarker& marker, void const* pointer, size_t size)
+    {
+        (void)pointer;
+
+        nvtxEventAttributes_t attributes{};
+        attributes.version = NVTX_VERSION;
+        attributes.size = NVTX_EVENT_ATTRIB_STRUCT_SIZE;
+        attributes.category = 0;
+        attributes.colorType = NVTX_COLOR_ARGB;
+        attributes.color = marker.Color();
+        attributes.payloadType = NVTX_PAYLOAD_TYPE_UNSIGNED_INT64;
+        attributes.payload.ullValue = size;
+        attributes.messageType = NVTX_MESSAGE_TYPE_ASCII;
+        attributes.message.ascii = marker.Name();
+        nvtxMarkEx(&attributes);
+    }
+
+    void NvidiaProfilerBackend::MemoryFree(ProfilerMarker& marker, void const* pointer)
+    {
+        (void)marker;
+        (void)pointer;
+    }
+
+    void NvidiaProfilerBackend::BeginFlow(ProfilerMarker& marker, uint64_t id)
+    {
+        (void)marker;
+        (void)id;
+    }
+
+    void NvidiaProfilerBackend::EndFlow(ProfilerMarker& marker, uint64_t id)
+    {
+        (void)marker;
+        (void)id;
+    }
 }
 
 #endif
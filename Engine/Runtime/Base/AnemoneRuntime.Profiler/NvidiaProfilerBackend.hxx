@@ -21,6 +21,20 @@ namespace Anemone
         void EndMarker(ProfilerMarker& marker) override;
 
         void EventMarker(ProfilerMarker& marker) override;
+
+        void SetThreadName(std::string_view name) override;
+
+        void CounterValue(ProfilerCounter<int64_t>& counter, int64_t value) override;
+
+        void CounterValue(ProfilerCounter<double>& counter, double value) override;
+
+        void MemoryAllocate(ProfilerMarker& marker, void const* pointer, size_t size) override;
+
+        void MemoryFree(ProfilerMarker& marker, void const* pointer) override;
+
+        void BeginFlow(ProfilerMarker& marker, uint64_t id) override;
+
+        void EndFlow(ProfilerMarker& marker, uint64_t id) override;
     };
 }
 
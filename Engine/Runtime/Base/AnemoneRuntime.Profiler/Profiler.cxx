@@ -1,8 +1,20 @@
 #include "AnemoneRuntime.Profiler/Profiler.hxx"
+#include "AnemoneRuntime.Profiler/InstrumentationProfilerBackend.hxx"
+#include "AnemoneRuntime.Base/ConsoleFunction.hxx"
 #include "AnemoneRuntime.Base/FNV.hxx"
 #include "AnemoneRuntime.Base/UninitializedObject.hxx"
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
+#include "AnemoneRuntime.Diagnostics/Trace.hxx"
+#include "AnemoneRuntime.Storage/FileOutputStream.hxx"
+#include "AnemoneRuntime.Storage/FilePath.hxx"
+#include "AnemoneRuntime.Storage/FileSystem.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
 #include "AnemoneRuntime.Threading/CriticalSection.hxx"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+
 namespace Anemone::Internal
 {
     extern void InitializeProfiling()
@@ -20,7 +32,7 @@ namespace Anemone
 {
     struct ProfilerStatics final
     {
-        IProfilerBackend* Backend = nullptr;
+        std::atomic<IProfilerBackend*> Backend = nullptr;
 
         static constexpr uint32_t ColorFromProfilerMarker(const char* name)
         {
@@ -30,12 +42,128 @@ namespace Anemone
 
     static ProfilerStatics GProfilerStatics{};
 
+    namespace
+    {
+        UninitializedObject<InstrumentationProfilerBackend> gInstrumentationProfilerBackend{};
+
+        struct ProfilerThreadName final
+        {
+            std::array<char, 64> Buffer{};
+            size_t Length{};
+        };
+
+        thread_local ProfilerThreadName tlsProfilerThreadName{};
+
+        // Writes events recorded by built-in backend as Chrome trace; argument is output path.
+        ConsoleFunction gProfilerDumpFunction{"Profiler.Dump", [](std::string_view args)
+        {
+            if (not gInstrumentationProfilerBackend.IsInitialized())
+            {
+                return;
+            }
+
+            std::string path{args};
+
+            if (path.empty())
+            {
+                path = Environment::GetTemporaryPath();
+                FilePath::PushFragment(path, "Anemone.Profile.json");
+            }
+
+            auto handle = FileSystem::GetPlatformFileSystem().CreateFileWriter(path);
+
+            if (not handle)
+            {
+                AE_TRACE(Error, "Profiler: cannot create '{}': {}", path, handle.error());
+                return;
+            }
+
+            FileOutputStream stream{std::move(*handle)};
+
+            if (auto rc = gInstrumentationProfilerBackend->WriteChromeTrace(stream); not rc)
+            {
+                AE_TRACE(Error, "Profiler: cannot write '{}': {}", path, rc.error());
+                return;
+            }
+
+            AE_TRACE(Information, "Profiler: written '{}', dropped {} events", path, gInstrumentationProfilerBackend->GetDroppedCount());
+        }};
+    }
+
     void Profiler::Initialize()
     {
+        if (not gInstrumentationProfilerBackend.IsInitialized())
+        {
+            gInstrumentationProfilerBackend.Create();
+        }
+
+        // Module is initialized on main thread.
+        Profiler::SetThreadName("Main");
+        Profiler::SetBackend(&*gInstrumentationProfilerBackend);
     }
 
     void Profiler::Finalize()
     {
+        if (GProfilerStatics.Backend.load(std::memory_order::relaxed) == &*gInstrumentationProfilerBackend)
+        {
+            Profiler::SetBackend(nullptr);
+        }
+
+        // Backend is detached but not destroyed. Threads not owned by runtime may still be recording into it,
+        // having loaded backend before it was detached; they have no way to tell when they are done. Memory
+        // is reclaimed with process, and module initialized again keeps recording into the same backend.
+    }
+
+    void Profiler::SetBackend(IProfilerBackend* backend)
+    {
+        if (backend != nullptr)
+        {
+            if (std::string_view const name = Profiler::GetThreadName(); not name.empty())
+            {
+                backend->SetThreadName(name);
+            }
+        }
+
+        GProfilerStatics.Backend.store(backend, std::memory_order::release);
+    }
+
+    IProfilerBackend* Profiler::GetBackend()
+    {
+        return GProfilerStatics.Backend.load(std::memory_order::acquire);
+    }
+
+    void Profiler::BeginFrame()
+    {
+        if (IProfilerBackend* backend = GProfilerStatics.Backend.load(std::memory_order::acquire))
+        {
+            backend->BeginFrame();
+        }
+    }
+
+    void Profiler::EndFrame()
+    {
+        if (IProfilerBackend* backend = GProfilerStatics.Backend.load(std::memory_order::acquire))
+        {
+            backend->EndFrame();
+        }
+    }
+
+    void Profiler::SetThreadName(std::string_view name)
+    {
+        ProfilerThreadName& local = tlsProfilerThreadName;
+        local.Length = std::min(name.size(), local.Buffer.size());
+        std::copy_n(name.data(), local.Length, local.Buffer.data());
+
+        if (IProfilerBackend* backend = GProfilerStatics.Backend.load(std::memory_order::acquire))
+        {
+            backend->SetThreadName(Profiler::GetThreadName());
+        }
+    }
+
+    std::string_view Profiler::GetThreadName()
+    {
+        ProfilerThreadName const& local = tlsProfilerThreadName;
+        return std::string_view{local.Buffer.data(), local.Length};
     }
 
     struct ProfilerMarkerRegistry final
@@ -76,7 +204,7 @@ namespace Anemone
 
     void Profiler::BeginMarker(ProfilerMarker& marker)
     {
-        if (IProfilerBackend* backend = GProfilerStatics.Backend)
+        if (IProfilerBackend* backend = GProfilerStatics.Backend.load(std::memory_order::acquire))
         {
             backend->BeginMarker(marker);
         }
@@ -84,7 +212,7 @@ namespace Anemone
 
     void Profiler::EndMarker(ProfilerMarker& marker)
     {
-        if (IProfilerBackend* backend = GProfilerStatics.Backend)
+        if (IProfilerBackend* backend = GProfilerStatics.Backend.load(std::memory_order::acquire))
         {
             backend->EndMarker(marker);
         }
@@ -92,11 +220,90 @@ namespace Anemone
 
     void Profiler::EventMarker(ProfilerMarker& marker)
     {
-        if (IProfilerBackend* backend = GProfilerStatics.Backend)
+        if (IProfilerBackend* backend = GProfilerStatics.Backend.load(std::memory_order::acquire))
         {
             backend->EventMarker(marker);
         }
     }
+
+    template <typename T>
+    void Profiler::SetCounterValue(ProfilerCounter<T>& counter, T value)
+    {
+        AE_ASSERT(counter.m_mode == ProfilerCounterMode::Instantaneous);
+
+        counter.m_value.store(value, std::memory_order::relaxed);
+
+        if (IProfilerBackend* backend = GProfilerStatics.Backend.load(std::memory_order::acquire))
+        {
+            backend->CounterValue(counter, value);
+        }
+    }
+
+    template <typename T>
+    void Profiler::AddCounterDelta(ProfilerCounter<T>& counter, T delta)
+    {
+        AE_ASSERT(counter.m_mode == ProfilerCounterMode::Cumulative);
+
+        // Total is maintained even without backend, so backend installed later reports correct values.
+        T const total = counter.m_value.fetch_add(delta, std::memory_order::relaxed) + delta;
+
+        if (IProfilerBackend* backend = GProfilerStatics.Backend.load(std::memory_order::acquire))
+        {
+            backend->CounterValue(counter, total);
+        }
+    }
+
+    void Profiler::SetCounter(ProfilerCounter<int64_t>& counter, int64_t value)
+    {
+        SetCounterValue(counter, value);
+    }
+
+    void Profiler::SetCounter(ProfilerCounter<double>& counter, double value)
+    {
+        SetCounterValue(counter, value);
+    }
+
+    void Profiler::AddCounter(ProfilerCounter<int64_t>& counter, int64_t delta)
+    {
+        AddCounterDelta(counter, delta);
+    }
+
+    void Profiler::AddCounter(ProfilerCounter<double>& counter, double delta)
+    {
+        AddCounterDelta(counter, delta);
+    }
+
+    void Profiler::MemoryAllocate(ProfilerMarker& marker, void const* pointer, size_t size)
+    {
+        if (IProfilerBackend* backend = GProfilerStatics.Backend.load(std::memory_order::acquire))
+        {
+            backend->MemoryAllocate(marker, pointer, size);
+        }
+    }
+
+    void Profiler::MemoryFree(ProfilerMarker& marker, void const* pointer)
+    {
+        if (IProfilerBackend* backend = GProfilerStatics.Backend.load(std::memory_order::acquire))
+        {
+            backend->MemoryFree(marker, pointer);
+        }
+    }
+
+    void Profiler::BeginFlow(ProfilerMarker& marker, uint64_t id)
+    {
+        if (IProfilerBackend* backend = GProfilerStatics.Backend.load(std::memory_order::acquire))
+        {
+            backend->BeginFlow(marker, id);
+        }
+    }
+
+    void Profiler::EndFlow(ProfilerMarker& marker, uint64_t id)
+    {
+        if (IProfilerBackend* backend = GProfilerStatics.Backend.load(std::memory_order::acquire))
+        {
+            backend->EndFlow(marker, id);
+        }
+    }
 }
 
 namespace Anemone
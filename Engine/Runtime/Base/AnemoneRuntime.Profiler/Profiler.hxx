@@ -3,6 +3,11 @@
 #include "AnemoneRuntime.Base/Intrusive.hxx"
 #include "AnemoneRuntime.Base/FunctionRef.hxx"
 
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
 #if ANEMONE_BUILD_PROFILING
 
 // Profiler system design:
@@ -24,6 +29,19 @@ namespace Anemone
 
     class ProfilerMarker;
 
+    enum class ProfilerCounterMode
+    {
+        //! Each reported value is current value of counter, e.g. queue depth.
+        Instantaneous,
+
+        //! Counter accumulates reported deltas; backends receive running total, e.g. bytes allocated so far.
+        Cumulative,
+    };
+
+    //! Counter plotted on profiler timeline. Value type is either int64_t or double.
+    template <typename T>
+    class ProfilerCounter;
+
     class IProfilerBackend
     {
     public:
@@ -36,6 +54,21 @@ namespace Anemone
         virtual void EndMarker(ProfilerMarker& marker) = 0;
 
         virtual void EventMarker(ProfilerMarker& marker) = 0;
+
+        //! Called on thread which is being named.
+        virtual void SetThreadName(std::string_view name) = 0;
+
+        //! Reports value of counter; for cumulative counters this is running total.
+        virtual void CounterValue(ProfilerCounter<int64_t>& counter, int64_t value) = 0;
+        virtual void CounterValue(ProfilerCounter<double>& counter, double value) = 0;
+
+        virtual void MemoryAllocate(ProfilerMarker& marker, void const* pointer, size_t size) = 0;
+        virtual void MemoryFree(ProfilerMarker& marker, void const* pointer) = 0;
+
+        //! Flow links point where work was issued with point where it is executed, possibly on other thread.
+        //! Flow is attached to innermost marker scope active on thread at begin and end.
+        virtual void BeginFlow(ProfilerMarker& marker, uint64_t id) = 0;
+        virtual void EndFlow(ProfilerMarker& marker, uint64_t id) = 0;
     };
 
     struct Profiler final
@@ -43,6 +76,17 @@ namespace Anemone
         ANEMONE_RUNTIME_BASE_API static void Initialize();
         ANEMONE_RUNTIME_BASE_API static void Finalize();
 
+        //! Replaces active backend. Backend must stay alive while profiled code may still call it.
+        ANEMONE_RUNTIME_BASE_API static void SetBackend(IProfilerBackend* backend);
+        ANEMONE_RUNTIME_BASE_API static IProfilerBackend* GetBackend();
+
+        ANEMONE_RUNTIME_BASE_API static void BeginFrame();
+        ANEMONE_RUNTIME_BASE_API static void EndFrame();
+
+        //! Names current thread in profiles. Name is remembered, so backends installed later see it too.
+        ANEMONE_RUNTIME_BASE_API static void SetThreadName(std::string_view name);
+        ANEMONE_RUNTIME_BASE_API static std::string_view GetThreadName();
+
         ANEMONE_RUNTIME_BASE_API static void RegisterMarker(ProfilerMarker& marker);
         ANEMONE_RUNTIME_BASE_API static void UnregisterMarker(ProfilerMarker& marker);
         ANEMONE_RUNTIME_BASE_API static void EnumerateMarkers(FunctionRef<void(ProfilerMarker& marker)> callback);
@@ -50,6 +94,27 @@ namespace Anemone
         ANEMONE_RUNTIME_BASE_API static void BeginMarker(ProfilerMarker& marker);
         ANEMONE_RUNTIME_BASE_API static void EndMarker(ProfilerMarker& marker);
         ANEMONE_RUNTIME_BASE_API static void EventMarker(ProfilerMarker& marker);
+
+        //! Sets value of instantaneous counter.
+        ANEMONE_RUNTIME_BASE_API static void SetCounter(ProfilerCounter<int64_t>& counter, int64_t value);
+        ANEMONE_RUNTIME_BASE_API static void SetCounter(ProfilerCounter<double>& counter, double value);
+
+        //! Adds delta to cumulative counter.
+        ANEMONE_RUNTIME_BASE_API static void AddCounter(ProfilerCounter<int64_t>& counter, int64_t delta);
+        ANEMONE_RUNTIME_BASE_API static void AddCounter(ProfilerCounter<double>& counter, double delta);
+
+        ANEMONE_RUNTIME_BASE_API static void MemoryAllocate(ProfilerMarker& marker, void const* pointer, size_t size);
+        ANEMONE_RUNTIME_BASE_API static void MemoryFree(ProfilerMarker& marker, void const* pointer);
+
+        ANEMONE_RUNTIME_BASE_API static void BeginFlow(ProfilerMarker& marker, uint64_t id);
+        ANEMONE_RUNTIME_BASE_API static void EndFlow(ProfilerMarker& marker, uint64_t id);
+
+    private:
+        template <typename T>
+        static void SetCounterValue(ProfilerCounter<T>& counter, T value);
+
+        template <typename T>
+        static void AddCounterDelta(ProfilerCounter<T>& counter, T delta);
     };
 
     class ANEMONE_RUNTIME_BASE_API ProfilerMarker final
@@ -87,6 +152,47 @@ namespace Anemone
         }
     };
 
+    template <typename T>
+    class ProfilerCounter final
+    {
+        static_assert(std::is_same_v<T, int64_t> or std::is_same_v<T, double>);
+
+        friend struct Profiler;
+
+    private:
+        const char* m_name{};
+        ProfilerCounterMode m_mode{};
+        std::atomic<T> m_value{};
+
+    public:
+        explicit ProfilerCounter(const char* name, ProfilerCounterMode mode)
+            : m_name{name}
+            , m_mode{mode}
+        {
+        }
+
+        ProfilerCounter(ProfilerCounter const&) = delete;
+        ProfilerCounter(ProfilerCounter&&) = delete;
+        ProfilerCounter& operator=(ProfilerCounter const&) = delete;
+        ProfilerCounter& operator=(ProfilerCounter&&) = delete;
+        ~ProfilerCounter() = default;
+
+        const char* Name() const
+        {
+            return this->m_name;
+        }
+
+        ProfilerCounterMode Mode() const
+        {
+            return this->m_mode;
+        }
+
+        T Value() const
+        {
+            return this->m_value.load(std::memory_order::relaxed);
+        }
+    };
+
     class ProfilerScope final
     {
     private:
@@ -125,11 +231,41 @@ namespace Anemone
 #define AE_PROFILE_EVENT(name) \
     Anemone::Profiler::EventMarker(GProfilerMarker_##name);
 
+// Declares counter; type is int64_t or double, mode is Instantaneous or Cumulative.
+#define AE_DECLARE_PROFILE_COUNTER(name, type, mode) \
+    Anemone::ProfilerCounter<type> GProfilerCounter_##name { #name, Anemone::ProfilerCounterMode::mode }
+
+#define AE_PROFILE_COUNTER_SET(name, value) \
+    Anemone::Profiler::SetCounter(GProfilerCounter_##name, value)
+
+#define AE_PROFILE_COUNTER_ADD(name, delta) \
+    Anemone::Profiler::AddCounter(GProfilerCounter_##name, delta)
+
+#define AE_PROFILE_ALLOCATE(name, pointer, size) \
+    Anemone::Profiler::MemoryAllocate(GProfilerMarker_##name, pointer, size)
+
+#define AE_PROFILE_FREE(name, pointer) \
+    Anemone::Profiler::MemoryFree(GProfilerMarker_##name, pointer)
+
+#define AE_PROFILE_FLOW_BEGIN(name, id) \
+    Anemone::Profiler::BeginFlow(GProfilerMarker_##name, id)
+
+#define AE_PROFILE_FLOW_END(name, id) \
+    Anemone::Profiler::EndFlow(GProfilerMarker_##name, id)
+
 #else
 
+// Arguments are not evaluated when profiling is compiled out.
 #define AE_DECLARE_PROFILE(name)
 #define AE_PROFILE_SCOPE(name)
 #define AE_PROFILE_EVENT(name)
+#define AE_DECLARE_PROFILE_COUNTER(name, type, mode)
+#define AE_PROFILE_COUNTER_SET(name, value)
+#define AE_PROFILE_COUNTER_ADD(name, delta)
+#define AE_PROFILE_ALLOCATE(name, pointer, size)
+#define AE_PROFILE_FREE(name, pointer)
+#define AE_PROFILE_FLOW_BEGIN(name, id)
+#define AE_PROFILE_FLOW_END(name, id)
 
 #endif
 
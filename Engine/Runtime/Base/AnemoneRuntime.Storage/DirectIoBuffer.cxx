@@ -0,0 +1,32 @@
+#include "AnemoneRuntime.Storage/DirectIoBuffer.hxx"
+#include "AnemoneRuntime.System/SystemAllocator.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
+#include "AnemoneRuntime.Base/Bitwise.hxx"
+
+namespace Anemone
+{
+    DirectIoBuffer::DirectIoBuffer(size_t size)
+    {
+        if (size != 0)
+        {
+            this->m_Capacity = AlignUp(size, GetAlignment());
+            this->m_Data = static_cast<std::byte*>(SystemAllocator::ReserveAndCommit(this->m_Capacity, true, false));
+        }
+    }
+
+    size_t DirectIoBuffer::GetAlignment()
+    {
+        static size_t const alignment = static_cast<size_t>(Environment::GetMemoryProperties().SystemAllocationGranularity);
+        return alignment;
+    }
+
+    void DirectIoBuffer::Release()
+    {
+        if (this->m_Data != nullptr)
+        {
+            SystemAllocator::DecommitAndRelease(this->m_Data, this->m_Capacity);
+            this->m_Data = nullptr;
+            this->m_Capacity = 0;
+        }
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace Anemone
+{
+    //! Buffer suitable for unbuffered file I/O.
+    //!
+    //! Memory is allocated directly from system allocator, so its address and capacity are aligned to allocation
+    //! granularity, which satisfies sector alignment required by storage devices.
+    class ANEMONE_RUNTIME_BASE_API DirectIoBuffer final
+    {
+    private:
+        std::byte* m_Data{};
+        size_t m_Capacity{};
+
+    public:
+        DirectIoBuffer() = default;
+
+        //! Allocates buffer of at least given size.
+        explicit DirectIoBuffer(size_t size);
+
+        DirectIoBuffer(DirectIoBuffer const&) = delete;
+
+        DirectIoBuffer(DirectIoBuffer&& other) noexcept
+            : m_Data{std::exchange(other.m_Data, nullptr)}
+            , m_Capacity{std::exchange(other.m_Capacity, 0)}
+        {
+        }
+
+        DirectIoBuffer& operator=(DirectIoBuffer const&) = delete;
+
+        DirectIoBuffer& operator=(DirectIoBuffer&& other) noexcept
+        {
+            if (this != &other)
+            {
+                this->Release();
+                this->m_Data = std::exchange(other.m_Data, nullptr);
+                this->m_Capacity = std::exchange(other.m_Capacity, 0);
+            }
+
+            return *this;
+        }
+
+        ~DirectIoBuffer()
+        {
+            this->Release();
+        }
+
+    public:
+        [[nodiscard]] std::byte* GetData() const
+        {
+            return this->m_Data;
+        }
+
+        [[nodiscard]] size_t GetCapacity() const
+        {
+            return this->m_Capacity;
+        }
+
+        [[nodiscard]] std::span<std::byte> GetView() const
+        {
+            return std::span{this->m_Data, this->m_Capacity};
+        }
+
+        [[nodiscard]] explicit operator bool() const
+        {
+            return this->m_Data != nullptr;
+        }
+
+        //! Gets alignment of every buffer address and capacity.
+        static size_t GetAlignment();
+
+    private:
+        void Release();
+    };
+
+    //! Range of file expanded to alignment required by unbuffered file I/O.
+    struct DirectIoRange final
+    {
+        //! Aligned file offset where request starts.
+        uint64_t Position;
+
+        //! Offset of requested data in aligned range.
+        size_t Offset;
+
+        //! Aligned length of request.
+        size_t Length;
+
+        [[nodiscard]] static constexpr DirectIoRange Create(uint64_t position, size_t length, size_t alignment)
+        {
+            uint64_t const start = position & ~static_cast<uint64_t>(alignment - 1);
+            size_t const offset = static_cast<size_t>(position - start);
+            size_t const aligned = (offset + length + alignment - 1) & ~(alignment - 1);
+            return DirectIoRange{start, offset, aligned};
+        }
+    };
+}
@@ -1 +1,9 @@
 #include "AnemoneRuntime.Storage/FileHandle.hxx"
+
+namespace Anemone
+{
+    size_t FileHandle::GetIoAlignment() const
+    {
+        return 1;
+    }
+}
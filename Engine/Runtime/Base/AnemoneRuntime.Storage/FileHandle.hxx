@@ -35,6 +35,10 @@ namespace Anemone
         RandomAccess = 1u << 4u,
         SequentialScan = 1u << 5u,
         WriteThrough = 1u << 6u,
+
+        //! Bypasses page cache. Reads at unaligned offsets or lengths are aligned by handle; writes must be aligned
+        //! to FileHandle::GetIoAlignment(). Falls back to dropping cached pages after each request when file system
+        //! does not support unbuffered I/O. Not supported on Windows; opening file fails with Error::NotSupported.
         NoBuffering = 1u << 7u,
         ShareDelete = 1u << 8u,
         Temporary = 1u << 9u,
@@ -73,5 +77,9 @@ namespace Anemone
         virtual std::expected<size_t, Error> Write(std::span<std::byte const> buffer) = 0;
 
         virtual std::expected<size_t, Error> WriteAt(std::span<std::byte const> buffer, uint64_t position) = 0;
+
+        //! Gets alignment of buffer addresses, file offsets and lengths required for requests to bypass page cache.
+        //! Handles opened without FileOption::NoBuffering have no requirements.
+        virtual size_t GetIoAlignment() const;
     };
 }
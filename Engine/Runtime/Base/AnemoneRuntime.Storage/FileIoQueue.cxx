@@ -0,0 +1,177 @@
+#include "AnemoneRuntime.Storage/FileIoQueue.hxx"
+#include "AnemoneRuntime.Storage/ThreadPoolFileIoQueue.hxx"
+#include "AnemoneRuntime.Tasks/TaskScheduler.hxx"
+#include "AnemoneRuntime.Threading/Lock.hxx"
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
+
+#include <algorithm>
+
+namespace Anemone
+{
+    namespace
+    {
+        // Executes completion callback of request on scheduler worker.
+        class FileIoCompletionTask final : public Task
+        {
+        private:
+            FileIoCompletion m_Completion;
+            std::expected<size_t, Error> m_Result;
+
+        public:
+            FileIoCompletionTask(FileIoCompletion completion, std::expected<size_t, Error> result)
+                : m_Completion{std::move(completion)}
+                , m_Result{result}
+            {
+            }
+
+        protected:
+            void OnExecute() override
+            {
+                this->m_Completion(this->m_Result);
+            }
+        };
+
+        // Awaiter which never has any dependencies. Used for tasks which are ready to run immediately.
+        TaskAwaiterHandle const& GetCompletedAwaiter()
+        {
+            static TaskAwaiterHandle const instance = MakeReference<TaskAwaiter>();
+            return instance;
+        }
+
+        constexpr TaskPriority ToTaskPriority(FileIoPriority priority)
+        {
+            switch (priority)
+            {
+            case FileIoPriority::High:
+                return TaskPriority::High;
+
+            case FileIoPriority::Normal:
+                return TaskPriority::Normal;
+
+            case FileIoPriority::Low:
+                return TaskPriority::Low;
+            }
+
+            return TaskPriority::Normal;
+        }
+    }
+
+    FileIoQueue::FileIoQueue(TaskScheduler& scheduler, uint32_t queueDepth)
+        : m_Scheduler{scheduler}
+        , m_QueueDepth{std::max<uint32_t>(queueDepth, 1)}
+    {
+    }
+
+    FileIoQueue::~FileIoQueue()
+    {
+        // Backends drain queue before their threads exit.
+        for (std::deque<Operation*> const& pending : this->m_Pending)
+        {
+            AE_ASSERT(pending.empty());
+        }
+    }
+
+    std::unique_ptr<FileIoQueue> FileIoQueue::CreateThreadPool(TaskScheduler& scheduler, FileIoQueueOptions const& options)
+    {
+        return std::make_unique<ThreadPoolFileIoQueue>(scheduler, options);
+    }
+
+    TaskAwaiterHandle FileIoQueue::Submit(std::span<FileIoRequest> requests)
+    {
+        TaskAwaiterHandle result = MakeReference<TaskAwaiter>();
+
+        if (requests.empty())
+        {
+            return result;
+        }
+
+        // Keep awaiter incomplete until last request of batch completes.
+        result->AddDependency();
+
+        Batch* const batch = new Batch{
+            .Operations = {},
+            .Awaiter = result,
+            .Remaining = requests.size(),
+        };
+
+        batch->Operations.reserve(requests.size());
+
+        for (FileIoRequest& request : requests)
+        {
+            AE_ASSERT(request.File);
+            batch->Operations.push_back(Operation{
+                .Request = std::move(request),
+                .Owner = batch,
+            });
+        }
+
+        {
+            UniqueLock scope{this->m_Lock};
+
+            for (Operation& operation : batch->Operations)
+            {
+                this->m_Pending[static_cast<size_t>(operation.Request.Priority)].push_back(&operation);
+            }
+        }
+
+        this->OnSubmitted(requests.size());
+
+        return result;
+    }
+
+    size_t FileIoQueue::Dequeue(std::span<Operation*> operations)
+    {
+        size_t count = 0;
+
+        UniqueLock scope{this->m_Lock};
+
+        for (std::deque<Operation*>& pending : this->m_Pending)
+        {
+            while ((count < operations.size()) and not pending.empty())
+            {
+                operations[count++] = pending.front();
+                pending.pop_front();
+            }
+        }
+
+        return count;
+    }
+
+    void FileIoQueue::Complete(Operation& operation, std::expected<size_t, Error> result)
+    {
+        Batch& batch = *operation.Owner;
+        TaskPriority const priority = ToTaskPriority(operation.Request.Priority);
+
+        if (operation.Request.Completion)
+        {
+            TaskHandle const task = MakeReference<FileIoCompletionTask>(std::move(operation.Request.Completion), result);
+            this->m_Scheduler.Schedule(*task, batch.Awaiter, GetCompletedAwaiter(), priority);
+        }
+
+        operation.Request.File = {};
+
+        if (batch.Remaining.fetch_sub(1, std::memory_order::acq_rel) == 1)
+        {
+            // Completion tasks of all requests were scheduled already; batch is no longer used.
+            TaskAwaiterHandle const awaiter = std::move(batch.Awaiter);
+            delete &batch;
+
+            // Release dependency added in Submit through scheduler, so tasks waiting for batch get dispatched.
+            this->m_Scheduler.ReleaseDependency(awaiter);
+        }
+    }
+
+    std::expected<size_t, Error> FileIoQueue::Execute(FileIoRequest const& request)
+    {
+        switch (request.Operation)
+        {
+        case FileIoOperation::Read:
+            return request.File->ReadAt(request.Buffer, request.Position);
+
+        case FileIoOperation::Write:
+            return request.File->WriteAt(request.Buffer, request.Position);
+        }
+
+        return std::unexpected(Error::InvalidArgument);
+    }
+}
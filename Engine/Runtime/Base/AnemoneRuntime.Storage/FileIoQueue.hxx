@@ -0,0 +1,144 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+#include "AnemoneRuntime.Storage/FileHandle.hxx"
+#include "AnemoneRuntime.Tasks/Task.hxx"
+#include "AnemoneRuntime.Threading/Spinlock.hxx"
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Anemone
+{
+    class TaskScheduler;
+
+    enum class FileIoOperation : uint8_t
+    {
+        Read,
+        Write,
+    };
+
+    //! Priority class of request. Pending requests of higher class are issued to storage first.
+    enum class FileIoPriority : uint8_t
+    {
+        High,
+        Normal,
+        Low,
+    };
+
+    inline constexpr size_t FileIoPriorityCount = static_cast<size_t>(FileIoPriority::Low) + 1;
+
+    //! Receives number of bytes transferred by request.
+    using FileIoCompletion = std::function<void(std::expected<size_t, Error> result)>;
+
+    struct FileIoRequest final
+    {
+        FileIoOperation Operation{FileIoOperation::Read};
+
+        //! File is kept alive until request completes.
+        Reference<FileHandle> File{};
+
+        uint64_t Position{};
+
+        //! Buffer must stay valid until request completes. Write requests only read from it.
+        std::span<std::byte> Buffer{};
+
+        FileIoPriority Priority{FileIoPriority::Normal};
+
+        //! Optional callback, executed as task on scheduler with priority matching request.
+        FileIoCompletion Completion{};
+    };
+
+    struct FileIoQueueOptions final
+    {
+        //! Maximum number of requests issued to storage at the same time. Remaining requests wait in queue.
+        uint32_t QueueDepth{64};
+
+        //! Number of threads used by thread pool backend.
+        uint32_t ThreadCount{4};
+
+        //! Uses thread pool backend even when platform provides native asynchronous I/O.
+        bool ForceThreadPool{false};
+    };
+
+    //! Asynchronous file I/O, submitted in batches.
+    //!
+    //! Each batch returns awaiter, which completes after every request in batch completed and its completion
+    //! callback executed. Awaiter may be waited on or used as dependency of tasks and coroutines.
+    class ANEMONE_RUNTIME_BASE_API FileIoQueue
+    {
+    protected:
+        struct Batch;
+
+        struct Operation final
+        {
+            FileIoRequest Request;
+            Batch* Owner;
+        };
+
+        struct Batch final
+        {
+            std::vector<Operation> Operations;
+            TaskAwaiterHandle Awaiter;
+            std::atomic_size_t Remaining;
+        };
+
+    private:
+        TaskScheduler& m_Scheduler;
+        uint32_t m_QueueDepth{};
+        Spinlock m_Lock{};
+        std::array<std::deque<Operation*>, FileIoPriorityCount> m_Pending{};
+
+    protected:
+        FileIoQueue(TaskScheduler& scheduler, uint32_t queueDepth);
+
+    public:
+        FileIoQueue(FileIoQueue const&) = delete;
+        FileIoQueue(FileIoQueue&&) = delete;
+        FileIoQueue& operator=(FileIoQueue const&) = delete;
+        FileIoQueue& operator=(FileIoQueue&&) = delete;
+
+        //! Waits for all submitted requests to complete.
+        virtual ~FileIoQueue();
+
+    public:
+        //! Creates queue backed by native asynchronous I/O of platform, or by thread pool when not available.
+        static std::unique_ptr<FileIoQueue> Create(TaskScheduler& scheduler, FileIoQueueOptions const& options = {});
+
+        //! Creates queue backed by thread pool performing blocking reads and writes.
+        static std::unique_ptr<FileIoQueue> CreateThreadPool(TaskScheduler& scheduler, FileIoQueueOptions const& options = {});
+
+        //! Submits batch of requests. Requests are moved from.
+        TaskAwaiterHandle Submit(std::span<FileIoRequest> requests);
+
+        TaskAwaiterHandle Submit(FileIoRequest request)
+        {
+            return this->Submit(std::span{&request, 1});
+        }
+
+        uint32_t GetQueueDepth() const
+        {
+            return this->m_QueueDepth;
+        }
+
+        virtual std::string_view GetBackendName() const = 0;
+
+    protected:
+        //! Signals backend that requests were queued.
+        virtual void OnSubmitted(size_t count) = 0;
+
+        //! Takes pending requests, highest priority first.
+        size_t Dequeue(std::span<Operation*> operations);
+
+        //! Schedules completion callback and completes batch awaiter after its last request.
+        void Complete(Operation& operation, std::expected<size_t, Error> result);
+
+        //! Executes request with blocking read or write.
+        static std::expected<size_t, Error> Execute(FileIoRequest const& request);
+    };
+}
@@ -1,6 +1,10 @@
 #include "AnemoneRuntime.Storage/FileSystem.hxx"
+#include "AnemoneRuntime.Storage/FilePath.hxx"
+#include "AnemoneRuntime.Tasks/Parallel.hxx"
 #include "AnemoneRuntime.Diagnostics/Debug.hxx"
 
+#include <atomic>
+
 namespace Anemone
 {
     auto FileSystem::ReadTextFile(
@@ -220,4 +224,107 @@ namespace Anemone
             }
         }
     }
+
+    auto FileSystem::DirectoryCopyRecursive(
+        std::string_view source,
+        std::string_view destination,
+        NameCollisionResolve nameCollisionResolve)
+        -> std::expected<void, Error>
+    {
+        // Collects paths relative to source directory. Parent directories are visited before their content.
+        class TreeVisitor final : public FileSystemVisitor
+        {
+        public:
+            std::string_view Root;
+            std::vector<std::string> Directories{};
+            std::vector<std::string> Files{};
+
+            explicit TreeVisitor(std::string_view root)
+                : Root{root}
+            {
+            }
+
+            void Visit(std::string_view path, std::string_view name, FileInfo const& info) override
+            {
+                std::string relative{path.substr(std::min(this->Root.size(), path.size()))};
+                FilePath::PushFragment(relative, name);
+
+                // Strip separator left after root.
+                relative.erase(0, relative.find_first_not_of("/\\"));
+
+                if (info.Type == FileType::Directory)
+                {
+                    this->Directories.push_back(std::move(relative));
+                }
+                else if (info.Type == FileType::File)
+                {
+                    this->Files.push_back(std::move(relative));
+                }
+            }
+        };
+
+        TreeVisitor visitor{source};
+
+        if (auto enumerated = this->DirectoryEnumerateRecursive(source, visitor); not enumerated)
+        {
+            return std::unexpected(enumerated.error());
+        }
+
+        auto makeTarget = [](std::string_view root, std::string_view relative)
+        {
+            std::string result{root};
+            FilePath::PushFragment(result, relative);
+            return result;
+        };
+
+        if (not this->DirectoryExists(destination))
+        {
+            if (auto created = this->DirectoryCreateRecursive(destination); not created)
+            {
+                return std::unexpected(created.error());
+            }
+        }
+
+        for (std::string const& directory : visitor.Directories)
+        {
+            std::string const target = makeTarget(destination, directory);
+
+            if (not this->DirectoryExists(target))
+            {
+                if (auto created = this->DirectoryCreate(target); not created)
+                {
+                    return std::unexpected(created.error());
+                }
+            }
+        }
+
+        // Copies are mostly waiting for storage; keep all workers busy with single file each.
+        std::atomic<Error> error{Error::Success};
+
+        Parallel::For(visitor.Files.size(), 1, [&](size_t index, size_t count)
+        {
+            for (size_t i = index; i < (index + count); ++i)
+            {
+                if (error.load(std::memory_order::relaxed) != Error::Success)
+                {
+                    return;
+                }
+
+                std::string const& file = visitor.Files[i];
+
+                if (auto copied = this->FileCopy(makeTarget(source, file), makeTarget(destination, file), nameCollisionResolve); not copied)
+                {
+                    Error expected = Error::Success;
+                    error.compare_exchange_strong(expected, copied.error(), std::memory_order::relaxed);
+                }
+            }
+        });
+
+        if (Error const result = error.load(std::memory_order::relaxed); result != Error::Success)
+        {
+            return std::unexpected(result);
+        }
+
+        return {};
+    }
 }
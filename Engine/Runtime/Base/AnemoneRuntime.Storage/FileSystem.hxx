@@ -80,11 +80,13 @@ namespace Anemone
 
     public:
         virtual auto CreateFileReader(
-            std::string_view path)
+            std::string_view path,
+            Flags<FileOption> options = FileOption::None)
             -> std::expected<Reference<FileHandle>, Error> = 0;
 
         virtual auto CreateFileWriter(
-            std::string_view path)
+            std::string_view path,
+            Flags<FileOption> options = FileOption::None)
             -> std::expected<Reference<FileHandle>, Error> = 0;
 
         virtual auto ReadTextFile(
@@ -153,6 +155,13 @@ namespace Anemone
             std::string_view path)
             -> std::expected<void, Error> = 0;
 
+        //! Copies directory tree. Directories are created first; files are copied in parallel on task scheduler.
+        virtual auto DirectoryCopyRecursive(
+            std::string_view source,
+            std::string_view destination,
+            NameCollisionResolve nameCollisionResolve)
+            -> std::expected<void, Error>;
+
         virtual auto DirectoryEnumerate(
             std::string_view path,
             FileSystemVisitor& visitor)
@@ -14,6 +14,27 @@ namespace Anemone
         ReadWriteExecute,
     };
 
+    //! Hints applied to memory mapped file view when it is created.
+    enum class MemoryMappedFileViewOption : uint32_t
+    {
+        None = 0u,
+
+        //! Reads whole view into memory before CreateView returns.
+        Populate = 1u << 0u,
+
+        //! View is accessed in order; enables aggressive read-ahead.
+        SequentialAccess = 1u << 1u,
+
+        //! View is accessed randomly; disables read-ahead.
+        RandomAccess = 1u << 2u,
+
+        //! Starts asynchronous read of whole view.
+        WillNeed = 1u << 3u,
+
+        //! Backs view with huge pages where platform and file system support it.
+        HugePages = 1u << 4u,
+    };
+
     class MemoryMappedFileView;
 
     class ANEMONE_RUNTIME_BASE_API MemoryMappedFile : public ReferenceCounted<MemoryMappedFile>
@@ -41,7 +62,8 @@ namespace Anemone
         virtual Reference<MemoryMappedFileView> CreateView(
             MemoryMappedFileAccess access,
             size_t offset = 0,
-            size_t length = 0) = 0;
+            size_t length = 0,
+            Flags<MemoryMappedFileViewOption> options = MemoryMappedFileViewOption::None) = 0;
 
         virtual void Flush() = 0;
     };
@@ -67,5 +89,8 @@ namespace Anemone
         virtual std::span<std::byte> GetData() = 0;
 
         virtual void Flush() = 0;
+
+        //! Starts asynchronous read of range of view into memory. Returns without waiting for read to complete.
+        virtual void Prefetch(size_t offset, size_t length) = 0;
     };
 }
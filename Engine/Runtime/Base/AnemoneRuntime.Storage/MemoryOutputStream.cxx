@@ -32,17 +32,18 @@ namespace Anemone
             // Make sure that memory buffer is large enough.
             size_t const newSize = this->_position + data.size();
 
-            if (auto rc = this->_buffer->Resize(newSize))
+            if (newSize > this->_buffer->GetSize())
             {
-                // Resized successfully. Copy data into buffer.
-                std::copy_n(data.data(), data.size(), this->_buffer->GetData() + this->_position);
-                return data.size();
-            }
-            else
-            {
-                // Cannot resize buffer.
-                return std::unexpected(rc.error());
+                if (auto rc = this->_buffer->Resize(newSize); not rc)
+                {
+                    // Cannot resize buffer.
+                    return std::unexpected(rc.error());
+                }
             }
+
+            std::copy_n(data.data(), data.size(), this->_buffer->GetData() + this->_position);
+            this->_position = newSize;
+            return data.size();
         }
 
         return 0;
@@ -0,0 +1,677 @@
+#include "AnemoneRuntime.Storage/PackageFileSystem.hxx"
+#include "AnemoneRuntime.Storage/FilePath.hxx"
+#include "AnemoneRuntime.Base/Compression.hxx"
+#include "AnemoneRuntime.Threading/CriticalSection.hxx"
+#include "AnemoneRuntime.Threading/Lock.hxx"
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
+
+#include <cstring>
+#include <limits>
+
+namespace Anemone
+{
+    namespace
+    {
+        bool IsRangeValid(std::span<std::byte const> data, uint64_t offset, uint64_t size)
+        {
+            return (offset <= data.size()) and (size <= (data.size() - offset));
+        }
+
+        template <typename T>
+        std::span<T const> GetTable(std::span<std::byte const> data, uint64_t offset, uint64_t count)
+        {
+            return std::span{reinterpret_cast<T const*>(data.data() + offset), static_cast<size_t>(count)};
+        }
+
+        class PackageFileHandle final : public FileHandle
+        {
+        private:
+            Reference<MemoryMappedFileView> m_View;
+            std::span<std::byte const> m_Data;
+            std::span<PackageBlock const> m_Blocks;
+            uint64_t m_Size;
+            uint32_t m_BlockSize;
+            uint64_t m_Position{};
+
+            //! Last block decompressed for reads not covering whole block.
+            CriticalSection m_CacheLock{};
+            std::unique_ptr<std::byte[]> m_Cache{};
+            size_t m_CachedBlock{std::numeric_limits<size_t>::max()};
+
+        public:
+            PackageFileHandle(Reference<MemoryMappedFileView> view, std::span<PackageBlock const> blocks, uint64_t size, uint32_t blockSize)
+                : m_View{std::move(view)}
+                , m_Data{this->m_View->GetData()}
+                , m_Blocks{blocks}
+                , m_Size{size}
+                , m_BlockSize{blockSize}
+            {
+            }
+
+            std::expected<void, Error> Flush() override
+            {
+                return {};
+            }
+
+            std::expected<uint64_t, Error> GetLength() const override
+            {
+                return this->m_Size;
+            }
+
+            std::expected<void, Error> SetLength(uint64_t length) override
+            {
+                (void)length;
+                return std::unexpected(Error::NotSupported);
+            }
+
+            std::expected<uint64_t, Error> GetPosition() const override
+            {
+                return this->m_Position;
+            }
+
+            std::expected<void, Error> SetPosition(uint64_t position) override
+            {
+                this->m_Position = position;
+                return {};
+            }
+
+            std::expected<size_t, Error> Read(std::span<std::byte> buffer) override
+            {
+                auto const processed = this->ReadAt(buffer, this->m_Position);
+
+                if (processed)
+                {
+                    this->m_Position += *processed;
+                }
+
+                return processed;
+            }
+
+            std::expected<size_t, Error> ReadAt(std::span<std::byte> buffer, uint64_t position) override
+            {
+                if (position >= this->m_Size)
+                {
+                    return 0;
+                }
+
+                size_t const requested = static_cast<size_t>(std::min<uint64_t>(buffer.size(), this->m_Size - position));
+                size_t processed = 0;
+
+                while (processed < requested)
+                {
+                    size_t const index = static_cast<size_t>(position / this->m_BlockSize);
+                    size_t const offset = static_cast<size_t>(position % this->m_BlockSize);
+
+                    PackageBlock const& block = this->m_Blocks[index];
+                    std::span<std::byte const> const source = this->m_Data.subspan(static_cast<size_t>(block.Offset), block.CompressedSize);
+
+                    size_t const count = std::min<size_t>(block.Size - offset, requested - processed);
+                    std::span<std::byte> const output = buffer.subspan(processed, count);
+
+                    if (block.CompressedSize == block.Size)
+                    {
+                        std::memcpy(output.data(), source.data() + offset, count);
+                    }
+                    else if (count == block.Size)
+                    {
+                        // Whole block is requested; decompress directly to caller buffer.
+                        if (auto decompressed = DecompressBlock(CompressionMethod::LZ4, output, source); not decompressed or (*decompressed != block.Size))
+                        {
+                            return std::unexpected(Error::InvalidData);
+                        }
+                    }
+                    else
+                    {
+                        UniqueLock scope{this->m_CacheLock};
+
+                        if (this->m_CachedBlock != index)
+                        {
+                            if (not this->m_Cache)
+                            {
+                                this->m_Cache = std::make_unique_for_overwrite<std::byte[]>(this->m_BlockSize);
+                            }
+
+                            this->m_CachedBlock = std::numeric_limits<size_t>::max();
+
+                            if (auto decompressed = DecompressBlock(CompressionMethod::LZ4, std::span{this->m_Cache.get(), block.Size}, source); not decompressed or (*decompressed != block.Size))
+                            {
+                                return std::unexpected(Error::InvalidData);
+                            }
+
+                            this->m_CachedBlock = index;
+                        }
+
+                        std::memcpy(output.data(), this->m_Cache.get() + offset, count);
+                    }
+
+                    processed += count;
+                    position += count;
+                }
+
+                return processed;
+            }
+
+            std::expected<size_t, Error> Write(std::span<std::byte const> buffer) override
+            {
+                (void)buffer;
+                return std::unexpected(Error::NotSupported);
+            }
+
+            std::expected<size_t, Error> WriteAt(std::span<std::byte const> buffer, uint64_t position) override
+            {
+                (void)buffer;
+                (void)position;
+                return std::unexpected(Error::NotSupported);
+            }
+        };
+    }
+
+    PackageFileSystem::~PackageFileSystem() = default;
+
+    auto PackageFileSystem::Mount(
+        std::string_view packagePath,
+        std::string_view mountPoint,
+        FileSystem* underlying)
+        -> std::expected<std::unique_ptr<PackageFileSystem>, Error>
+    {
+        Reference<MemoryMappedFile> const file = MemoryMappedFile::Create(packagePath, FileMode::Open, 0, MemoryMappedFileAccess::Read);
+
+        if (not file)
+        {
+            return std::unexpected(Error::FileNotFound);
+        }
+
+        Reference<MemoryMappedFileView> view = file->CreateView(MemoryMappedFileAccess::Read);
+
+        if (not view)
+        {
+            return std::unexpected(Error::InvalidFile);
+        }
+
+        std::span<std::byte const> const data = std::as_const(*view).GetData();
+
+        if (data.size() < sizeof(PackageHeader))
+        {
+            return std::unexpected(Error::InvalidHeader);
+        }
+
+        PackageHeader const& header = *reinterpret_cast<PackageHeader const*>(data.data());
+
+        if ((header.Magic != PackageMagic) or (header.Version != PackageVersion))
+        {
+            return std::unexpected(Error::InvalidHeader);
+        }
+
+        // Only table bounds are validated up front, so mounting does not touch whole package. Entries and blocks
+        // are validated when used.
+        bool const valid = (header.BucketCount != 0) and std::has_single_bit(header.BucketCount) and (header.EntryCount != 0) and (header.BlockSize != 0) and ((header.EntryTableOffset % alignof(PackageEntry)) == 0) and ((header.BlockTableOffset % alignof(PackageBlock)) == 0) and ((header.BucketTableOffset % alignof(uint32_t)) == 0) and IsRangeValid(data, header.BucketTableOffset, (uint64_t{header.BucketCount} + 1) * sizeof(uint32_t)) and IsRangeValid(data, header.EntryTableOffset, uint64_t{header.EntryCount} * sizeof(PackageEntry)) and IsRangeValid(data, header.BlockTableOffset, uint64_t{header.BlockCount} * sizeof(PackageBlock)) and IsRangeValid(data, header.NameTableOffset, header.NameTableSize);
+
+        if (not valid)
+        {
+            return std::unexpected(Error::InvalidData);
+        }
+
+        std::unique_ptr<PackageFileSystem> result{new PackageFileSystem{}};
+        result->m_View = std::move(view);
+        result->m_Data = data;
+        result->m_Header = &header;
+        result->m_Buckets = GetTable<uint32_t>(data, header.BucketTableOffset, uint64_t{header.BucketCount} + 1);
+        result->m_Entries = GetTable<PackageEntry>(data, header.EntryTableOffset, header.EntryCount);
+        result->m_Blocks = GetTable<PackageBlock>(data, header.BlockTableOffset, header.BlockCount);
+        result->m_Names = std::string_view{reinterpret_cast<char const*>(data.data() + header.NameTableOffset), static_cast<size_t>(header.NameTableSize)};
+        result->m_MountPoint = mountPoint;
+        result->m_Underlying = underlying;
+
+        NormalizePackagePath(result->m_MountPoint);
+
+        if (PackageEntry const* root = result->Find(mountPoint); (root == nullptr) or (root->Type != PackageEntryType::Directory))
+        {
+            return std::unexpected(Error::InvalidData);
+        }
+
+        return result;
+    }
+
+    PackageEntry const* PackageFileSystem::Find(std::string_view path) const
+    {
+        std::string normalized{path};
+        NormalizePackagePath(normalized);
+
+        std::string_view relative = normalized;
+
+        if (not this->m_MountPoint.empty())
+        {
+            if (not relative.starts_with(this->m_MountPoint))
+            {
+                return nullptr;
+            }
+
+            relative.remove_prefix(this->m_MountPoint.size());
+
+            if (not relative.empty())
+            {
+                if (relative.front() != '/')
+                {
+                    return nullptr;
+                }
+
+                relative.remove_prefix(1);
+            }
+        }
+
+        uint64_t const hash = HashPackagePath(relative);
+        size_t const bucket = static_cast<size_t>(hash & (this->m_Header->BucketCount - 1));
+
+        size_t const first = this->m_Buckets[bucket];
+        size_t const last = std::min<size_t>(this->m_Buckets[bucket + 1], this->m_Entries.size());
+
+        for (size_t i = first; i < last; ++i)
+        {
+            PackageEntry const& entry = this->m_Entries[i];
+
+            if ((entry.PathHash == hash) and (this->GetEntryPath(entry) == relative))
+            {
+                return &entry;
+            }
+        }
+
+        return nullptr;
+    }
+
+    std::string_view PackageFileSystem::GetEntryPath(PackageEntry const& entry) const
+    {
+        if ((entry.NameOffset > this->m_Names.size()) or (entry.NameLength > (this->m_Names.size() - entry.NameOffset)))
+        {
+            return {};
+        }
+
+        return this->m_Names.substr(entry.NameOffset, entry.NameLength);
+    }
+
+    FileInfo PackageFileSystem::GetEntryInfo(PackageEntry const& entry) const
+    {
+        DateTime const modified{Duration{entry.ModifiedSeconds, entry.ModifiedNanoseconds}};
+
+        return FileInfo{
+            .Created = modified,
+            .Modified = modified,
+            .Size = static_cast<int64_t>(entry.Size),
+            .Type = (entry.Type == PackageEntryType::Directory) ? FileType::Directory : FileType::File,
+            .ReadOnly = true,
+        };
+    }
+
+    auto PackageFileSystem::CreateFileReader(
+        std::string_view path,
+        Flags<FileOption> options)
+        -> std::expected<Reference<FileHandle>, Error>
+    {
+        if (PackageEntry const* entry = this->Find(path))
+        {
+            if (entry->Type != PackageEntryType::File)
+            {
+                return std::unexpected(Error::InvalidFile);
+            }
+
+            if ((entry->FirstBlock > this->m_Blocks.size()) or (entry->BlockCount > (this->m_Blocks.size() - entry->FirstBlock)))
+            {
+                return std::unexpected(Error::InvalidData);
+            }
+
+            std::span<PackageBlock const> const blocks = this->m_Blocks.subspan(entry->FirstBlock, entry->BlockCount);
+
+            uint64_t total = 0;
+
+            for (PackageBlock const& block : blocks)
+            {
+                bool const valid = IsRangeValid(this->m_Data, block.Offset, block.CompressedSize) and (block.Size <= this->m_Header->BlockSize) and ((&block == &blocks.back()) or (block.Size == this->m_Header->BlockSize));
+
+                if (not valid)
+                {
+                    return std::unexpected(Error::InvalidData);
+                }
+
+                total += block.Size;
+            }
+
+            if (total != entry->Size)
+            {
+                return std::unexpected(Error::InvalidData);
+            }
+
+            return MakeReference<PackageFileHandle>(this->m_View, blocks, entry->Size, this->m_Header->BlockSize);
+        }
+
+        if (this->m_Underlying != nullptr)
+        {
+            return this->m_Underlying->CreateFileReader(path, options);
+        }
+
+        return std::unexpected(Error::FileNotFound);
+    }
+
+    auto PackageFileSystem::CreateFileWriter(
+        std::string_view path,
+        Flags<FileOption> options)
+        -> std::expected<Reference<FileHandle>, Error>
+    {
+        if (this->Find(path) != nullptr)
+        {
+            return std::unexpected(Error::AccessDenied);
+        }
+
+        if (this->m_Underlying != nullptr)
+        {
+            return this->m_Underlying->CreateFileWriter(path, options);
+        }
+
+        return std::unexpected(Error::NotSupported);
+    }
+
+    auto PackageFileSystem::GetPathInfo(
+        std::string_view path)
+        -> std::expected<FileInfo, Error>
+    {
+        if (PackageEntry const* entry = this->Find(path))
+        {
+            return this->GetEntryInfo(*entry);
+        }
+
+        if (this->m_Underlying != nullptr)
+        {
+            return this->m_Underlying->GetPathInfo(path);
+        }
+
+        return std::unexpected(Error::FileNotFound);
+    }
+
+    auto PackageFileSystem::Exists(
+        std::string_view path)
+        -> std::expected<void, Error>
+    {
+        if (this->Find(path) != nullptr)
+        {
+            return {};
+        }
+
+        if (this->m_Underlying != nullptr)
+        {
+            return this->m_Underlying->Exists(path);
+        }
+
+        return std::unexpected(Error::FileNotFound);
+    }
+
+    auto PackageFileSystem::FileExists(
+        std::string_view path)
+        -> std::expected<void, Error>
+    {
+        if (PackageEntry const* entry = this->Find(path))
+        {
+            if (entry->Type == PackageEntryType::File)
+            {
+                return {};
+            }
+
+            return std::unexpected(Error::FileNotFound);
+        }
+
+        if (this->m_Underlying != nullptr)
+        {
+            return this->m_Underlying->FileExists(path);
+        }
+
+        return std::unexpected(Error::FileNotFound);
+    }
+
+    auto PackageFileSystem::FileDelete(
+        std::string_view path)
+        -> std::expected<void, Error>
+    {
+        if (this->Find(path) != nullptr)
+        {
+            return std::unexpected(Error::AccessDenied);
+        }
+
+        if (this->m_Underlying != nullptr)
+        {
+            return this->m_Underlying->FileDelete(path);
+        }
+
+        return std::unexpected(Error::NotSupported);
+    }
+
+    auto PackageFileSystem::FileMove(
+        std::string_view source,
+        std::string_view destination,
+        NameCollisionResolve nameCollisionResolve)
+        -> std::expected<void, Error>
+    {
+        if ((this->Find(source) != nullptr) or (this->Find(destination) != nullptr))
+        {
+            return std::unexpected(Error::AccessDenied);
+        }
+
+        if (this->m_Underlying != nullptr)
+        {
+            return this->m_Underlying->FileMove(source, destination, nameCollisionResolve);
+        }
+
+        return std::unexpected(Error::NotSupported);
+    }
+
+    auto PackageFileSystem::DirectoryExists(
+        std::string_view path)
+        -> std::expected<void, Error>
+    {
+        if (PackageEntry const* entry = this->Find(path))
+        {
+            if (entry->Type == PackageEntryType::Directory)
+            {
+                return {};
+            }
+
+            return std::unexpected(Error::DirectoryNotFound);
+        }
+
+        if (this->m_Underlying != nullptr)
+        {
+            return this->m_Underlying->DirectoryExists(path);
+        }
+
+        return std::unexpected(Error::DirectoryNotFound);
+    }
+
+    auto PackageFileSystem::DirectoryDelete(
+        std::string_view path)
+        -> std::expected<void, Error>
+    {
+        if (this->Find(path) != nullptr)
+        {
+            return std::unexpected(Error::AccessDenied);
+        }
+
+        if (this->m_Underlying != nullptr)
+        {
+            return this->m_Underlying->DirectoryDelete(path);
+        }
+
+        return std::unexpected(Error::NotSupported);
+    }
+
+    auto PackageFileSystem::DirectoryDeleteRecursive(
+        std::string_view path)
+        -> std::expected<void, Error>
+    {
+        if (this->Find(path) != nullptr)
+        {
+            return std::unexpected(Error::AccessDenied);
+        }
+
+        if (this->m_Underlying != nullptr)
+        {
+            return this->m_Underlying->DirectoryDeleteRecursive(path);
+        }
+
+        return std::unexpected(Error::NotSupported);
+    }
+
+    auto PackageFileSystem::DirectoryCreate(
+        std::string_view path)
+        -> std::expected<void, Error>
+    {
+        if (this->Find(path) != nullptr)
+        {
+            return std::unexpected(Error::AlreadyExists);
+        }
+
+        if (this->m_Underlying != nullptr)
+        {
+            return this->m_Underlying->DirectoryCreate(path);
+        }
+
+        return std::unexpected(Error::NotSupported);
+    }
+
+    auto PackageFileSystem::DirectoryCreateRecursive(
+        std::string_view path)
+        -> std::expected<void, Error>
+    {
+        if (PackageEntry const* entry = this->Find(path))
+        {
+            if (entry->Type == PackageEntryType::Directory)
+            {
+                return {};
+            }
+
+            return std::unexpected(Error::AlreadyExists);
+        }
+
+        if (this->m_Underlying != nullptr)
+        {
+            return this->m_Underlying->DirectoryCreateRecursive(path);
+        }
+
+        return std::unexpected(Error::NotSupported);
+    }
+
+    void PackageFileSystem::EnumerateEntry(
+        PackageEntry const& entry,
+        std::string& path,
+        FileSystemVisitor& visitor,
+        bool recursive) const
+    {
+        size_t const length = path.size();
+
+        // Bounded by entry count, so corrupted links cannot loop forever.
+        size_t remaining = this->m_Entries.size();
+
+        for (uint32_t index = entry.FirstChild; (index < this->m_Entries.size()) and (remaining != 0); index = this->m_Entries[index].NextSibling, --remaining)
+        {
+            PackageEntry const& child = this->m_Entries[index];
+            std::string_view const childPath = this->GetEntryPath(child);
+            std::string_view const name = childPath.substr(childPath.find_last_of('/') + 1);
+
+            visitor.Visit(path, name, this->GetEntryInfo(child));
+
+            if (recursive and (child.Type == PackageEntryType::Directory) and (child.Parent == static_cast<uint32_t>(&entry - this->m_Entries.data())))
+            {
+                FilePath::PushFragment(path, name);
+                this->EnumerateEntry(child, path, visitor, recursive);
+                path.resize(length);
+            }
+        }
+    }
+
+    std::expected<void, Error> PackageFileSystem::EnumerateUnderlying(
+        std::string_view path,
+        FileSystemVisitor& visitor,
+        bool recursive)
+    {
+        // Skips loose files shadowed by package.
+        class OverlayVisitor final : public FileSystemVisitor
+        {
+        public:
+            PackageFileSystem const& Package;
+            FileSystemVisitor& Inner;
+
+            OverlayVisitor(PackageFileSystem const& package, FileSystemVisitor& inner)
+                : Package{package}
+                , Inner{inner}
+            {
+            }
+
+            void Visit(std::string_view path, std::string_view name, FileInfo const& info) override
+            {
+                std::string full{path};
+                FilePath::PushFragment(full, name);
+
+                if (this->Package.Find(full) == nullptr)
+                {
+                    this->Inner.Visit(path, name, info);
+                }
+            }
+        };
+
+        if (this->m_Underlying == nullptr)
+        {
+            return std::unexpected(Error::DirectoryNotFound);
+        }
+
+        OverlayVisitor overlay{*this, visitor};
+
+        return recursive
+            ? this->m_Underlying->DirectoryEnumerateRecursive(path, overlay)
+            : this->m_Underlying->DirectoryEnumerate(path, overlay);
+    }
+
+    auto PackageFileSystem::DirectoryEnumerate(
+        std::string_view path,
+        FileSystemVisitor& visitor)
+        -> std::expected<void, Error>
+    {
+        PackageEntry const* const entry = this->Find(path);
+
+        if (entry == nullptr)
+        {
+            return this->EnumerateUnderlying(path, visitor, false);
+        }
+
+        if (entry->Type != PackageEntryType::Directory)
+        {
+            return std::unexpected(Error::DirectoryNotFound);
+        }
+
+        std::string current{path};
+        this->EnumerateEntry(*entry, current, visitor, false);
+
+        // Directory may exist only in package.
+        (void)this->EnumerateUnderlying(path, visitor, false);
+        return {};
+    }
+
+    auto PackageFileSystem::DirectoryEnumerateRecursive(
+        std::string_view path,
+        FileSystemVisitor& visitor)
+        -> std::expected<void, Error>
+    {
+        PackageEntry const* const entry = this->Find(path);
+
+        if (entry == nullptr)
+        {
+            return this->EnumerateUnderlying(path, visitor, true);
+        }
+
+        if (entry->Type != PackageEntryType::Directory)
+        {
+            return std::unexpected(Error::DirectoryNotFound);
+        }
+
+        std::string current{path};
+        this->EnumerateEntry(*entry, current, visitor, true);
+
+        // Directory may exist only in package.
+        (void)this->EnumerateUnderlying(path, visitor, true);
+        return {};
+    }
+}
@@ -0,0 +1,133 @@
+#pragma once
+#include "AnemoneRuntime.Storage/FileSystem.hxx"
+#include "AnemoneRuntime.Storage/MemoryMappedFile.hxx"
+#include "AnemoneRuntime.Storage/PackageFormat.hxx"
+
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace Anemone
+{
+    //! Read-only file system backed by memory mapped package.
+    //!
+    //! Package is mounted at mount point; paths below it are looked up in hashed path table of package without
+    //! touching storage. When underlying file system is provided, package is overlaid on top of it: paths not
+    //! present in package, and all modifications outside of package, are forwarded to underlying file system.
+    //! Directory enumeration merges both, with package entries taking precedence.
+    class ANEMONE_RUNTIME_BASE_API PackageFileSystem final : public FileSystem
+    {
+    private:
+        Reference<MemoryMappedFileView> m_View{};
+        std::span<std::byte const> m_Data{};
+        PackageHeader const* m_Header{};
+        std::span<uint32_t const> m_Buckets{};
+        std::span<PackageEntry const> m_Entries{};
+        std::span<PackageBlock const> m_Blocks{};
+        std::string_view m_Names{};
+        std::string m_MountPoint{};
+        FileSystem* m_Underlying{};
+
+    private:
+        PackageFileSystem() = default;
+
+    public:
+        ~PackageFileSystem() override;
+
+        //! Maps package and validates its tables. Mount point is path prefix under which package content appears.
+        static auto Mount(
+            std::string_view packagePath,
+            std::string_view mountPoint,
+            FileSystem* underlying = nullptr)
+            -> std::expected<std::unique_ptr<PackageFileSystem>, Error>;
+
+    public:
+        auto CreateFileReader(
+            std::string_view path,
+            Flags<FileOption> options = FileOption::None)
+            -> std::expected<Reference<FileHandle>, Error> override;
+
+        auto CreateFileWriter(
+            std::string_view path,
+            Flags<FileOption> options = FileOption::None)
+            -> std::expected<Reference<FileHandle>, Error> override;
+
+        auto GetPathInfo(
+            std::string_view path)
+            -> std::expected<FileInfo, Error> override;
+
+        auto Exists(
+            std::string_view path)
+            -> std::expected<void, Error> override;
+
+        auto FileExists(
+            std::string_view path)
+            -> std::expected<void, Error> override;
+
+        auto FileDelete(
+            std::string_view path)
+            -> std::expected<void, Error> override;
+
+        auto FileMove(
+            std::string_view source,
+            std::string_view destination,
+            NameCollisionResolve nameCollisionResolve)
+            -> std::expected<void, Error> override;
+
+        auto DirectoryExists(
+            std::string_view path)
+            -> std::expected<void, Error> override;
+
+        auto DirectoryDelete(
+            std::string_view path)
+            -> std::expected<void, Error> override;
+
+        auto DirectoryDeleteRecursive(
+            std::string_view path)
+            -> std::expected<void, Error> override;
+
+        auto DirectoryCreate(
+            std::string_view path)
+            -> std::expected<void, Error> override;
+
+        auto DirectoryCreateRecursive(
+            std::string_view path)
+            -> std::expected<void, Error> override;
+
+        auto DirectoryEnumerate(
+            std::string_view path,
+            FileSystemVisitor& visitor)
+            -> std::expected<void, Error> override;
+
+        auto DirectoryEnumerateRecursive(
+            std::string_view path,
+            FileSystemVisitor& visitor)
+            -> std::expected<void, Error> override;
+
+    public:
+        [[nodiscard]] size_t GetEntryCount() const
+        {
+            return this->m_Entries.size();
+        }
+
+    private:
+        //! Finds entry of path, or returns null when path is outside of mount point or not in package.
+        PackageEntry const* Find(std::string_view path) const;
+
+        std::string_view GetEntryPath(PackageEntry const& entry) const;
+
+        FileInfo GetEntryInfo(PackageEntry const& entry) const;
+
+        void EnumerateEntry(
+            PackageEntry const& entry,
+            std::string& path,
+            FileSystemVisitor& visitor,
+            bool recursive) const;
+
+        std::expected<void, Error> EnumerateUnderlying(
+            std::string_view path,
+            FileSystemVisitor& visitor,
+            bool recursive);
+    };
+}
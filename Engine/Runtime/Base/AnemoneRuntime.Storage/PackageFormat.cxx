@@ -0,0 +1,46 @@
+#include "AnemoneRuntime.Storage/PackageFormat.hxx"
+
+#include <cstring>
+
+namespace Anemone
+{
+    void NormalizePackagePath(std::string& path)
+    {
+        size_t length = 0;
+        size_t position = 0;
+
+        while (position < path.size())
+        {
+            size_t end = path.find_first_of("/\\", position);
+
+            if (end == std::string::npos)
+            {
+                end = path.size();
+            }
+
+            std::string_view const fragment{path.data() + position, end - position};
+
+            if (fragment == "..")
+            {
+                // Remove last fragment written so far.
+                size_t const separator = std::string_view{path.data(), length}.find_last_of('/');
+                length = (separator == std::string_view::npos) ? 0 : separator;
+            }
+            else if (not fragment.empty() and (fragment != "."))
+            {
+                if (length != 0)
+                {
+                    path[length++] = '/';
+                }
+
+                // Output never overtakes input, so fragment can be moved in place.
+                std::memmove(path.data() + length, fragment.data(), fragment.size());
+                length += fragment.size();
+            }
+
+            position = end + 1;
+        }
+
+        path.resize(length);
+    }
+}
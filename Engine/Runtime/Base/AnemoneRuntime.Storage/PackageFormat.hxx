@@ -0,0 +1,91 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+#include "AnemoneRuntime.Base/FNV.hxx"
+
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Layout of read-only package file. Multi-byte values are stored in native byte order of little endian targets.
+//
+//  PackageHeader
+//  uint32_t[BucketCount + 1]     - index of first entry in each bucket
+//  PackageEntry[EntryCount]      - entries ordered by bucket
+//  PackageBlock[BlockCount]      - blocks of file data
+//  char[NameTableSize]           - normalized paths of entries
+//  data                          - stored or compressed blocks
+
+namespace Anemone
+{
+    static_assert(std::endian::native == std::endian::little);
+
+    inline constexpr uint32_t PackageMagic = 0x4B41'5041u; // "APAK"
+
+    inline constexpr uint32_t PackageVersion = 1;
+
+    inline constexpr uint32_t PackageInvalidIndex = UINT32_MAX;
+
+    enum class PackageEntryType : uint32_t
+    {
+        File,
+        Directory,
+    };
+
+    struct PackageHeader final
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint32_t EntryCount;
+        uint32_t BucketCount;
+        uint32_t BlockCount;
+        uint32_t BlockSize;
+        uint64_t BucketTableOffset;
+        uint64_t EntryTableOffset;
+        uint64_t BlockTableOffset;
+        uint64_t NameTableOffset;
+        uint64_t NameTableSize;
+    };
+
+    static_assert(sizeof(PackageHeader) == 64);
+
+    struct PackageEntry final
+    {
+        uint64_t PathHash;
+        uint32_t NameOffset;
+        uint32_t NameLength;
+
+        //! Directory tree; children of directory are linked in order of their paths.
+        uint32_t Parent;
+        uint32_t FirstChild;
+        uint32_t NextSibling;
+
+        PackageEntryType Type;
+        uint32_t FirstBlock;
+        uint32_t BlockCount;
+        uint64_t Size;
+        int64_t ModifiedSeconds;
+        int64_t ModifiedNanoseconds;
+    };
+
+    static_assert(sizeof(PackageEntry) == 64);
+
+    struct PackageBlock final
+    {
+        uint64_t Offset;
+
+        //! Block is stored uncompressed when its compressed size equals its size.
+        uint32_t CompressedSize;
+        uint32_t Size;
+    };
+
+    static_assert(sizeof(PackageBlock) == 16);
+
+    //! Converts path to form used by package: forward slashes, no dot fragments, no leading or trailing separators.
+    ANEMONE_RUNTIME_BASE_API void NormalizePackagePath(std::string& path);
+
+    [[nodiscard]] constexpr uint64_t HashPackagePath(std::string_view normalizedPath)
+    {
+        return FNV1A64::FromString(normalizedPath);
+    }
+}
@@ -0,0 +1,352 @@
+#include "AnemoneRuntime.Storage/PackageWriter.hxx"
+#include "AnemoneRuntime.Storage/FilePath.hxx"
+#include "AnemoneRuntime.Storage/FileSystem.hxx"
+#include "AnemoneRuntime.Base/Bitwise.hxx"
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
+
+#include <algorithm>
+#include <bit>
+#include <numeric>
+
+namespace Anemone
+{
+    namespace
+    {
+        std::expected<void, Error> WriteAll(FileHandle& file, std::span<std::byte const> buffer)
+        {
+            while (not buffer.empty())
+            {
+                auto const processed = file.Write(buffer);
+
+                if (not processed)
+                {
+                    return std::unexpected(processed.error());
+                }
+
+                if (*processed == 0)
+                {
+                    return std::unexpected(Error::IoError);
+                }
+
+                buffer = buffer.subspan(*processed);
+            }
+
+            return {};
+        }
+    }
+
+    PackageWriter::PackageWriter(PackageWriterOptions const& options)
+        : m_Options{options}
+    {
+        AE_ASSERT(this->m_Options.BlockSize != 0);
+
+        // Root directory.
+        this->m_Nodes.emplace(std::string{}, Node{.Type = PackageEntryType::Directory});
+    }
+
+    auto PackageWriter::AddNode(std::string const& path, PackageEntryType type) -> Node*
+    {
+        if (path.empty())
+        {
+            // Root directory exists always.
+            return (type == PackageEntryType::Directory) ? &this->m_Nodes.find(path)->second : nullptr;
+        }
+
+        if (auto const it = this->m_Nodes.find(path); it != this->m_Nodes.end())
+        {
+            // Only directories may be added more than once.
+            return ((type == PackageEntryType::Directory) and (it->second.Type == type)) ? &it->second : nullptr;
+        }
+
+        // Parent must be directory.
+        size_t const separator = path.find_last_of('/');
+        std::string const parent = (separator == std::string::npos) ? std::string{} : path.substr(0, separator);
+
+        if (this->AddNode(parent, PackageEntryType::Directory) == nullptr)
+        {
+            return nullptr;
+        }
+
+        return &this->m_Nodes.emplace(path, Node{.Type = type}).first->second;
+    }
+
+    std::expected<void, Error> PackageWriter::AddFile(std::string_view path, std::span<std::byte const> content, DateTime modified)
+    {
+        std::string normalized{path};
+        NormalizePackagePath(normalized);
+
+        if (normalized.empty())
+        {
+            return std::unexpected(Error::InvalidPath);
+        }
+
+        Node* const node = this->AddNode(normalized, PackageEntryType::File);
+
+        if (node == nullptr)
+        {
+            return std::unexpected(Error::AlreadyExists);
+        }
+
+        node->FirstBlock = static_cast<uint32_t>(this->m_Blocks.size());
+        node->Size = content.size();
+        node->Modified = modified;
+
+        size_t const blockSize = this->m_Options.BlockSize;
+
+        auto const bound = CompressionMemoryBound(this->m_Options.Compression, blockSize);
+
+        if (not bound)
+        {
+            return std::unexpected(bound.error());
+        }
+
+        this->m_Scratch.resize(*bound);
+
+        for (size_t offset = 0; offset < content.size(); offset += blockSize)
+        {
+            std::span<std::byte const> const block = content.subspan(offset, std::min(blockSize, content.size() - offset));
+
+            auto const compressed = CompressBlock(this->m_Options.Compression, this->m_Scratch, block);
+
+            std::span<std::byte const> stored = block;
+
+            if (compressed and (*compressed < block.size()))
+            {
+                stored = std::span{this->m_Scratch}.first(*compressed);
+            }
+
+            this->m_Blocks.push_back(PackageBlock{
+                .Offset = this->m_Data.size(),
+                .CompressedSize = static_cast<uint32_t>(stored.size()),
+                .Size = static_cast<uint32_t>(block.size()),
+            });
+
+            this->m_Data.insert(this->m_Data.end(), stored.begin(), stored.end());
+        }
+
+        node->BlockCount = static_cast<uint32_t>(this->m_Blocks.size() - node->FirstBlock);
+        return {};
+    }
+
+    std::expected<void, Error> PackageWriter::AddDirectory(std::string_view path)
+    {
+        std::string normalized{path};
+        NormalizePackagePath(normalized);
+
+        if (this->AddNode(normalized, PackageEntryType::Directory) == nullptr)
+        {
+            return std::unexpected(Error::AlreadyExists);
+        }
+
+        return {};
+    }
+
+    std::expected<void, Error> PackageWriter::AddDirectoryTree(FileSystem& fileSystem, std::string_view directory)
+    {
+        class TreeVisitor final : public FileSystemVisitor
+        {
+        public:
+            std::string_view Root;
+            std::vector<std::pair<std::string, FileInfo>> Items{};
+
+            explicit TreeVisitor(std::string_view root)
+                : Root{root}
+            {
+            }
+
+            void Visit(std::string_view path, std::string_view name, FileInfo const& info) override
+            {
+                std::string full{path};
+                FilePath::PushFragment(full, name);
+                this->Items.emplace_back(std::move(full), info);
+            }
+        };
+
+        TreeVisitor visitor{directory};
+
+        if (auto enumerated = fileSystem.DirectoryEnumerateRecursive(directory, visitor); not enumerated)
+        {
+            return std::unexpected(enumerated.error());
+        }
+
+        for (auto const& [full, info] : visitor.Items)
+        {
+            std::string_view const relative = std::string_view{full}.substr(std::min(directory.size(), full.size()));
+
+            if (info.Type == FileType::Directory)
+            {
+                if (auto added = this->AddDirectory(relative); not added)
+                {
+                    return added;
+                }
+            }
+            else if (info.Type == FileType::File)
+            {
+                auto const content = fileSystem.ReadBinaryFile(full);
+
+                if (not content)
+                {
+                    return std::unexpected(content.error());
+                }
+
+                if (auto added = this->AddFile(relative, (*content)->GetView(), info.Modified); not added)
+                {
+                    return added;
+                }
+            }
+        }
+
+        return {};
+    }
+
+    std::expected<void, Error> PackageWriter::Save(FileSystem& fileSystem, std::string_view path) const
+    {
+        struct Item final
+        {
+            std::string_view Path;
+            Node const* Source;
+            uint64_t Hash;
+        };
+
+        std::vector<Item> items{};
+        items.reserve(this->m_Nodes.size());
+
+        for (auto const& [itemPath, node] : this->m_Nodes)
+        {
+            items.push_back(Item{itemPath, &node, HashPackagePath(itemPath)});
+        }
+
+        // Load factor of at most one keeps lookups to single probe on average.
+        uint32_t const bucketCount = std::bit_ceil(static_cast<uint32_t>(items.size()));
+        uint32_t const bucketMask = bucketCount - 1;
+
+        // Entries are ordered by bucket, path order within bucket is kept by stable sort.
+        std::ranges::stable_sort(items, std::less{}, [&](Item const& item)
+        {
+            return item.Hash & bucketMask;
+        });
+
+        std::vector<uint32_t> buckets(bucketCount + 1);
+
+        for (Item const& item : items)
+        {
+            ++buckets[(item.Hash & bucketMask) + 1];
+        }
+
+        std::partial_sum(buckets.begin(), buckets.end(), buckets.begin());
+
+        // Index of entry by path.
+        std::map<std::string_view, uint32_t, std::less<>> indices{};
+
+        for (uint32_t i = 0; i < items.size(); ++i)
+        {
+            indices.emplace(items[i].Path, i);
+        }
+
+        std::vector<PackageEntry> entries(items.size());
+        std::string names{};
+
+        for (uint32_t i = 0; i < items.size(); ++i)
+        {
+            Item const& item = items[i];
+            Node const& node = *item.Source;
+
+            entries[i] = PackageEntry{
+                .PathHash = item.Hash,
+                .NameOffset = static_cast<uint32_t>(names.size()),
+                .NameLength = static_cast<uint32_t>(item.Path.size()),
+                .Parent = PackageInvalidIndex,
+                .FirstChild = PackageInvalidIndex,
+                .NextSibling = PackageInvalidIndex,
+                .Type = node.Type,
+                .FirstBlock = node.FirstBlock,
+                .BlockCount = node.BlockCount,
+                .Size = node.Size,
+                .ModifiedSeconds = node.Modified.Inner.Seconds,
+                .ModifiedNanoseconds = node.Modified.Inner.Nanoseconds,
+            };
+
+            names.append(item.Path);
+        }
+
+        // Link children in reverse path order, so each list ends up in path order.
+        for (auto it = indices.rbegin(); it != indices.rend(); ++it)
+        {
+            std::string_view const itemPath = it->first;
+
+            if (itemPath.empty())
+            {
+                continue;
+            }
+
+            size_t const separator = itemPath.find_last_of('/');
+            std::string_view const parentPath = (separator == std::string_view::npos) ? std::string_view{} : itemPath.substr(0, separator);
+
+            uint32_t const index = it->second;
+            uint32_t const parent = indices.find(parentPath)->second;
+
+            entries[index].Parent = parent;
+            entries[index].NextSibling = entries[parent].FirstChild;
+            entries[parent].FirstChild = index;
+        }
+
+        PackageHeader header{
+            .Magic = PackageMagic,
+            .Version = PackageVersion,
+            .EntryCount = static_cast<uint32_t>(entries.size()),
+            .BucketCount = bucketCount,
+            .BlockCount = static_cast<uint32_t>(this->m_Blocks.size()),
+            .BlockSize = this->m_Options.BlockSize,
+            .BucketTableOffset = sizeof(PackageHeader),
+            .EntryTableOffset = {},
+            .BlockTableOffset = {},
+            .NameTableOffset = {},
+            .NameTableSize = names.size(),
+        };
+
+        header.EntryTableOffset = AlignUp<uint64_t>(header.BucketTableOffset + (buckets.size() * sizeof(uint32_t)), alignof(PackageEntry));
+        header.BlockTableOffset = header.EntryTableOffset + (entries.size() * sizeof(PackageEntry));
+        header.NameTableOffset = header.BlockTableOffset + (this->m_Blocks.size() * sizeof(PackageBlock));
+
+        uint64_t const dataOffset = AlignUp<uint64_t>(header.NameTableOffset + header.NameTableSize, 16);
+
+        std::vector<PackageBlock> blocks{this->m_Blocks};
+
+        for (PackageBlock& block : blocks)
+        {
+            block.Offset += dataOffset;
+        }
+
+        auto writer = fileSystem.CreateFileWriter(path);
+
+        if (not writer)
+        {
+            return std::unexpected(writer.error());
+        }
+
+        FileHandle& file = **writer;
+
+        std::byte const padding[16]{};
+
+        std::span<std::byte const> const sections[]{
+            std::as_bytes(std::span{&header, 1}),
+            std::as_bytes(std::span{buckets}),
+            std::span{padding}.first(header.EntryTableOffset - header.BucketTableOffset - (buckets.size() * sizeof(uint32_t))),
+            std::as_bytes(std::span{entries}),
+            std::as_bytes(std::span{blocks}),
+            std::as_bytes(std::span{names}),
+            std::span{padding}.first(dataOffset - header.NameTableOffset - header.NameTableSize),
+            std::span{this->m_Data},
+        };
+
+        for (std::span<std::byte const> const section : sections)
+        {
+            if (auto written = WriteAll(file, section); not written)
+            {
+                return written;
+            }
+        }
+
+        return file.Flush();
+    }
+}
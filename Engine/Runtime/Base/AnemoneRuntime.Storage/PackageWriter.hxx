@@ -0,0 +1,74 @@
+#pragma once
+#include "AnemoneRuntime.Storage/PackageFormat.hxx"
+#include "AnemoneRuntime.Base/Compression.hxx"
+#include "AnemoneRuntime.Base/DateTime.hxx"
+
+#include <expected>
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Anemone
+{
+    class FileSystem;
+
+    struct PackageWriterOptions final
+    {
+        //! Size of uncompressed block. Reads decompress whole blocks.
+        uint32_t BlockSize{64u << 10u};
+
+        //! Blocks which do not shrink are stored uncompressed.
+        CompressionMethod Compression{CompressionMethod::LZ4};
+    };
+
+    //! Builds read-only package mounted by PackageFileSystem.
+    class ANEMONE_RUNTIME_BASE_API PackageWriter final
+    {
+    private:
+        struct Node final
+        {
+            PackageEntryType Type{};
+            uint32_t FirstBlock{};
+            uint32_t BlockCount{};
+            uint64_t Size{};
+            DateTime Modified{};
+        };
+
+        PackageWriterOptions m_Options{};
+
+        //! Ordered by path, so children of each directory are linked in order.
+        std::map<std::string, Node, std::less<>> m_Nodes{};
+        std::vector<PackageBlock> m_Blocks{};
+        std::vector<std::byte> m_Data{};
+        std::vector<std::byte> m_Scratch{};
+
+    public:
+        explicit PackageWriter(PackageWriterOptions const& options = {});
+
+        PackageWriter(PackageWriter const&) = delete;
+
+        PackageWriter(PackageWriter&&) = delete;
+
+        PackageWriter& operator=(PackageWriter const&) = delete;
+
+        PackageWriter& operator=(PackageWriter&&) = delete;
+
+        ~PackageWriter() = default;
+
+    public:
+        //! Adds file; its data is compressed immediately. Parent directories are added implicitly.
+        std::expected<void, Error> AddFile(std::string_view path, std::span<std::byte const> content, DateTime modified = {});
+
+        std::expected<void, Error> AddDirectory(std::string_view path);
+
+        //! Adds all files and directories found in directory of file system, relative to that directory.
+        std::expected<void, Error> AddDirectoryTree(FileSystem& fileSystem, std::string_view directory);
+
+        std::expected<void, Error> Save(FileSystem& fileSystem, std::string_view path) const;
+
+    private:
+        Node* AddNode(std::string const& path, PackageEntryType type);
+    };
+}
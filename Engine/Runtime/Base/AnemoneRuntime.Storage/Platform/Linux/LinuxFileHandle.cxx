@@ -1,13 +1,47 @@
 #include "AnemoneRuntime.Storage/Platform/Linux/LinuxFileHandle.hxx"
+#include "AnemoneRuntime.Storage/DirectIoBuffer.hxx"
 #include "AnemoneRuntime.Diagnostics/Debug.hxx"
 #include "AnemoneRuntime.Interop/Linux/FileSystem.hxx"
+#include "AnemoneRuntime.Base/Bitwise.hxx"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
 
 namespace Anemone
 {
+    namespace
+    {
+        //! Maximum size of bounce buffer used for unaligned reads of files opened for direct I/O.
+        constexpr size_t MaxBounceBufferSize = size_t{1} << 20u;
+
+        //! Bounce buffer of current thread; grows to the largest unaligned request seen. Handles may be read by
+        //! many threads at once, so buffer is not owned by handle.
+        thread_local DirectIoBuffer tlsBounceBuffer{};
+
+        DirectIoBuffer const& AcquireBounceBuffer(size_t size)
+        {
+            size_t const required = std::min(size, MaxBounceBufferSize);
+
+            if (tlsBounceBuffer.GetCapacity() < required)
+            {
+                tlsBounceBuffer = DirectIoBuffer{required};
+            }
+
+            return tlsBounceBuffer;
+        }
+    }
+
     LinuxFileHandle::LinuxFileHandle(
-        Interop::Linux::SafeFdHandle handle)
+        Interop::Linux::SafeFdHandle handle,
+        LinuxFileCaching caching,
+        size_t ioAlignment)
         : _handle{std::move(handle)}
+        , _caching{caching}
+        , _ioAlignment{ioAlignment}
     {
+        AE_ASSERT(IsPowerOf2(this->_ioAlignment));
+        AE_ASSERT(this->_ioAlignment <= DirectIoBuffer::GetAlignment());
     }
 
 
@@ -113,6 +147,29 @@ namespace Anemone
     {
         AE_ASSERT(this->_handle);
 
+        if (this->_caching != LinuxFileCaching::Buffered)
+        {
+            // Requests bypassing page cache are positional; keep file position in sync.
+            auto const position = this->GetPosition();
+
+            if (not position)
+            {
+                return std::unexpected(position.error());
+            }
+
+            auto const processed = this->ReadAt(buffer, *position);
+
+            if (processed)
+            {
+                if (auto const moved = this->SetPosition(*position + *processed); not moved)
+                {
+                    return std::unexpected(moved.error());
+                }
+            }
+
+            return processed;
+        }
+
         if (not buffer.empty())
         {
             size_t const requested = Interop::Linux::ValidateIoRequestLength(buffer.size());
@@ -152,6 +209,11 @@ namespace Anemone
         AE_ASSERT(this->_handle);
         AE_ASSERT(position <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()));
 
+        if ((this->_caching == LinuxFileCaching::Direct) and not this->IsAlignedRequest(buffer.data(), buffer.size(), position))
+        {
+            return this->ReadAtUnaligned(buffer, position);
+        }
+
         if (not buffer.empty())
         {
             size_t const requested = Interop::Linux::ValidateIoRequestLength(buffer.size());
@@ -163,6 +225,11 @@ namespace Anemone
 
                 if (processed >= 0)
                 {
+                    if (this->_caching == LinuxFileCaching::DropBehind)
+                    {
+                        this->DropCachedRange(position, static_cast<size_t>(processed), false);
+                    }
+
                     return static_cast<size_t>(processed);
                 }
 
@@ -190,6 +257,29 @@ namespace Anemone
     {
         AE_ASSERT(this->_handle);
 
+        if (this->_caching != LinuxFileCaching::Buffered)
+        {
+            // Requests bypassing page cache are positional; keep file position in sync.
+            auto const position = this->GetPosition();
+
+            if (not position)
+            {
+                return std::unexpected(position.error());
+            }
+
+            auto const processed = this->WriteAt(buffer, *position);
+
+            if (processed)
+            {
+                if (auto const moved = this->SetPosition(*position + *processed); not moved)
+                {
+                    return std::unexpected(moved.error());
+                }
+            }
+
+            return processed;
+        }
+
         if (not buffer.empty())
         {
             size_t const requested = Interop::Linux::ValidateIoRequestLength(buffer.size());
@@ -228,6 +318,12 @@ namespace Anemone
     {
         AE_ASSERT(this->_handle);
 
+        if ((this->_caching == LinuxFileCaching::Direct) and not this->IsAlignedRequest(buffer.data(), buffer.size(), position))
+        {
+            // Unaligned writes would need read-modify-write of partial blocks; caller is expected to pad them.
+            return std::unexpected(Error::InvalidArgument);
+        }
+
         if (not buffer.empty())
         {
             size_t const requested = Interop::Linux::ValidateIoRequestLength(buffer.size());
@@ -239,6 +335,11 @@ namespace Anemone
 
                 if (processed >= 0)
                 {
+                    if (this->_caching == LinuxFileCaching::DropBehind)
+                    {
+                        this->DropCachedRange(position, static_cast<size_t>(processed), true);
+                    }
+
                     return static_cast<size_t>(processed);
                 }
 
@@ -260,4 +361,103 @@ namespace Anemone
 
         return 0;
     }
+
+    size_t LinuxFileHandle::GetIoAlignment() const
+    {
+        return this->_ioAlignment;
+    }
+
+    bool LinuxFileHandle::IsNativeRequest(
+        void const* buffer,
+        size_t length,
+        uint64_t position) const
+    {
+        switch (this->_caching)
+        {
+        case LinuxFileCaching::Buffered:
+            return true;
+
+        case LinuxFileCaching::Direct:
+            return this->IsAlignedRequest(buffer, length, position);
+
+        case LinuxFileCaching::DropBehind:
+            break;
+        }
+
+        return false;
+    }
+
+    bool LinuxFileHandle::IsAlignedRequest(
+        void const* buffer,
+        size_t length,
+        uint64_t position) const
+    {
+        uint64_t const combined = static_cast<uint64_t>(std::bit_cast<uintptr_t>(buffer)) | length | position;
+        return (combined & (this->_ioAlignment - 1)) == 0;
+    }
+
+    std::expected<size_t, Error> LinuxFileHandle::ReadAtUnaligned(
+        std::span<std::byte> buffer,
+        uint64_t position)
+    {
+        // Whole aligned blocks are read into bounce buffer, then requested part is copied out.
+        DirectIoRange const range = DirectIoRange::Create(position, buffer.size(), this->_ioAlignment);
+        DirectIoBuffer const& bounce = AcquireBounceBuffer(range.Length);
+        size_t const capacity = AlignDown(bounce.GetCapacity(), this->_ioAlignment);
+
+        uint64_t blockPosition = range.Position;
+        size_t skip = range.Offset;
+        size_t total = 0;
+
+        while (total < buffer.size())
+        {
+            size_t const wanted = buffer.size() - total;
+            size_t const chunk = std::min(AlignUp(skip + wanted, this->_ioAlignment), capacity);
+
+            auto const processed = this->ReadAt(bounce.GetView().first(chunk), blockPosition);
+
+            if (not processed)
+            {
+                return std::unexpected(processed.error());
+            }
+
+            if (*processed <= skip)
+            {
+                // End of file.
+                break;
+            }
+
+            size_t const copied = std::min(*processed - skip, wanted);
+            std::memcpy(buffer.data() + total, bounce.GetData() + skip, copied);
+            total += copied;
+
+            if (*processed < chunk)
+            {
+                // End of file.
+                break;
+            }
+
+            blockPosition += chunk;
+            skip = 0;
+        }
+
+        return total;
+    }
+
+    void LinuxFileHandle::DropCachedRange(
+        uint64_t position,
+        size_t length,
+        bool written) const
+    {
+        off64_t const offset = static_cast<off64_t>(position);
+        off64_t const size = static_cast<off64_t>(length);
+
+        if (written)
+        {
+            // Only clean pages can be dropped; write them back first.
+            sync_file_range(this->_handle.Get(), offset, size, SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER);
+        }
+
+        posix_fadvise(this->_handle.Get(), offset, size, POSIX_FADV_DONTNEED);
+    }
 }
@@ -6,15 +6,31 @@ namespace Anemone
 {
     class LinuxFileSystem;
 
+    enum class LinuxFileCaching : uint8_t
+    {
+        //! Requests go through page cache.
+        Buffered,
+
+        //! File was opened with O_DIRECT.
+        Direct,
+
+        //! File system does not support O_DIRECT; cached pages are dropped after each request.
+        DropBehind,
+    };
+
     class LinuxFileHandle final
         : public FileHandle
     {
     private:
         Interop::Linux::SafeFdHandle _handle{};
+        LinuxFileCaching _caching{};
+        size_t _ioAlignment{};
 
     public:
         explicit LinuxFileHandle(
-            Interop::Linux::SafeFdHandle handle);
+            Interop::Linux::SafeFdHandle handle,
+            LinuxFileCaching caching = LinuxFileCaching::Buffered,
+            size_t ioAlignment = 1);
 
         LinuxFileHandle() = delete;
 
@@ -64,5 +80,29 @@ namespace Anemone
         std::expected<size_t, Error> WriteAt(
             std::span<std::byte const> buffer,
             uint64_t position) override;
+
+        size_t GetIoAlignment() const override;
+
+        //! Whether request may be issued on native handle as is, without alignment and cache handling performed
+        //! by ReadAt and WriteAt.
+        bool IsNativeRequest(
+            void const* buffer,
+            size_t length,
+            uint64_t position) const;
+
+    private:
+        bool IsAlignedRequest(
+            void const* buffer,
+            size_t length,
+            uint64_t position) const;
+
+        std::expected<size_t, Error> ReadAtUnaligned(
+            std::span<std::byte> buffer,
+            uint64_t position);
+
+        void DropCachedRange(
+            uint64_t position,
+            size_t length,
+            bool written) const;
     };
 }
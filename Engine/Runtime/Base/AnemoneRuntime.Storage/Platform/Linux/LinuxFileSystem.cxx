@@ -1,5 +1,6 @@
 #include "AnemoneRuntime.Storage/Platform/Linux/LinuxFileSystem.hxx"
 #include "AnemoneRuntime.Storage/Platform/Linux/LinuxFileHandle.hxx"
+#include "AnemoneRuntime.Storage/DirectIoBuffer.hxx"
 #include "AnemoneRuntime.Base/UninitializedObject.hxx"
 #include "AnemoneRuntime.Diagnostics/Trace.hxx"
 #include "AnemoneRuntime.Diagnostics/Debug.hxx"
@@ -12,6 +13,10 @@
 #include <string_view>
 #include <unistd.h>
 #include <sys/file.h>
+#include <sys/stat.h>
+#include <ftw.h>
+#include <sys/sendfile.h>
+#include <linux/fs.h>
 
 
 namespace Anemone
@@ -195,6 +200,11 @@ namespace Anemone
                 result |= O_SYNC;
             }
 
+            if (options.Any(FileOption::NoBuffering))
+            {
+                result |= O_DIRECT;
+            }
+
             if (options.None(FileOption::Inheritable))
             {
                 result |= O_CLOEXEC;
@@ -233,11 +243,118 @@ namespace Anemone
         inline constexpr blksize_t MinimumBlockSize = 8 << 10u;
         inline constexpr blksize_t MaximumBlockSize = 64 << 10u;
 
-        [[maybe_unused]]
-        auto InternalCopyFile(
+        //! Number of bytes transferred by single copy_file_range or sendfile call.
+        inline constexpr size_t KernelCopyChunkSize = size_t{1} << 30u;
+
+        //! Checks whether error means that kernel can't perform copy of this kind, so slower method should be used.
+        //! Other errors, such as bad descriptor or permission denied, would fail slower methods as well.
+        constexpr bool IsCopyMethodUnsupported(int error)
+        {
+            return (error == ENOSYS)
+                or (error == EXDEV)
+                or (error == EINVAL)
+                or (error == EOPNOTSUPP);
+        }
+
+        //! Result of copy method which may not be supported for given pair of files.
+        enum class CopyStatus
+        {
+            Completed,
+            Unsupported,
+            Failed,
+        };
+
+        //! Shares data extents with source on copy-on-write file systems, such as Btrfs or XFS.
+        auto InternalCloneFile(
+            Interop::Linux::SafeFdHandle const& source,
+            Interop::Linux::SafeFdHandle const& destination)
+            -> CopyStatus
+        {
+            if (ioctl(destination.Get(), FICLONE, source.Get()) == 0)
+            {
+                return CopyStatus::Completed;
+            }
+
+            return IsCopyMethodUnsupported(errno) ? CopyStatus::Unsupported : CopyStatus::Failed;
+        }
+
+        //! Copies data in kernel; file system may also share extents or offload copy to storage.
+        auto InternalCopyFileRange(
             Interop::Linux::SafeFdHandle const& source,
             Interop::Linux::SafeFdHandle const& destination,
-            struct stat64 const& sourceStat)
+            off64_t& offset)
+            -> CopyStatus
+        {
+            while (true)
+            {
+                off64_t sourceOffset = offset;
+                off64_t destinationOffset = offset;
+
+                ssize_t const copied = copy_file_range(source.Get(), &sourceOffset, destination.Get(), &destinationOffset, KernelCopyChunkSize, 0);
+
+                if (copied > 0)
+                {
+                    offset += copied;
+                    continue;
+                }
+
+                if (copied == 0)
+                {
+                    // End of file. Some pseudo file systems report no data here while files are not empty;
+                    // let read/write loop handle them.
+                    return (offset != 0) ? CopyStatus::Completed : CopyStatus::Unsupported;
+                }
+
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                return IsCopyMethodUnsupported(errno) ? CopyStatus::Unsupported : CopyStatus::Failed;
+            }
+        }
+
+        //! Copies data through page cache without user space buffer.
+        auto InternalSendFile(
+            Interop::Linux::SafeFdHandle const& source,
+            Interop::Linux::SafeFdHandle const& destination,
+            off64_t& offset)
+            -> CopyStatus
+        {
+            // Unlike input offset, sendfile writes at current position of output file.
+            if (lseek64(destination.Get(), offset, SEEK_SET) < 0)
+            {
+                return CopyStatus::Failed;
+            }
+
+            while (true)
+            {
+                ssize_t const copied = sendfile64(destination.Get(), source.Get(), &offset, KernelCopyChunkSize);
+
+                if (copied > 0)
+                {
+                    continue;
+                }
+
+                if (copied == 0)
+                {
+                    return (offset != 0) ? CopyStatus::Completed : CopyStatus::Unsupported;
+                }
+
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                return IsCopyMethodUnsupported(errno) ? CopyStatus::Unsupported : CopyStatus::Failed;
+            }
+        }
+
+        auto InternalCopyFileBuffered(
+            Interop::Linux::SafeFdHandle const& source,
+            Interop::Linux::SafeFdHandle const& destination,
+            struct stat64 const& sourceStat,
+            off64_t offset)
             -> std::expected<void, Error>
         {
             // Choose block size.
@@ -247,14 +364,24 @@ namespace Anemone
 
             ssize_t readBytes;
 
-            while ((readBytes = read(source.Get(), buffer.get(), bufferSize)) > 0)
+            while ((readBytes = pread64(source.Get(), buffer.get(), bufferSize, offset)) != 0)
             {
+                if (readBytes < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+
+                    return std::unexpected(Error::IoError);
+                }
+
                 std::byte* writeBuffer = buffer.get();
                 ssize_t writeBytes = readBytes;
 
                 while (writeBytes > 0)
                 {
-                    ssize_t const writtenBytes = write(destination.Get(), writeBuffer, writeBytes);
+                    ssize_t const writtenBytes = pwrite64(destination.Get(), writeBuffer, writeBytes, offset);
 
                     if (writtenBytes < 0)
                     {
@@ -268,16 +395,55 @@ namespace Anemone
 
                     writeBytes -= writtenBytes;
                     writeBuffer += writtenBytes;
+                    offset += writtenBytes;
+                }
+            }
+
+            return {};
+        }
+
+        //! Copies file using fastest method supported by kernel and file systems: reflink, in-kernel copy,
+        //! sendfile, and finally read/write loop. Copy continues from offset reached by previous method.
+        [[maybe_unused]]
+        auto InternalCopyFile(
+            Interop::Linux::SafeFdHandle const& source,
+            Interop::Linux::SafeFdHandle const& destination,
+            struct stat64 const& sourceStat)
+            -> std::expected<void, Error>
+        {
+            if (S_ISREG(sourceStat.st_mode) and (sourceStat.st_size > 0))
+            {
+                switch (InternalCloneFile(source, destination))
+                {
+                case CopyStatus::Completed:
+                    return {};
+
+                case CopyStatus::Failed:
+                    return std::unexpected(Error::IoError);
+
+                case CopyStatus::Unsupported:
+                    break;
                 }
             }
 
-            if (readBytes < 0)
+            off64_t offset = 0;
+
+            for (auto method : {InternalCopyFileRange, InternalSendFile})
             {
-                return std::unexpected(Error::IoError);
+                switch (method(source, destination, offset))
+                {
+                case CopyStatus::Completed:
+                    return {};
+
+                case CopyStatus::Failed:
+                    return std::unexpected(Error::IoError);
+
+                case CopyStatus::Unsupported:
+                    break;
+                }
             }
 
-            AE_ASSERT(readBytes == 0);
-            return {};
+            return InternalCopyFileBuffered(source, destination, sourceStat, offset);
         }
 
         [[maybe_unused]] auto InternalCreatePipe(
@@ -300,6 +466,22 @@ namespace Anemone
             return {};
         }
 
+        //! Gets alignment required by O_DIRECT requests on file, or zero when file system does not support them.
+        size_t QueryDirectIoAlignment(int fd)
+        {
+#if defined(STATX_DIOALIGN)
+            struct statx stx{};
+
+            if ((statx(fd, "", AT_EMPTY_PATH, STATX_DIOALIGN, &stx) == 0) and ((stx.stx_mask & STATX_DIOALIGN) != 0))
+            {
+                return std::max<size_t>(stx.stx_dio_mem_align, stx.stx_dio_offset_align);
+            }
+#endif
+
+            // Older kernels do not report alignment; page size is multiple of logical block size of any device.
+            return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        }
+
         auto InternalCreateFile(
             std::string_view path,
             FileMode mode,
@@ -317,6 +499,38 @@ namespace Anemone
 
             SafeFdHandle handle{open(filePath.c_str(), flags, fmode)};
 
+            LinuxFileCaching caching = LinuxFileCaching::Buffered;
+            size_t ioAlignment = 1;
+
+            if ((flags & O_DIRECT) != 0)
+            {
+                if (not handle and (errno == EINVAL))
+                {
+                    // File system rejects O_DIRECT.
+                    handle = SafeFdHandle{open(filePath.c_str(), flags & ~O_DIRECT, fmode)};
+                }
+
+                if (handle)
+                {
+                    caching = LinuxFileCaching::DropBehind;
+
+                    if ((fcntl(handle.Get(), F_GETFL) & O_DIRECT) != 0)
+                    {
+                        size_t const alignment = QueryDirectIoAlignment(handle.Get());
+
+                        if ((alignment != 0) and (alignment <= DirectIoBuffer::GetAlignment()))
+                        {
+                            caching = LinuxFileCaching::Direct;
+                            ioAlignment = alignment;
+                        }
+                        else
+                        {
+                            fcntl(handle.Get(), F_SETFL, fcntl(handle.Get(), F_GETFL) & ~O_DIRECT);
+                        }
+                    }
+                }
+            }
+
             if (handle)
             {
                 if (flock(handle.Get(), LOCK_EX | LOCK_NB))
@@ -348,7 +562,7 @@ namespace Anemone
                     posix_fadvise(handle.Get(), 0, 0, POSIX_FADV_RANDOM);
                 }
 
-                return MakeReference<LinuxFileHandle>(std::move(handle));
+                return MakeReference<LinuxFileHandle>(std::move(handle), caching, ioAlignment);
             }
 
             return std::unexpected(Error::Failure);
@@ -358,17 +572,19 @@ namespace Anemone
     LinuxFileSystem::LinuxFileSystem() = default;
 
     auto LinuxFileSystem::CreateFileReader(
-        std::string_view path)
+        std::string_view path,
+        Flags<FileOption> options)
         -> std::expected<Reference<FileHandle>, Error>
     {
-        return InternalCreateFile(path, FileMode::Open, FileAccess::Read, FileOption::None);
+        return InternalCreateFile(path, FileMode::Open, FileAccess::Read, options);
     }
 
     auto LinuxFileSystem::CreateFileWriter(
-        std::string_view path)
+        std::string_view path,
+        Flags<FileOption> options)
         -> std::expected<Reference<FileHandle>, Error>
     {
-        return InternalCreateFile(path, FileMode::Create, FileAccess::Write, FileOption::None);
+        return InternalCreateFile(path, FileMode::Create, FileAccess::Write, options);
     }
 
     auto LinuxFileSystem::GetPathInfo(
@@ -567,9 +783,22 @@ namespace Anemone
         std::string_view path)
         -> std::expected<void, Error>
     {
-        // not implemented
-        (void)path;
-        return std::unexpected(Error::Failure);
+        using namespace Interop::Linux;
+
+        Interop::Linux::FilePath nativePath{path};
+
+        // Children are removed before their parents; symbolic links are removed, not followed.
+        int const result = nftw(nativePath.c_str(), [](char const* entry, struct stat const*, int, struct FTW*)
+        {
+            return remove(entry);
+        }, 64, FTW_DEPTH | FTW_PHYS);
+
+        if (result != 0)
+        {
+            return std::unexpected(Error::Failure);
+        }
+
+        return {};
     }
 
     auto LinuxFileSystem::DirectoryCreate(
@@ -593,8 +822,35 @@ namespace Anemone
         std::string_view path)
         -> std::expected<void, Error>
     {
-        (void)path;
-        // not implemented
+        using namespace Interop::Linux;
+
+        Interop::Linux::FilePath nativePath{path};
+
+        char* const buffer = nativePath.data();
+        size_t const length = nativePath.size();
+
+        // Create each parent in turn, skipping leading separator of absolute path.
+        for (size_t i = 1; i <= length; ++i)
+        {
+            if ((i == length) or (buffer[i] == '/'))
+            {
+                char const separator = buffer[i];
+                buffer[i] = '\0';
+
+                if ((mkdir(buffer, S_IRWXU | S_IRWXG | S_IRWXO) < 0) and (errno != EEXIST))
+                {
+                    return std::unexpected(Error::Failure);
+                }
+
+                buffer[i] = separator;
+            }
+        }
+
+        if (this->DirectoryExists(path))
+        {
+            return {};
+        }
+
         return std::unexpected(Error::Failure);
     }
 
@@ -688,7 +944,10 @@ namespace Anemone
 
                 if (info.Type == FileType::Directory)
                 {
-                    (void)this->_owner->DirectoryEnumerate(path, *this->_visitor);
+                    // Visited path is parent directory of entry.
+                    std::string child{path};
+                    FilePath::PushFragment(child, name);
+                    (void)this->_owner->DirectoryEnumerate(child, *this);
                 }
             }
         };
@@ -0,0 +1,348 @@
+#include "AnemoneRuntime.Storage/Platform/Linux/LinuxIoUringFileIoQueue.hxx"
+#include "AnemoneRuntime.Storage/Platform/Linux/LinuxFileHandle.hxx"
+#include "AnemoneRuntime.Interop/Linux/FileSystem.hxx"
+#include "AnemoneRuntime.Threading/Runnable.hxx"
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
+
+#include <bit>
+
+#include <sys/eventfd.h>
+
+namespace Anemone
+{
+    namespace
+    {
+        int IoUringSetup(uint32_t entries, io_uring_params& params)
+        {
+            return static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        }
+
+        int IoUringEnter(int ring, uint32_t submit, uint32_t complete, uint32_t flags)
+        {
+            return static_cast<int>(syscall(__NR_io_uring_enter, ring, submit, complete, flags, nullptr, 0));
+        }
+
+        // Completion entries of eventfd reads carry this value; requests always carry address of operation.
+        constexpr uint64_t WakeUserData = 0;
+
+        template <typename T>
+        T* RingPointer(void* ring, uint32_t offset)
+        {
+            return std::bit_cast<T*>(static_cast<std::byte*>(ring) + offset);
+        }
+    }
+
+    LinuxIoUringFileIoQueue::LinuxIoUringFileIoQueue(TaskScheduler& scheduler, uint32_t queueDepth)
+        : FileIoQueue{scheduler, std::bit_ceil(queueDepth)}
+    {
+    }
+
+    LinuxIoUringFileIoQueue::~LinuxIoUringFileIoQueue()
+    {
+        if (this->m_Thread)
+        {
+            this->m_Stopping.store(true, std::memory_order::release);
+            this->Wake();
+            this->m_Thread->Join();
+        }
+
+        if (this->m_Sqes != nullptr)
+        {
+            munmap(this->m_Sqes, this->m_SqesSize);
+        }
+
+        if ((this->m_CqRing != nullptr) and (this->m_CqRing != this->m_SqRing))
+        {
+            munmap(this->m_CqRing, this->m_CqRingSize);
+        }
+
+        if (this->m_SqRing != nullptr)
+        {
+            munmap(this->m_SqRing, this->m_SqRingSize);
+        }
+    }
+
+    std::unique_ptr<LinuxIoUringFileIoQueue> LinuxIoUringFileIoQueue::TryCreate(TaskScheduler& scheduler, uint32_t queueDepth)
+    {
+        std::unique_ptr<LinuxIoUringFileIoQueue> result = std::make_unique<LinuxIoUringFileIoQueue>(scheduler, queueDepth);
+
+        if (not result->Initialize())
+        {
+            return {};
+        }
+
+        result->m_Thread = Thread::Start(
+            ThreadStart{
+                .Name = "FileIo-Ring",
+                .Priority = ThreadPriority::AboveNormal,
+                .Callback = MakeRunnable([queue = result.get()]
+                {
+                    queue->ThreadEntryPoint();
+                }),
+            });
+
+        return result;
+    }
+
+    bool LinuxIoUringFileIoQueue::Initialize()
+    {
+        this->m_WakeEvent = Interop::Linux::SafeFdHandle{eventfd(0, EFD_CLOEXEC)};
+
+        if (not this->m_WakeEvent)
+        {
+            return false;
+        }
+
+        io_uring_params params{};
+
+        // One more entry for eventfd read. Fails with ENOSYS on old kernels and EPERM when disabled by
+        // kernel.io_uring_disabled or seccomp.
+        this->m_Ring = Interop::Linux::SafeFdHandle{IoUringSetup(this->GetQueueDepth() + 1, params)};
+
+        if (not this->m_Ring)
+        {
+            return false;
+        }
+
+        if ((params.features & IORING_FEAT_RW_CUR_POS) == 0)
+        {
+            // Kernel older than 5.6; IORING_OP_READ and IORING_OP_WRITE are not supported.
+            return false;
+        }
+
+        int const ring = this->m_Ring.Get();
+
+        this->m_SqRingSize = params.sq_off.array + (params.sq_entries * sizeof(uint32_t));
+        this->m_CqRingSize = params.cq_off.cqes + (params.cq_entries * sizeof(io_uring_cqe));
+
+        bool const singleMapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+
+        if (singleMapping)
+        {
+            this->m_SqRingSize = this->m_CqRingSize = std::max(this->m_SqRingSize, this->m_CqRingSize);
+        }
+
+        void* const sqRing = mmap(nullptr, this->m_SqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQ_RING);
+
+        if (sqRing == MAP_FAILED)
+        {
+            return false;
+        }
+
+        this->m_SqRing = sqRing;
+
+        if (singleMapping)
+        {
+            this->m_CqRing = sqRing;
+        }
+        else
+        {
+            void* const cqRing = mmap(nullptr, this->m_CqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_CQ_RING);
+
+            if (cqRing == MAP_FAILED)
+            {
+                return false;
+            }
+
+            this->m_CqRing = cqRing;
+        }
+
+        this->m_SqesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+        void* const sqes = mmap(nullptr, this->m_SqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQES);
+
+        if (sqes == MAP_FAILED)
+        {
+            return false;
+        }
+
+        this->m_Sqes = static_cast<io_uring_sqe*>(sqes);
+
+        this->m_SqTail = RingPointer<std::atomic_uint32_t>(this->m_SqRing, params.sq_off.tail);
+        this->m_SqMask = *RingPointer<uint32_t>(this->m_SqRing, params.sq_off.ring_mask);
+        this->m_SqArray = RingPointer<uint32_t>(this->m_SqRing, params.sq_off.array);
+
+        this->m_CqHead = RingPointer<std::atomic_uint32_t>(this->m_CqRing, params.cq_off.head);
+        this->m_CqTail = RingPointer<std::atomic_uint32_t>(this->m_CqRing, params.cq_off.tail);
+        this->m_CqMask = *RingPointer<uint32_t>(this->m_CqRing, params.cq_off.ring_mask);
+        this->m_Cqes = RingPointer<io_uring_cqe>(this->m_CqRing, params.cq_off.cqes);
+
+        return true;
+    }
+
+    void LinuxIoUringFileIoQueue::OnSubmitted(size_t count)
+    {
+        (void)count;
+        this->Wake();
+    }
+
+    void LinuxIoUringFileIoQueue::Wake()
+    {
+        eventfd_write(this->m_WakeEvent.Get(), 1);
+    }
+
+    void LinuxIoUringFileIoQueue::ThreadEntryPoint()
+    {
+        std::vector<Operation*> operations(this->GetQueueDepth());
+
+        while (true)
+        {
+            if (not this->m_WakeArmed)
+            {
+                this->PrepareWake();
+                this->m_WakeArmed = true;
+                ++this->m_Unsubmitted;
+            }
+
+            // Fill free submission slots with pending requests, highest priority first.
+            size_t const available = this->GetQueueDepth() - this->m_InFlight;
+            size_t const count = this->Dequeue(std::span{operations}.first(available));
+
+            size_t prepared = 0;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                Operation& operation = *operations[i];
+
+                if (this->Prepare(operation))
+                {
+                    ++prepared;
+                }
+                else
+                {
+                    this->Complete(operation, Execute(operation.Request));
+                }
+            }
+
+            this->m_InFlight += static_cast<uint32_t>(prepared);
+            this->m_Unsubmitted += static_cast<uint32_t>(prepared);
+
+            if ((this->m_InFlight == 0) and this->m_Stopping.load(std::memory_order::acquire))
+            {
+                // Queue is drained.
+                break;
+            }
+
+            // Submit new entries and wait for at least one completion; new submissions complete eventfd read.
+            int const submitted = IoUringEnter(this->m_Ring.Get(), this->m_Unsubmitted, 1, IORING_ENTER_GETEVENTS);
+
+            if (submitted >= 0)
+            {
+                this->m_Unsubmitted -= static_cast<uint32_t>(submitted);
+            }
+            else
+            {
+                int const error = errno;
+
+                if ((error != EINTR) and (error != EAGAIN) and (error != EBUSY))
+                {
+                    AE_PANIC("io_uring_enter: errno = {}", error);
+                }
+            }
+
+            this->m_InFlight -= static_cast<uint32_t>(this->Reap());
+        }
+    }
+
+    bool LinuxIoUringFileIoQueue::Prepare(Operation& operation)
+    {
+        FileIoRequest const& request = operation.Request;
+
+        // Handles without file descriptor, like package files, and requests which need bounce buffer or dropping
+        // cached pages are executed by handle itself.
+        LinuxFileHandle const* const file = dynamic_cast<LinuxFileHandle const*>(request.File.Get());
+
+        if ((file == nullptr) or not file->IsNativeRequest(request.Buffer.data(), request.Buffer.size(), request.Position))
+        {
+            return false;
+        }
+
+        // Only thread owning the ring writes submission queue tail.
+        uint32_t const tail = this->m_SqTail->load(std::memory_order::relaxed);
+        uint32_t const index = tail & this->m_SqMask;
+
+        io_uring_sqe& sqe = this->m_Sqes[index];
+        sqe = {};
+        sqe.opcode = (request.Operation == FileIoOperation::Read) ? IORING_OP_READ : IORING_OP_WRITE;
+        sqe.fd = file->GetNativeHandle().Get();
+        sqe.off = request.Position;
+        sqe.addr = std::bit_cast<uintptr_t>(request.Buffer.data());
+        sqe.len = static_cast<uint32_t>(Interop::Linux::ValidateIoRequestLength(request.Buffer.size()));
+        sqe.user_data = std::bit_cast<uintptr_t>(&operation);
+
+        this->m_SqArray[index] = index;
+        this->m_SqTail->store(tail + 1, std::memory_order::release);
+
+        return true;
+    }
+
+    void LinuxIoUringFileIoQueue::PrepareWake()
+    {
+        uint32_t const tail = this->m_SqTail->load(std::memory_order::relaxed);
+        uint32_t const index = tail & this->m_SqMask;
+
+        io_uring_sqe& sqe = this->m_Sqes[index];
+        sqe = {};
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = this->m_WakeEvent.Get();
+        sqe.addr = std::bit_cast<uintptr_t>(&this->m_WakeValue);
+        sqe.len = sizeof(this->m_WakeValue);
+        sqe.user_data = WakeUserData;
+
+        this->m_SqArray[index] = index;
+        this->m_SqTail->store(tail + 1, std::memory_order::release);
+    }
+
+    size_t LinuxIoUringFileIoQueue::Reap()
+    {
+        uint32_t head = this->m_CqHead->load(std::memory_order::relaxed);
+        uint32_t const tail = this->m_CqTail->load(std::memory_order::acquire);
+
+        size_t result = 0;
+
+        for (; head != tail; ++head)
+        {
+            io_uring_cqe const& cqe = this->m_Cqes[head & this->m_CqMask];
+
+            if (cqe.user_data == WakeUserData)
+            {
+                // Eventfd counter was consumed; read is queued again before next wait.
+                this->m_WakeArmed = false;
+                continue;
+            }
+
+            Operation& operation = *std::bit_cast<Operation*>(static_cast<uintptr_t>(cqe.user_data));
+
+            if (cqe.res < 0)
+            {
+                this->Complete(operation, std::unexpected(Debug::TranslateErrorCodeErrno(-cqe.res)));
+            }
+            else
+            {
+                this->Complete(operation, static_cast<size_t>(cqe.res));
+            }
+
+            ++result;
+        }
+
+        this->m_CqHead->store(head, std::memory_order::release);
+
+        return result;
+    }
+}
+
+namespace Anemone
+{
+    std::unique_ptr<FileIoQueue> FileIoQueue::Create(TaskScheduler& scheduler, FileIoQueueOptions const& options)
+    {
+        if (not options.ForceThreadPool)
+        {
+            if (std::unique_ptr<LinuxIoUringFileIoQueue> queue = LinuxIoUringFileIoQueue::TryCreate(scheduler, options.QueueDepth))
+            {
+                return queue;
+            }
+        }
+
+        return CreateThreadPool(scheduler, options);
+    }
+}
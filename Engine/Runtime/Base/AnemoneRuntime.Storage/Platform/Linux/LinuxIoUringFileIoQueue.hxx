@@ -0,0 +1,86 @@
+#pragma once
+#include "AnemoneRuntime.Storage/FileIoQueue.hxx"
+#include "AnemoneRuntime.Interop/Linux/SafeHandle.hxx"
+#include "AnemoneRuntime.Threading/Thread.hxx"
+
+#include <linux/io_uring.h>
+
+namespace Anemone
+{
+    //! File I/O queue backed by io_uring.
+    //!
+    //! Single thread owns the ring: it moves pending requests to submission queue, submits them with one system
+    //! call and reaps completions. Ring keeps read of eventfd in flight; submitting requests signals eventfd, so
+    //! thread waiting for completions picks them up right away.
+    class LinuxIoUringFileIoQueue final : public FileIoQueue
+    {
+    private:
+        //! Target of eventfd read; declared before ring, so it outlives read pending when ring is closed.
+        uint64_t m_WakeValue{};
+
+        Interop::Linux::SafeFdHandle m_Ring{};
+        Interop::Linux::SafeFdHandle m_WakeEvent{};
+
+        //! Whether eventfd read is queued in the ring.
+        bool m_WakeArmed{};
+
+        // Submission queue ring.
+        void* m_SqRing{};
+        size_t m_SqRingSize{};
+        std::atomic_uint32_t* m_SqTail{};
+        uint32_t m_SqMask{};
+        uint32_t* m_SqArray{};
+        io_uring_sqe* m_Sqes{};
+        size_t m_SqesSize{};
+
+        // Completion queue ring; may share mapping with submission queue.
+        void* m_CqRing{};
+        size_t m_CqRingSize{};
+        std::atomic_uint32_t* m_CqHead{};
+        std::atomic_uint32_t* m_CqTail{};
+        uint32_t m_CqMask{};
+        io_uring_cqe* m_Cqes{};
+
+        uint32_t m_InFlight{};
+
+        //! Number of prepared entries not yet consumed by kernel.
+        uint32_t m_Unsubmitted{};
+
+        Reference<Thread> m_Thread{};
+        std::atomic_bool m_Stopping{};
+
+    public:
+        explicit LinuxIoUringFileIoQueue(TaskScheduler& scheduler, uint32_t queueDepth);
+        LinuxIoUringFileIoQueue(LinuxIoUringFileIoQueue const&) = delete;
+        LinuxIoUringFileIoQueue(LinuxIoUringFileIoQueue&&) = delete;
+        LinuxIoUringFileIoQueue& operator=(LinuxIoUringFileIoQueue const&) = delete;
+        LinuxIoUringFileIoQueue& operator=(LinuxIoUringFileIoQueue&&) = delete;
+        ~LinuxIoUringFileIoQueue() override;
+
+        //! Creates queue, or returns null when kernel does not support io_uring or it is disabled.
+        static std::unique_ptr<LinuxIoUringFileIoQueue> TryCreate(TaskScheduler& scheduler, uint32_t queueDepth);
+
+    public:
+        std::string_view GetBackendName() const override
+        {
+            return "io_uring";
+        }
+
+    protected:
+        void OnSubmitted(size_t count) override;
+
+    private:
+        bool Initialize();
+
+        void ThreadEntryPoint();
+
+        //! Queues request in submission ring; returns false when request has to be executed with blocking call.
+        bool Prepare(Operation& operation);
+
+        void PrepareWake();
+
+        void Wake();
+
+        size_t Reap();
+    };
+}
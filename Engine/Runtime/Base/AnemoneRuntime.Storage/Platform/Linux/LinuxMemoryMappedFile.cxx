@@ -0,0 +1,383 @@
+#include "AnemoneRuntime.Storage/Platform/Linux/LinuxMemoryMappedFile.hxx"
+#include "AnemoneRuntime.Base/Bitwise.hxx"
+#include "AnemoneRuntime.Interop/Linux/FileSystem.hxx"
+
+#include <bit>
+
+namespace Anemone
+{
+    namespace
+    {
+        //! Size of transparent huge page on x86-64 and arm64 with 4 KiB pages.
+        constexpr size_t HugePageSize = size_t{2} << 20u;
+
+        size_t GetSystemPageSize()
+        {
+            static size_t const pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            return pageSize;
+        }
+
+        constexpr int TranslateCreationFlags(FileMode mode)
+        {
+            switch (mode)
+            {
+            case FileMode::CreateNew:
+                return O_CREAT | O_EXCL;
+
+            case FileMode::Create:
+                return O_CREAT | O_TRUNC;
+
+            case FileMode::Open:
+                return 0;
+
+            case FileMode::Append:
+            case FileMode::OpenOrCreate:
+                return O_CREAT;
+
+            case FileMode::Truncate:
+                return O_TRUNC;
+            }
+
+            return 0;
+        }
+
+        constexpr bool IsWritable(MemoryMappedFileAccess access)
+        {
+            switch (access)
+            {
+            case MemoryMappedFileAccess::Read:
+            case MemoryMappedFileAccess::ReadExecute:
+            case MemoryMappedFileAccess::CopyOnWrite:
+                return false;
+
+            case MemoryMappedFileAccess::ReadWrite:
+            case MemoryMappedFileAccess::Write:
+            case MemoryMappedFileAccess::ReadWriteExecute:
+                return true;
+            }
+
+            return false;
+        }
+
+        constexpr int GetPageProtection(MemoryMappedFileAccess access)
+        {
+            switch (access)
+            {
+            case MemoryMappedFileAccess::Read:
+                return PROT_READ;
+
+            case MemoryMappedFileAccess::ReadWrite:
+            case MemoryMappedFileAccess::Write:
+            case MemoryMappedFileAccess::CopyOnWrite:
+                return PROT_READ | PROT_WRITE;
+
+            case MemoryMappedFileAccess::ReadExecute:
+                return PROT_READ | PROT_EXEC;
+
+            case MemoryMappedFileAccess::ReadWriteExecute:
+                return PROT_READ | PROT_WRITE | PROT_EXEC;
+            }
+
+            return PROT_READ;
+        }
+
+        constexpr int GetMapFlags(MemoryMappedFileAccess access)
+        {
+            // Private mapping never writes modified pages back to file.
+            return (access == MemoryMappedFileAccess::CopyOnWrite) ? MAP_PRIVATE : MAP_SHARED;
+        }
+
+        void Advise(void* address, size_t size, int advice)
+        {
+            // Advice is only a hint; kernels without support for given advice fail with EINVAL. EAGAIN reports
+            // transient lack of resources, so it is retried few times before advice is dropped.
+            constexpr int MaxAttempts = 4;
+
+            for (int attempt = 0; attempt < MaxAttempts; ++attempt)
+            {
+                if ((madvise(address, size, advice) == 0) or (errno != EAGAIN))
+                {
+                    break;
+                }
+            }
+        }
+
+        //! Reserves range where file offset and address are congruent modulo huge page size, which is required
+        //! for page cache to back mapping with huge pages.
+        void* ReserveHugePageAlignedRange(size_t size, size_t fileOffset)
+        {
+            size_t const reservedSize = size + HugePageSize;
+
+            void* const reserved = mmap(nullptr, reservedSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+            if (reserved == MAP_FAILED)
+            {
+                return nullptr;
+            }
+
+            uintptr_t const reservedStart = std::bit_cast<uintptr_t>(reserved);
+            uintptr_t const reservedEnd = reservedStart + reservedSize;
+            uintptr_t const shift = ((fileOffset % HugePageSize) - (reservedStart % HugePageSize) + HugePageSize) % HugePageSize;
+            uintptr_t const start = reservedStart + shift;
+            uintptr_t const end = start + size;
+
+            if (start != reservedStart)
+            {
+                munmap(reserved, start - reservedStart);
+            }
+
+            if (end != reservedEnd)
+            {
+                munmap(std::bit_cast<void*>(end), reservedEnd - end);
+            }
+
+            return std::bit_cast<void*>(start);
+        }
+    }
+
+    LinuxMemoryMappedFile::~LinuxMemoryMappedFile() = default;
+
+    Reference<LinuxMemoryMappedFile> LinuxMemoryMappedFile::Create(std::string_view path, FileMode mode, uint64_t capacity, MemoryMappedFileAccess access)
+    {
+        Interop::Linux::FilePath const filePath{path};
+
+        if (access == MemoryMappedFileAccess::Write)
+        {
+            // Write access is not supported for memory mapped files.
+            return {};
+        }
+
+        if ((mode == FileMode::Append) or (mode == FileMode::Truncate))
+        {
+            // Not useful for memory mapped files
+            return {};
+        }
+
+        if ((mode == FileMode::Create) and not IsWritable(access))
+        {
+            // Existing file would be truncated before mapping, without access to write new content.
+            return {};
+        }
+
+        bool existed = false;
+
+        if (mode == FileMode::Open)
+        {
+            existed = true;
+        }
+        else if (mode != FileMode::CreateNew)
+        {
+            struct stat64 st{};
+            existed = (stat64(filePath.c_str(), &st) == 0) and S_ISREG(st.st_mode);
+        }
+
+        bool const writable = IsWritable(access);
+
+        int const flags = TranslateCreationFlags(mode) | O_CLOEXEC | (writable ? O_RDWR : O_RDONLY);
+
+        Interop::Linux::SafeFdHandle fileHandle{open(filePath.c_str(), flags, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH)};
+
+        if (not fileHandle)
+        {
+            return {};
+        }
+
+        auto fail = [&]() -> Reference<LinuxMemoryMappedFile>
+        {
+            fileHandle = {};
+
+            if (not existed)
+            {
+                // If the file did not exist, we delete it.
+                unlink(filePath.c_str());
+            }
+
+            return {};
+        };
+
+        struct stat64 st{};
+
+        if (fstat64(fileHandle.Get(), &st) < 0)
+        {
+            return fail();
+        }
+
+        uint64_t const fileSize = static_cast<uint64_t>(st.st_size);
+
+        if ((capacity == 0) and (fileSize == 0))
+        {
+            return fail();
+        }
+
+        if (capacity > fileSize)
+        {
+            // Accessing pages past end of file raises SIGBUS, so file must be extended up front.
+            if (not writable)
+            {
+                return fail();
+            }
+
+            int result;
+
+            do
+            {
+                result = ftruncate64(fileHandle.Get(), static_cast<off64_t>(capacity));
+            } while ((result < 0) and (errno == EINTR));
+
+            if (result < 0)
+            {
+                return fail();
+            }
+        }
+
+        return MakeReference<LinuxMemoryMappedFile>(std::move(fileHandle));
+    }
+
+    void LinuxMemoryMappedFile::Flush()
+    {
+        int result;
+
+        do
+        {
+            result = fsync(this->_fileHandle.Get());
+        } while ((result < 0) and (errno == EINTR));
+    }
+
+    Reference<MemoryMappedFileView> LinuxMemoryMappedFile::CreateView(MemoryMappedFileAccess access, size_t offset, size_t length, Flags<MemoryMappedFileViewOption> options)
+    {
+        size_t const alignment = GetSystemPageSize();
+
+        // File may be resized by other handles, so its current size is validated for every view.
+        struct stat64 st{};
+
+        if (fstat64(this->_fileHandle.Get(), &st) < 0)
+        {
+            return {};
+        }
+
+        size_t const fileSize = static_cast<size_t>(st.st_size);
+
+        if (offset >= fileSize)
+        {
+            return {};
+        }
+
+        if (length == 0)
+        {
+            // If length is not specified, we use the file size.
+            length = fileSize - offset;
+        }
+        else if (length > (fileSize - offset))
+        {
+            // Accessing pages past end of file raises SIGBUS.
+            return {};
+        }
+
+        size_t const mapBase = AlignDown(offset, alignment);
+        size_t const viewDelta = offset - mapBase;
+        size_t const mapSize = AlignUp(viewDelta + length, alignment);
+
+        int flags = GetMapFlags(access);
+
+        if (options.Has(MemoryMappedFileViewOption::Populate))
+        {
+            flags |= MAP_POPULATE;
+        }
+
+        void* address = nullptr;
+
+        bool const hugePages = options.Has(MemoryMappedFileViewOption::HugePages) and (mapSize >= HugePageSize);
+
+        if (hugePages)
+        {
+            if ((address = ReserveHugePageAlignedRange(mapSize, mapBase)))
+            {
+                flags |= MAP_FIXED;
+            }
+        }
+
+        void* const mapData = mmap(address, mapSize, GetPageProtection(access), flags, this->_fileHandle.Get(), static_cast<off_t>(mapBase));
+
+        if (mapData == MAP_FAILED)
+        {
+            if (address != nullptr)
+            {
+                munmap(address, mapSize);
+            }
+
+            return {};
+        }
+
+        if (hugePages)
+        {
+            Advise(mapData, mapSize, MADV_HUGEPAGE);
+        }
+
+        if (options.Has(MemoryMappedFileViewOption::SequentialAccess))
+        {
+            Advise(mapData, mapSize, MADV_SEQUENTIAL);
+        }
+        else if (options.Has(MemoryMappedFileViewOption::RandomAccess))
+        {
+            Advise(mapData, mapSize, MADV_RANDOM);
+        }
+
+        if (options.Has(MemoryMappedFileViewOption::WillNeed))
+        {
+            Advise(mapData, mapSize, MADV_WILLNEED);
+        }
+
+        return MakeReference<LinuxMemoryMappedFileView>(
+            Reference{this},
+            static_cast<std::byte*>(mapData),
+            mapSize,
+            viewDelta,
+            length);
+    }
+}
+
+namespace Anemone
+{
+    LinuxMemoryMappedFileView::~LinuxMemoryMappedFileView()
+    {
+        if (munmap(this->_mapData, this->_mapSize) == -1)
+        {
+            AE_PANIC("munmap: errno = {}", errno);
+        }
+    }
+
+    std::span<std::byte const> LinuxMemoryMappedFileView::GetData() const
+    {
+        return std::span<std::byte const>{this->_mapData + this->_offset, this->_size};
+    }
+
+    std::span<std::byte> LinuxMemoryMappedFileView::GetData()
+    {
+        return std::span<std::byte>{this->_mapData + this->_offset, this->_size};
+    }
+
+    void LinuxMemoryMappedFileView::Flush()
+    {
+        msync(this->_mapData, this->_mapSize, MS_SYNC);
+    }
+
+    void LinuxMemoryMappedFileView::Prefetch(size_t offset, size_t length)
+    {
+        AE_ASSERT((offset + length) <= this->_size);
+
+        // Read-ahead is started for whole pages; kernel reads them in background.
+        size_t const alignment = GetSystemPageSize();
+        size_t const start = AlignDown(this->_offset + offset, alignment);
+        size_t const end = AlignUp(this->_offset + offset + length, alignment);
+
+        Advise(this->_mapData + start, end - start, MADV_WILLNEED);
+    }
+}
+
+namespace Anemone
+{
+    Reference<MemoryMappedFile> MemoryMappedFile::Create(std::string_view path, FileMode mode, uint64_t capacity, MemoryMappedFileAccess access)
+    {
+        return LinuxMemoryMappedFile::Create(path, mode, capacity, access);
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include "AnemoneRuntime.Storage/MemoryMappedFile.hxx"
+#include "AnemoneRuntime.Interop/Linux/SafeHandle.hxx"
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
+
+namespace Anemone
+{
+    class LinuxMemoryMappedFileView;
+
+    class LinuxMemoryMappedFile final : public MemoryMappedFile
+    {
+        friend class LinuxMemoryMappedFileView;
+
+    private:
+        Interop::Linux::SafeFdHandle _fileHandle;
+
+    public:
+        explicit LinuxMemoryMappedFile(Interop::Linux::SafeFdHandle fileHandle)
+            : _fileHandle{std::move(fileHandle)}
+        {
+            AE_ASSERT(this->_fileHandle);
+        }
+
+        ~LinuxMemoryMappedFile() override;
+
+        static Reference<LinuxMemoryMappedFile> Create(std::string_view path, FileMode mode, uint64_t capacity, MemoryMappedFileAccess access);
+
+        void Flush() override;
+
+        Reference<MemoryMappedFileView> CreateView(MemoryMappedFileAccess access, size_t offset = 0, size_t length = 0, Flags<MemoryMappedFileViewOption> options = MemoryMappedFileViewOption::None) override;
+    };
+
+    class LinuxMemoryMappedFileView final : public MemoryMappedFileView
+    {
+        friend class LinuxMemoryMappedFile;
+
+    public:
+        LinuxMemoryMappedFileView(Reference<LinuxMemoryMappedFile> owner, std::byte* mapData, size_t mapSize, size_t offset, size_t size)
+            : _owner{std::move(owner)}
+            , _mapData{mapData}
+            , _mapSize{mapSize}
+            , _offset{offset}
+            , _size{size}
+        {
+        }
+
+        LinuxMemoryMappedFileView(LinuxMemoryMappedFileView const&) = delete;
+
+        LinuxMemoryMappedFileView(LinuxMemoryMappedFileView&&) noexcept = delete;
+
+        ~LinuxMemoryMappedFileView() override;
+
+        LinuxMemoryMappedFileView& operator=(LinuxMemoryMappedFileView const&) = delete;
+
+        LinuxMemoryMappedFileView& operator=(LinuxMemoryMappedFileView&&) noexcept = delete;
+
+        std::span<std::byte const> GetData() const override;
+
+        std::span<std::byte> GetData() override;
+
+        void Flush() override;
+
+        void Prefetch(size_t offset, size_t length) override;
+
+    private:
+        Reference<LinuxMemoryMappedFile> _owner{};
+        std::byte* _mapData{};
+        size_t _mapSize{};
+        size_t _offset;
+        size_t _size;
+    };
+}
@@ -0,0 +1,10 @@
+#include "AnemoneRuntime.Storage/FileIoQueue.hxx"
+
+namespace Anemone
+{
+    std::unique_ptr<FileIoQueue> FileIoQueue::Create(TaskScheduler& scheduler, FileIoQueueOptions const& options)
+    {
+        // Windows uses thread pool backend.
+        return CreateThreadPool(scheduler, options);
+    }
+}
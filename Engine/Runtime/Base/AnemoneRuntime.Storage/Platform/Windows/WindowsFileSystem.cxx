@@ -1,5 +1,6 @@
 #include "AnemoneRuntime.Storage/Platform/Windows/WindowsFileSystem.hxx"
 #include "AnemoneRuntime.Storage/Platform/Windows/WindowsFileHandle.hxx"
+#include "AnemoneRuntime.Storage/FilePath.hxx"
 #include "AnemoneRuntime.Interop/Windows/FileSystem.hxx"
 #include "AnemoneRuntime.Base/UninitializedObject.hxx"
 #include "AnemoneRuntime.Diagnostics/Trace.hxx"
@@ -349,11 +350,6 @@ namespace Anemone
                 result |= FILE_FLAG_WRITE_THROUGH;
             }
 
-            if (options.Has(FileOption::NoBuffering))
-            {
-                result |= FILE_FLAG_NO_BUFFERING;
-            }
-
             if (options.Has(FileOption::Temporary))
             {
                 result |= FILE_ATTRIBUTE_TEMPORARY;
@@ -395,6 +391,13 @@ namespace Anemone
             Flags<FileOption> options)
             -> std::expected<Reference<FileHandle>, Error>
         {
+            if (options.Has(FileOption::NoBuffering))
+            {
+                // FILE_FLAG_NO_BUFFERING requires sector aligned requests; handle neither reports sector size nor
+                // aligns requests through bounce buffer.
+                return std::unexpected(Error::NotSupported);
+            }
+
             DWORD const dwCreationDisposition = TranslateCreationDisposition(mode);
             DWORD const dwAccess = TranslateFileAccess(access);
             DWORD const dwShare = TranslateFileShare(options);
@@ -448,17 +451,19 @@ namespace Anemone
     WindowsFileSystem::WindowsFileSystem() = default;
 
     auto WindowsFileSystem::CreateFileReader(
-        std::string_view path)
+        std::string_view path,
+        Flags<FileOption> options)
         -> std::expected<Reference<FileHandle>, Error>
     {
-        return InternalCreateFile(path, FileMode::Open, FileAccess::Read, FileOption::None);
+        return InternalCreateFile(path, FileMode::Open, FileAccess::Read, options);
     }
 
     auto WindowsFileSystem::CreateFileWriter(
-        std::string_view path)
+        std::string_view path,
+        Flags<FileOption> options)
         -> std::expected<Reference<FileHandle>, Error>
     {
-        return InternalCreateFile(path, FileMode::Create, FileAccess::Write, FileOption::None);
+        return InternalCreateFile(path, FileMode::Create, FileAccess::Write, options);
     }
 
     auto WindowsFileSystem::Exists(
@@ -891,7 +896,10 @@ namespace Anemone
 
                 if (info.Type == FileType::Directory)
                 {
-                    (void)this->_owner->DirectoryEnumerate(path, *this->_visitor);
+                    // Visited path is parent directory of entry.
+                    std::string child{path};
+                    FilePath::PushFragment(child, name);
+                    (void)this->_owner->DirectoryEnumerate(child, *this);
                 }
             }
         };
@@ -23,11 +23,13 @@ namespace Anemone
 
     public:
         auto CreateFileReader(
-            std::string_view path)
+            std::string_view path,
+            Flags<FileOption> options = FileOption::None)
             -> std::expected<Reference<FileHandle>, Error> override;
 
         auto CreateFileWriter(
-            std::string_view path)
+            std::string_view path,
+            Flags<FileOption> options = FileOption::None)
             -> std::expected<Reference<FileHandle>, Error> override;
 
         auto GetPathInfo(
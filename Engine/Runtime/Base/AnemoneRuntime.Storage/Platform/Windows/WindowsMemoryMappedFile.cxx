@@ -144,6 +144,12 @@ namespace Anemone
             return {};
         }
 
+        if ((mode == FileMode::Create) and (access != MemoryMappedFileAccess::ReadWrite) and (access != MemoryMappedFileAccess::ReadWriteExecute))
+        {
+            // Existing file would be truncated before mapping, without access to write new content.
+            return {};
+        }
+
         bool existed = false;
 
         if (mode == FileMode::Open)
@@ -250,21 +256,31 @@ namespace Anemone
         FlushFileBuffers(this->_fileHandle.Get());
     }
 
-    Reference<MemoryMappedFileView> WindowsMemoryMappedFile::CreateView(MemoryMappedFileAccess access, size_t offset, size_t length)
+    Reference<MemoryMappedFileView> WindowsMemoryMappedFile::CreateView(MemoryMappedFileAccess access, size_t offset, size_t length, Flags<MemoryMappedFileViewOption> options)
     {
         size_t const alignment = GetSystemPageSize();
 
+        LARGE_INTEGER liFileSize{};
+        if (not GetFileSizeEx(this->_fileHandle.Get(), &liFileSize))
+        {
+            return {};
+        }
+
+        size_t const fileSize = std::bit_cast<size_t>(liFileSize.QuadPart);
+
+        if (offset >= fileSize)
+        {
+            return {};
+        }
+
         if (length == 0)
         {
             // If length is not specified, we use the file size.
-            LARGE_INTEGER liFileSize{};
-            if (not GetFileSizeEx(this->_fileHandle.Get(), &liFileSize))
-            {
-                return {};
-            }
-
-            // Include offset in the length calculation.
-            length = std::bit_cast<size_t>(liFileSize.QuadPart) - offset;
+            length = fileSize - offset;
+        }
+        else if (length > (fileSize - offset))
+        {
+            return {};
         }
 
         size_t const mapBase = AlignDown(offset, alignment);
@@ -286,11 +302,19 @@ namespace Anemone
             return {};
         }
 
-        return MakeReference<WindowsMemoryMappedFileView>(
+        Reference<WindowsMemoryMappedFileView> result = MakeReference<WindowsMemoryMappedFileView>(
             Reference{this},
             std::move(mapView),
             viewDelta,
             length);
+
+        // Access pattern and huge page hints have no equivalent for file mappings.
+        if (options.Any(Flags{MemoryMappedFileViewOption::Populate} | MemoryMappedFileViewOption::WillNeed))
+        {
+            result->Prefetch(0, length);
+        }
+
+        return result;
     }
 }
 
@@ -310,6 +334,18 @@ namespace Anemone
     {
         FlushViewOfFile(this->_mapData.GetData(), this->_mapData.GetSize());
     }
+
+    void WindowsMemoryMappedFileView::Prefetch(size_t offset, size_t length)
+    {
+        std::span<std::byte> const data = this->GetData().subspan(offset, length);
+
+        WIN32_MEMORY_RANGE_ENTRY range{
+            .VirtualAddress = data.data(),
+            .NumberOfBytes = data.size(),
+        };
+
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
 }
 
 namespace Anemone
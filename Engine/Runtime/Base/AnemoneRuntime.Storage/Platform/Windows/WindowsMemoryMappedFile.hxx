@@ -36,7 +36,7 @@ namespace Anemone
 
         void Flush() override;
 
-        Reference<MemoryMappedFileView> CreateView(MemoryMappedFileAccess access, size_t offset = 0, size_t length = 0) override;
+        Reference<MemoryMappedFileView> CreateView(MemoryMappedFileAccess access, size_t offset = 0, size_t length = 0, Flags<MemoryMappedFileViewOption> options = MemoryMappedFileViewOption::None) override;
     };
 
     class WindowsMemoryMappedFileView final : public MemoryMappedFileView
@@ -68,6 +68,8 @@ namespace Anemone
 
         void Flush() override;
 
+        void Prefetch(size_t offset, size_t length) override;
+
     private:
         Reference<WindowsMemoryMappedFile> _owner{};
         Interop::Windows::SafeMemoryMappedViewHandle _mapData{};
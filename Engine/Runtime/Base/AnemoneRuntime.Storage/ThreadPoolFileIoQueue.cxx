@@ -0,0 +1,70 @@
+#include "AnemoneRuntime.Storage/ThreadPoolFileIoQueue.hxx"
+#include "AnemoneRuntime.Threading/Runnable.hxx"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+namespace Anemone
+{
+    ThreadPoolFileIoQueue::ThreadPoolFileIoQueue(TaskScheduler& scheduler, FileIoQueueOptions const& options)
+        : FileIoQueue{scheduler, options.QueueDepth}
+    {
+        // Each thread keeps single request in flight.
+        uint32_t const threadCount = std::clamp<uint32_t>(options.ThreadCount, 1, this->GetQueueDepth());
+
+        this->m_Threads.reserve(threadCount);
+
+        for (uint32_t i = 0; i < threadCount; ++i)
+        {
+            this->m_Threads.push_back(Thread::Start(
+                ThreadStart{
+                    .Name = fmt::format("FileIo-{}", i),
+                    .Priority = ThreadPriority::AboveNormal,
+                    .Callback = MakeRunnable([this]
+                    {
+                        this->ThreadEntryPoint();
+                    }),
+                }));
+        }
+    }
+
+    ThreadPoolFileIoQueue::~ThreadPoolFileIoQueue()
+    {
+        this->m_Stopping.store(true, std::memory_order::release);
+        this->m_Available.Release(static_cast<int32_t>(this->m_Threads.size()));
+
+        for (Reference<Thread> const& thread : this->m_Threads)
+        {
+            thread->Join();
+        }
+    }
+
+    void ThreadPoolFileIoQueue::OnSubmitted(size_t count)
+    {
+        this->m_Available.Release(static_cast<int32_t>(count));
+    }
+
+    void ThreadPoolFileIoQueue::ThreadEntryPoint()
+    {
+        while (true)
+        {
+            this->m_Available.Acquire();
+
+            Operation* operation{};
+
+            if (this->Dequeue(std::span{&operation, 1}) == 0)
+            {
+                if (this->m_Stopping.load(std::memory_order::acquire))
+                {
+                    // Queue is drained.
+                    break;
+                }
+
+                continue;
+            }
+
+            this->Complete(*operation, Execute(operation->Request));
+        }
+    }
+}
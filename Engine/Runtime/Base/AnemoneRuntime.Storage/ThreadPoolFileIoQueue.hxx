@@ -0,0 +1,42 @@
+#pragma once
+#include "AnemoneRuntime.Storage/FileIoQueue.hxx"
+#include "AnemoneRuntime.Threading/Semaphore.hxx"
+#include "AnemoneRuntime.Threading/Thread.hxx"
+
+namespace Anemone
+{
+    //! File I/O queue which executes requests with blocking reads and writes on pool of threads.
+    //!
+    //! Used where platform has no native asynchronous I/O. Number of requests in flight is limited by number of
+    //! threads.
+    class ANEMONE_RUNTIME_BASE_API ThreadPoolFileIoQueue final : public FileIoQueue
+    {
+    private:
+        std::vector<Reference<Thread>> m_Threads{};
+
+        //! Counts queued requests, plus one permit per thread when stopping.
+        Semaphore m_Available{0};
+
+        std::atomic_bool m_Stopping{};
+
+    public:
+        ThreadPoolFileIoQueue(TaskScheduler& scheduler, FileIoQueueOptions const& options);
+        ThreadPoolFileIoQueue(ThreadPoolFileIoQueue const&) = delete;
+        ThreadPoolFileIoQueue(ThreadPoolFileIoQueue&&) = delete;
+        ThreadPoolFileIoQueue& operator=(ThreadPoolFileIoQueue const&) = delete;
+        ThreadPoolFileIoQueue& operator=(ThreadPoolFileIoQueue&&) = delete;
+        ~ThreadPoolFileIoQueue() override;
+
+    public:
+        std::string_view GetBackendName() const override
+        {
+            return "ThreadPool";
+        }
+
+    protected:
+        void OnSubmitted(size_t count) override;
+
+    private:
+        void ThreadEntryPoint();
+    };
+}
@@ -3,6 +3,13 @@
 
 #include <sys/auxv.h>
 
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cstdio>
+#include <optional>
+
 #if ANEMONE_ARCHITECTURE_X64
 #include <cpuid.h>
 #elif ANEMONE_ARCHITECTURE_ARM64
@@ -14,13 +21,295 @@ namespace Anemone
     namespace
     {
         UninitializedObject<LinuxProcessorProperties> gLinuxProcessorProperties{};
+
+        // Buffer large enough for CPU lists of large systems.
+        using SysfsBuffer = std::array<char, 4096>;
+
+        std::optional<std::string_view> ReadSysfsText(char const* path, SysfsBuffer& buffer)
+        {
+            FILE* const f = fopen(path, "r");
+
+            if (f == nullptr)
+            {
+                return std::nullopt;
+            }
+
+            char const* const line = fgets(buffer.data(), static_cast<int>(buffer.size()), f);
+            fclose(f);
+
+            if (line == nullptr)
+            {
+                return std::nullopt;
+            }
+
+            std::string_view result{line};
+
+            while (not result.empty() and std::isspace(static_cast<unsigned char>(result.back())))
+            {
+                result.remove_suffix(1);
+            }
+
+            return result;
+        }
+
+        //! Reads number from sysfs file. Supports size suffixes used by cache attributes.
+        std::optional<size_t> ReadSysfsNumber(char const* path)
+        {
+            SysfsBuffer buffer;
+
+            if (auto const text = ReadSysfsText(path, buffer))
+            {
+                size_t value{};
+                auto const [ptr, ec] = std::from_chars(text->data(), text->data() + text->size(), value);
+
+                if (ec == std::errc{})
+                {
+                    switch ((ptr != (text->data() + text->size())) ? *ptr : '\0')
+                    {
+                    case 'K':
+                        return value << 10u;
+
+                    case 'M':
+                        return value << 20u;
+
+                    case 'G':
+                        return value << 30u;
+
+                    default:
+                        return value;
+                    }
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        //! Parses CPU list in "0-3,8,10-11" format.
+        template <typename CallbackT = void(uint32_t)>
+        void ParseCpuList(std::string_view list, CallbackT&& callback)
+        {
+            while (not list.empty())
+            {
+                size_t const separator = list.find(',');
+                std::string_view const range = list.substr(0, separator);
+                list = (separator == std::string_view::npos) ? std::string_view{} : list.substr(separator + 1);
+
+                uint32_t first{};
+                auto const [ptr, ec] = std::from_chars(range.data(), range.data() + range.size(), first);
+
+                if (ec != std::errc{})
+                {
+                    return;
+                }
+
+                uint32_t last = first;
+
+                if ((ptr != (range.data() + range.size())) and (*ptr == '-'))
+                {
+                    if (std::from_chars(ptr + 1, range.data() + range.size(), last).ec != std::errc{})
+                    {
+                        return;
+                    }
+                }
+
+                for (uint32_t cpu = first; cpu <= last; ++cpu)
+                {
+                    callback(cpu);
+                }
+            }
+        }
+
+        std::optional<uint32_t> ReadFirstCpu(char const* path)
+        {
+            SysfsBuffer buffer;
+            std::optional<uint32_t> result{};
+
+            if (auto const text = ReadSysfsText(path, buffer))
+            {
+                ParseCpuList(*text, [&](uint32_t cpu)
+                {
+                    result = std::min(result.value_or(cpu), cpu);
+                });
+            }
+
+            return result;
+        }
+
+        //! Replaces keys with their rank among distinct keys. Returns number of distinct keys.
+        size_t MakeDenseIndices(std::vector<uint64_t>& keys)
+        {
+            std::vector<uint64_t> distinct = keys;
+            std::sort(distinct.begin(), distinct.end());
+            distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+
+            for (uint64_t& key : keys)
+            {
+                key = static_cast<uint64_t>(std::lower_bound(distinct.begin(), distinct.end(), key) - distinct.begin());
+            }
+
+            return distinct.size();
+        }
+
+        void DiscoverTopology(LinuxProcessorProperties& properties, cpu_set_t const* mask)
+        {
+            std::vector<uint32_t> processors{};
+
+            for (uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            {
+                if ((mask != nullptr) ? CPU_ISSET(cpu, mask) : (cpu < properties.physicalCores))
+                {
+                    processors.push_back(cpu);
+                }
+            }
+
+            std::vector<uint64_t> cores(processors.size());
+            std::vector<uint64_t> domains(processors.size());
+            std::vector<uint64_t> nodes(processors.size());
+            std::vector<uint64_t> packages(processors.size());
+
+            size_t cacheLineSize = 0;
+            size_t cacheL1 = 0;
+            size_t cacheL2 = 0;
+            size_t cacheL3 = 0;
+
+            std::array<char, 128> path;
+
+            for (size_t i = 0; i < processors.size(); ++i)
+            {
+                uint32_t const cpu = processors[i];
+
+                snprintf(path.data(), path.size(), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", cpu);
+                uint64_t const package = ReadSysfsNumber(path.data()).value_or(0);
+
+                snprintf(path.data(), path.size(), "/sys/devices/system/cpu/cpu%u/topology/core_id", cpu);
+                uint64_t const core = ReadSysfsNumber(path.data()).value_or(cpu);
+
+                packages[i] = package;
+                cores[i] = (package << 32u) | core;
+
+                // Without cache information assume that whole package shares last level cache.
+                domains[i] = package << 32u;
+                size_t lastLevel = 0;
+
+                for (uint32_t index = 0;; ++index)
+                {
+                    snprintf(path.data(), path.size(), "/sys/devices/system/cpu/cpu%u/cache/index%u/level", cpu, index);
+                    std::optional<size_t> const level = ReadSysfsNumber(path.data());
+
+                    if (not level)
+                    {
+                        break;
+                    }
+
+                    snprintf(path.data(), path.size(), "/sys/devices/system/cpu/cpu%u/cache/index%u/shared_cpu_list", cpu, index);
+                    uint32_t const owner = ReadFirstCpu(path.data()).value_or(cpu);
+
+                    if (*level >= lastLevel)
+                    {
+                        // Cache is identified by first processor sharing it.
+                        lastLevel = *level;
+                        domains[i] = (uint64_t{1} << 63u) | owner;
+                    }
+
+                    if (owner != cpu)
+                    {
+                        // Count shared caches only once.
+                        continue;
+                    }
+
+                    snprintf(path.data(), path.size(), "/sys/devices/system/cpu/cpu%u/cache/index%u/coherency_line_size", cpu, index);
+
+                    if (std::optional<size_t> const lineSize = ReadSysfsNumber(path.data()))
+                    {
+                        // Choose the smallest cache line size as the "safest" value.
+                        cacheLineSize = (cacheLineSize == 0) ? *lineSize : std::min(cacheLineSize, *lineSize);
+                    }
+
+                    snprintf(path.data(), path.size(), "/sys/devices/system/cpu/cpu%u/cache/index%u/size", cpu, index);
+                    size_t const size = ReadSysfsNumber(path.data()).value_or(0);
+
+                    switch (*level)
+                    {
+                    case 1:
+                        cacheL1 += size;
+                        break;
+
+                    case 2:
+                        cacheL2 += size;
+                        break;
+
+                    case 3:
+                        cacheL3 += size;
+                        break;
+
+                    default:
+                        break;
+                    }
+                }
+            }
+
+            // NUMA nodes list processors they own.
+            SysfsBuffer online;
+
+            if (auto const nodeList = ReadSysfsText("/sys/devices/system/node/online", online))
+            {
+                ParseCpuList(*nodeList, [&](uint32_t node)
+                {
+                    snprintf(path.data(), path.size(), "/sys/devices/system/node/node%u/cpulist", node);
+
+                    SysfsBuffer buffer;
+
+                    if (auto const cpuList = ReadSysfsText(path.data(), buffer))
+                    {
+                        ParseCpuList(*cpuList, [&](uint32_t cpu)
+                        {
+                            auto const it = std::lower_bound(processors.begin(), processors.end(), cpu);
+
+                            if ((it != processors.end()) and (*it == cpu))
+                            {
+                                nodes[static_cast<size_t>(it - processors.begin())] = node;
+                            }
+                        });
+                    }
+                });
+            }
+
+            size_t const coreCount = MakeDenseIndices(cores);
+            properties.cacheDomains = std::max<size_t>(1, MakeDenseIndices(domains));
+            properties.numaNodes = std::max<size_t>(1, MakeDenseIndices(nodes));
+            MakeDenseIndices(packages);
+
+            properties.logicalProcessors.resize(processors.size());
+
+            for (size_t i = 0; i < processors.size(); ++i)
+            {
+                properties.logicalProcessors[i] = LogicalProcessorInfo{
+                    .Index = processors[i],
+                    .Core = static_cast<uint32_t>(cores[i]),
+                    .CacheDomain = static_cast<uint32_t>(domains[i]),
+                    .NumaNode = static_cast<uint32_t>(nodes[i]),
+                    .Package = static_cast<uint32_t>(packages[i]),
+                };
+            }
+
+            if (coreCount != 0)
+            {
+                properties.physicalCores = coreCount;
+                properties.featureSmt = coreCount < processors.size();
+            }
+
+            properties.cacheLineSize = cacheLineSize;
+            properties.cacheL1 = cacheL1;
+            properties.cacheL2 = cacheL2;
+            properties.cacheL3 = cacheL3;
+        }
     }
 
     void LinuxProcessorProperties::Initialize()
     {
         gLinuxProcessorProperties.Create();
 
-        // This may not be accurate on all systems.
+        // This may not be accurate on all systems; refined from topology below.
         gLinuxProcessorProperties->physicalCores = sysconf(_SC_NPROCESSORS_CONF);
 
         cpu_set_t mask;
@@ -29,10 +318,12 @@ namespace Anemone
         if (sched_getaffinity(0, sizeof(mask), &mask) == 0)
         {
             gLinuxProcessorProperties->logicalCores = CPU_COUNT(&mask);
+            DiscoverTopology(*gLinuxProcessorProperties, &mask);
         }
         else
         {
             gLinuxProcessorProperties->logicalCores = gLinuxProcessorProperties->physicalCores;
+            DiscoverTopology(*gLinuxProcessorProperties, nullptr);
         }
 
         if (gLinuxProcessorProperties->performanceCores == 0)
@@ -205,6 +496,21 @@ namespace Anemone
         return gLinuxProcessorProperties->cacheL3;
     }
 
+    size_t ProcessorProperties::GetCacheDomainsCount()
+    {
+        return gLinuxProcessorProperties->cacheDomains;
+    }
+
+    size_t ProcessorProperties::GetNumaNodesCount()
+    {
+        return gLinuxProcessorProperties->numaNodes;
+    }
+
+    std::span<LogicalProcessorInfo const> ProcessorProperties::GetLogicalProcessors()
+    {
+        return gLinuxProcessorProperties->logicalProcessors;
+    }
+
     std::string_view ProcessorProperties::GetProcessorName()
     {
         return gLinuxProcessorProperties->processorName.as_view();
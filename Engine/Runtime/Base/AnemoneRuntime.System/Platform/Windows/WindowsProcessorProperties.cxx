@@ -9,11 +9,141 @@
 
 #include <VersionHelpers.h>
 
+#include <algorithm>
+#include <bit>
+
 namespace Anemone
 {
     namespace
     {
         UninitializedObject<WindowsProcessorProperties> gWindowsProcessorProperties{};
+
+        // Calls callback for every logical processor in group mask.
+        template <typename CallbackT = void(uint32_t)>
+        void EnumerateGroupAffinity(GROUP_AFFINITY const& affinity, CallbackT&& callback)
+        {
+            KAFFINITY mask = affinity.Mask;
+
+            while (mask != 0)
+            {
+                uint32_t const bit = static_cast<uint32_t>(std::countr_zero(mask));
+                mask &= mask - 1;
+
+                callback((static_cast<uint32_t>(affinity.Group) * 64u) + bit);
+            }
+        }
+
+        void DiscoverTopology(WindowsProcessorProperties& properties)
+        {
+            Interop::memory_buffer<4096> buffer{};
+
+            std::vector<LogicalProcessorInfo>& processors = properties.logicalProcessors;
+
+            auto find = [&](uint32_t index) -> LogicalProcessorInfo*
+            {
+                auto const it = std::lower_bound(processors.begin(), processors.end(), index, [](LogicalProcessorInfo const& item, uint32_t value)
+                {
+                    return item.Index < value;
+                });
+
+                return ((it != processors.end()) and (it->Index == index)) ? &*it : nullptr;
+            };
+
+            // Cores are enumerated in order; their position is used as dense core index.
+            if (SUCCEEDED(Interop::Windows::GetLogicalProcessorInformationEx(buffer, RelationProcessorCore)))
+            {
+                uint32_t core = 0;
+
+                Interop::Windows::EnumerateLogicalProcessorInformation(buffer.as_span(), [&](SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const& current)
+                {
+                    for (size_t i = 0; i < current.Processor.GroupCount; ++i)
+                    {
+                        EnumerateGroupAffinity(current.Processor.GroupMask[i], [&](uint32_t index)
+                        {
+                            processors.push_back(LogicalProcessorInfo{.Index = index, .Core = core});
+                        });
+                    }
+
+                    ++core;
+                });
+
+                std::sort(processors.begin(), processors.end(), [](LogicalProcessorInfo const& left, LogicalProcessorInfo const& right)
+                {
+                    return left.Index < right.Index;
+                });
+            }
+
+            if (SUCCEEDED(Interop::Windows::GetLogicalProcessorInformationEx(buffer, RelationCache)))
+            {
+                BYTE lastLevel = 0;
+
+                Interop::Windows::EnumerateLogicalProcessorInformation(buffer.as_span(), [&](SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const& current)
+                {
+                    lastLevel = std::max(lastLevel, current.Cache.Level);
+                });
+
+                uint32_t domain = 0;
+
+                Interop::Windows::EnumerateLogicalProcessorInformation(buffer.as_span(), [&](SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const& current)
+                {
+                    if ((current.Cache.Level == lastLevel) and (current.Cache.Type != CacheInstruction))
+                    {
+                        EnumerateGroupAffinity(current.Cache.GroupMask, [&](uint32_t index)
+                        {
+                            if (LogicalProcessorInfo* const processor = find(index))
+                            {
+                                processor->CacheDomain = domain;
+                            }
+                        });
+
+                        ++domain;
+                    }
+                });
+
+                properties.cacheDomains = std::max<size_t>(1, domain);
+            }
+
+            if (SUCCEEDED(Interop::Windows::GetLogicalProcessorInformationEx(buffer, RelationNumaNode)))
+            {
+                uint32_t node = 0;
+
+                Interop::Windows::EnumerateLogicalProcessorInformation(buffer.as_span(), [&](SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const& current)
+                {
+                    EnumerateGroupAffinity(current.NumaNode.GroupMask, [&](uint32_t index)
+                    {
+                        if (LogicalProcessorInfo* const processor = find(index))
+                        {
+                            processor->NumaNode = node;
+                        }
+                    });
+
+                    ++node;
+                });
+
+                properties.numaNodes = std::max<size_t>(1, node);
+            }
+
+            if (SUCCEEDED(Interop::Windows::GetLogicalProcessorInformationEx(buffer, RelationProcessorPackage)))
+            {
+                uint32_t package = 0;
+
+                Interop::Windows::EnumerateLogicalProcessorInformation(buffer.as_span(), [&](SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const& current)
+                {
+                    for (size_t i = 0; i < current.Processor.GroupCount; ++i)
+                    {
+                        EnumerateGroupAffinity(current.Processor.GroupMask[i], [&](uint32_t index)
+                        {
+                            if (LogicalProcessorInfo* const processor = find(index))
+                            {
+                                processor->Package = package;
+                            }
+                        });
+                    }
+
+                    ++package;
+                });
+            }
+        }
     }
 
     void WindowsProcessorProperties::Initialize()
@@ -122,6 +252,8 @@ namespace Anemone
             gWindowsProcessorProperties->efficiencyCores = efficiencyCores;
         }
 
+        DiscoverTopology(*gWindowsProcessorProperties);
+
         // Get name and vendor of the CPU
         if (auto key = Interop::Windows::RegistryKey::Open(HKEY_LOCAL_MACHINE, LR"(HARDWARE\DESCRIPTION\System\CentralProcessor\0)"))
         {
@@ -291,6 +423,21 @@ namespace Anemone
         return gWindowsProcessorProperties->cacheL3;
     }
 
+    size_t ProcessorProperties::GetCacheDomainsCount()
+    {
+        return gWindowsProcessorProperties->cacheDomains;
+    }
+
+    size_t ProcessorProperties::GetNumaNodesCount()
+    {
+        return gWindowsProcessorProperties->numaNodes;
+    }
+
+    std::span<LogicalProcessorInfo const> ProcessorProperties::GetLogicalProcessors()
+    {
+        return gWindowsProcessorProperties->logicalProcessors;
+    }
+
     std::string_view ProcessorProperties::GetProcessorName()
     {
         return gWindowsProcessorProperties->processorName.as_view();
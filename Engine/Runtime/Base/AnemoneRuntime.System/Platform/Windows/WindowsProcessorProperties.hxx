@@ -2,6 +2,8 @@
 #include "AnemoneRuntime.System/ProcessorProperties.hxx"
 #include "AnemoneRuntime.Interop/StringBuffer.hxx"
 
+#include <vector>
+
 namespace Anemone
 {
     struct WindowsProcessorProperties
@@ -24,6 +26,11 @@ namespace Anemone
         size_t performanceCores = 0;
         size_t efficiencyCores = 0;
 
+        size_t cacheDomains = 1;
+        size_t numaNodes = 1;
+
+        std::vector<LogicalProcessorInfo> logicalProcessors{};
+
         Interop::string_buffer<char, 64> processorName{};
 
         Interop::string_buffer<char, 64> processorVendor{};
@@ -2,10 +2,32 @@
 #include "AnemoneRuntime.Interop/Headers.hxx"
 
 #include <string_view>
+#include <span>
 #include <cstdint>
 
 namespace Anemone
 {
+    //! Describes placement of logical processor in system topology.
+    //!
+    //! All identifiers except processor index are dense, zero-based and comparable only with each other.
+    struct LogicalProcessorInfo final
+    {
+        //! Operating system index of logical processor; usable as thread affinity.
+        uint32_t Index;
+
+        //! Physical core. Logical processors sharing core are SMT siblings.
+        uint32_t Core;
+
+        //! Group of cores sharing last level cache.
+        uint32_t CacheDomain;
+
+        //! NUMA node.
+        uint32_t NumaNode;
+
+        //! Processor package.
+        uint32_t Package;
+    };
+
     struct ProcessorProperties
     {
         ANEMONE_RUNTIME_BASE_API static void Initialize();
@@ -29,6 +51,13 @@ namespace Anemone
 
         ANEMONE_RUNTIME_BASE_API static size_t GetCacheSizeLevel3();
 
+        ANEMONE_RUNTIME_BASE_API static size_t GetCacheDomainsCount();
+
+        ANEMONE_RUNTIME_BASE_API static size_t GetNumaNodesCount();
+
+        //! Gets topology of logical processors available to the process, ordered by processor index.
+        ANEMONE_RUNTIME_BASE_API static std::span<LogicalProcessorInfo const> GetLogicalProcessors();
+
         ANEMONE_RUNTIME_BASE_API static std::string_view GetProcessorName();
 
         ANEMONE_RUNTIME_BASE_API static std::string_view GetProcessorVendor();
@@ -0,0 +1,97 @@
+#include "AnemoneRuntime.Tasks/CoTask.hxx"
+
+namespace Anemone
+{
+    namespace
+    {
+        // Resumes suspended coroutine on worker thread.
+        class CoroutineResumeTask final : public Task
+        {
+        private:
+            std::coroutine_handle<> m_Handle;
+
+        public:
+            explicit CoroutineResumeTask(std::coroutine_handle<> handle)
+                : m_Handle{handle}
+            {
+            }
+
+        protected:
+            void OnExecute() override
+            {
+                this->m_Handle.resume();
+            }
+        };
+
+        // Awaiter which never has any dependencies. Used for tasks which are ready to run immediately.
+        TaskAwaiterHandle const& GetCompletedAwaiter()
+        {
+            static TaskAwaiterHandle const instance = MakeReference<TaskAwaiter>();
+            return instance;
+        }
+    }
+
+    namespace Internal
+    {
+        TaskAwaiterHandle CoTaskPromiseBase::Start(TaskScheduler& scheduler, TaskPriority priority, std::coroutine_handle<> self)
+        {
+            AE_ASSERT(this->m_Scheduler == nullptr);
+            AE_ASSERT(not this->m_Completion);
+
+            this->m_Scheduler = &scheduler;
+            this->m_Priority = priority;
+
+            // Keep awaiter incomplete until coroutine reaches final suspension point.
+            this->m_Completion = MakeReference<TaskAwaiter>();
+            this->m_Completion->AddDependency();
+
+            TaskAwaiterHandle result = this->m_Completion;
+
+            this->ScheduleResume(self, {});
+
+            return result;
+        }
+
+        void CoTaskPromiseBase::ScheduleResume(std::coroutine_handle<> self, TaskAwaiterHandle const& dependency)
+        {
+            if (not this->m_ResumeAwaiter)
+            {
+                // Resume tasks need an awaiter, but nobody waits for them; reuse single one per coroutine.
+                this->m_ResumeAwaiter = MakeReference<TaskAwaiter>();
+            }
+
+            TaskHandle const task = MakeReference<CoroutineResumeTask>(self);
+
+            this->GetScheduler().Schedule(
+                *task,
+                this->m_ResumeAwaiter,
+                dependency ? dependency : GetCompletedAwaiter(),
+                this->m_Priority);
+        }
+
+        std::coroutine_handle<> CoTaskPromiseBase::Complete()
+        {
+            if (this->m_Continuation)
+            {
+                // Nested coroutine: continue awaiting coroutine on this thread.
+                return this->m_Continuation;
+            }
+
+            if (this->m_Completion)
+            {
+                //
+                // Release dependency added in Start through scheduler, so tasks waiting for coroutine get dispatched.
+                //
+                // Note: coroutine frame may be destroyed by owner as soon as awaiter completes; don't touch
+                // promise after that.
+                //
+
+                TaskScheduler& scheduler = this->GetScheduler();
+                TaskAwaiterHandle const completion = std::move(this->m_Completion);
+                scheduler.ReleaseDependency(completion);
+            }
+
+            return std::noop_coroutine();
+        }
+    }
+}
@@ -0,0 +1,366 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+#include "AnemoneRuntime.Tasks/Task.hxx"
+#include "AnemoneRuntime.Tasks/TaskAwaiter.hxx"
+#include "AnemoneRuntime.Tasks/TaskAllocator.hxx"
+#include "AnemoneRuntime.Tasks/TaskScheduler.hxx"
+
+#include <coroutine>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Anemone
+{
+    template <typename T>
+    class CoTask;
+
+    namespace Internal
+    {
+        //! State shared by all coroutine promises, independent of result type.
+        class ANEMONE_RUNTIME_BASE_API CoTaskPromiseBase
+        {
+        private:
+            TaskScheduler* m_Scheduler{};
+            std::coroutine_handle<> m_Continuation{};
+            TaskAwaiterHandle m_Completion{};
+            TaskAwaiterHandle m_ResumeAwaiter{};
+            TaskPriority m_Priority{TaskPriority::Inherited};
+
+        public:
+            CoTaskPromiseBase() = default;
+            CoTaskPromiseBase(CoTaskPromiseBase const&) = delete;
+            CoTaskPromiseBase(CoTaskPromiseBase&&) = delete;
+            CoTaskPromiseBase& operator=(CoTaskPromiseBase const&) = delete;
+            CoTaskPromiseBase& operator=(CoTaskPromiseBase&&) = delete;
+            ~CoTaskPromiseBase() = default;
+
+        public:
+            //! Coroutine frames are allocated as often as tasks; share the same pooled allocator.
+            static void* operator new(size_t size)
+            {
+                return TaskAllocator::Allocate(size);
+            }
+
+            static void operator delete(void* pointer, size_t size)
+            {
+                TaskAllocator::Deallocate(pointer, size);
+            }
+
+        public:
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void unhandled_exception() const noexcept
+            {
+                AE_PANIC("Unhandled exception in coroutine");
+            }
+
+        public:
+            TaskScheduler& GetScheduler() const
+            {
+                AE_ASSERT(this->m_Scheduler != nullptr);
+                return *this->m_Scheduler;
+            }
+
+            TaskPriority GetPriority() const
+            {
+                return this->m_Priority;
+            }
+
+            //! Starts coroutine as child of another coroutine; it inherits scheduler and priority.
+            void StartNested(CoTaskPromiseBase const& parent, std::coroutine_handle<> continuation)
+            {
+                this->m_Scheduler = parent.m_Scheduler;
+                this->m_Priority = parent.m_Priority;
+                this->m_Continuation = continuation;
+            }
+
+            //! Starts coroutine on scheduler. Returned awaiter is completed when coroutine finishes.
+            TaskAwaiterHandle Start(TaskScheduler& scheduler, TaskPriority priority, std::coroutine_handle<> self);
+
+            //! Schedules coroutine to resume on worker once dependency is completed; empty dependency resumes it right away.
+            void ScheduleResume(std::coroutine_handle<> self, TaskAwaiterHandle const& dependency);
+
+            //! Called at final suspension point; returns coroutine which should run next.
+            std::coroutine_handle<> Complete();
+        };
+
+        template <typename T>
+        class CoTaskPromise final : public CoTaskPromiseBase
+        {
+        private:
+            std::optional<T> m_Result{};
+
+        public:
+            CoTask<T> get_return_object();
+
+            template <typename U>
+            void return_value(U&& value)
+            {
+                this->m_Result.emplace(std::forward<U>(value));
+            }
+
+            T& GetResult()
+            {
+                AE_ASSERT(this->m_Result.has_value());
+                return *this->m_Result;
+            }
+
+            auto final_suspend() noexcept;
+        };
+
+        template <>
+        class CoTaskPromise<void> final : public CoTaskPromiseBase
+        {
+        public:
+            CoTask<void> get_return_object();
+
+            void return_void()
+            {
+            }
+
+            void GetResult()
+            {
+            }
+
+            auto final_suspend() noexcept;
+        };
+
+        struct CoTaskFinalAwaiter final
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            template <typename PromiseT>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseT> self) noexcept
+            {
+                return self.promise().Complete();
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+        };
+
+        template <typename T>
+        auto CoTaskPromise<T>::final_suspend() noexcept
+        {
+            return CoTaskFinalAwaiter{};
+        }
+
+        inline auto CoTaskPromise<void>::final_suspend() noexcept
+        {
+            return CoTaskFinalAwaiter{};
+        }
+
+        //! Suspends coroutine until awaiter is completed, then resumes it on a worker thread.
+        struct TaskAwaiterAwaitable final
+        {
+            TaskAwaiterHandle const& Awaiter;
+
+            bool await_ready() const
+            {
+                return this->Awaiter->IsCompleted();
+            }
+
+            template <typename PromiseT>
+            void await_suspend(std::coroutine_handle<PromiseT> self) const
+            {
+                // Coroutine may be resumed and its frame destroyed before scheduling returns; keep awaiter alive
+                // outside of frame.
+                TaskAwaiterHandle const dependency = this->Awaiter;
+                self.promise().ScheduleResume(self, dependency);
+            }
+
+            void await_resume() const
+            {
+            }
+        };
+
+        //! Starts child coroutine on current thread and resumes parent directly when it finishes.
+        template <typename T>
+        struct CoTaskAwaitable final
+        {
+            std::coroutine_handle<CoTaskPromise<T>> Handle;
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            template <typename PromiseT>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseT> parent) noexcept
+            {
+                this->Handle.promise().StartNested(parent.promise(), parent);
+
+                // Symmetric transfer: run child on this thread right away.
+                return this->Handle;
+            }
+
+            decltype(auto) await_resume()
+            {
+                if constexpr (std::is_void_v<T>)
+                {
+                    return;
+                }
+                else
+                {
+                    return std::move(this->Handle.promise().GetResult());
+                }
+            }
+        };
+
+        //! Reschedules coroutine at the end of the run queue, letting other tasks run.
+        struct YieldAwaitable final
+        {
+            bool await_ready() const
+            {
+                return false;
+            }
+
+            template <typename PromiseT>
+            void await_suspend(std::coroutine_handle<PromiseT> self) const
+            {
+                self.promise().ScheduleResume(self, {});
+            }
+
+            void await_resume() const
+            {
+            }
+        };
+    }
+
+    //! Lazily started coroutine executed by task scheduler.
+    //!
+    //! Coroutine may co_await TaskAwaiterHandle, other CoTask or CoYield(). Awaiting other CoTask starts it
+    //! immediately on the same thread and resumes awaiting coroutine directly when it finishes; awaiting
+    //! TaskAwaiterHandle or yielding suspends coroutine and resumes it later on scheduler worker, without
+    //! blocking any thread.
+    template <typename T = void>
+    class [[nodiscard]] CoTask final
+    {
+    public:
+        using promise_type = Internal::CoTaskPromise<T>;
+        using handle_type = std::coroutine_handle<promise_type>;
+
+    private:
+        handle_type m_Handle{};
+        bool m_Started{};
+
+    public:
+        CoTask() = default;
+
+        explicit CoTask(handle_type handle)
+            : m_Handle{handle}
+        {
+        }
+
+        CoTask(CoTask const&) = delete;
+
+        CoTask(CoTask&& other) noexcept
+            : m_Handle{std::exchange(other.m_Handle, {})}
+            , m_Started{std::exchange(other.m_Started, false)}
+        {
+        }
+
+        CoTask& operator=(CoTask const&) = delete;
+
+        CoTask& operator=(CoTask&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (this->m_Handle)
+                {
+                    this->m_Handle.destroy();
+                }
+
+                this->m_Handle = std::exchange(other.m_Handle, {});
+                this->m_Started = std::exchange(other.m_Started, false);
+            }
+
+            return *this;
+        }
+
+        ~CoTask()
+        {
+            if (this->m_Handle)
+            {
+                // Coroutine must not be destroyed while it is running.
+                AE_ASSERT(this->m_Handle.done() or not this->m_Started);
+                this->m_Handle.destroy();
+            }
+        }
+
+    public:
+        bool IsValid() const
+        {
+            return static_cast<bool>(this->m_Handle);
+        }
+
+        bool IsCompleted() const
+        {
+            return this->m_Handle and this->m_Handle.done();
+        }
+
+        //! Starts coroutine on scheduler worker.
+        //!
+        //! \return Awaiter completed when coroutine finishes; use it with TaskScheduler::Wait or as task dependency.
+        TaskAwaiterHandle Start(
+            TaskScheduler& scheduler = TaskScheduler::Get(),
+            TaskPriority priority = TaskPriority::Inherited)
+        {
+            AE_ASSERT(this->m_Handle);
+            AE_ASSERT(not this->m_Started);
+
+            this->m_Started = true;
+            return this->m_Handle.promise().Start(scheduler, priority, this->m_Handle);
+        }
+
+        //! Gets result of completed coroutine.
+        decltype(auto) GetResult()
+        {
+            AE_ASSERT(this->IsCompleted());
+            return this->m_Handle.promise().GetResult();
+        }
+
+    public:
+        Internal::CoTaskAwaitable<T> operator co_await() && noexcept
+        {
+            AE_ASSERT(not this->m_Started);
+            this->m_Started = true;
+            return Internal::CoTaskAwaitable<T>{this->m_Handle};
+        }
+    };
+
+    namespace Internal
+    {
+        template <typename T>
+        CoTask<T> CoTaskPromise<T>::get_return_object()
+        {
+            return CoTask<T>{std::coroutine_handle<CoTaskPromise<T>>::from_promise(*this)};
+        }
+
+        inline CoTask<void> CoTaskPromise<void>::get_return_object()
+        {
+            return CoTask<void>{std::coroutine_handle<CoTaskPromise<void>>::from_promise(*this)};
+        }
+    }
+
+    //! Allows coroutine to suspend until task awaiter is completed.
+    inline Internal::TaskAwaiterAwaitable operator co_await(TaskAwaiterHandle const& awaiter)
+    {
+        AE_ASSERT(awaiter);
+        return Internal::TaskAwaiterAwaitable{awaiter};
+    }
+
+    //! Suspends coroutine and reschedules it on task scheduler.
+    inline Internal::YieldAwaitable CoYield()
+    {
+        return {};
+    }
+}
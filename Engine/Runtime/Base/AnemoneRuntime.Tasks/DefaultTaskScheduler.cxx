@@ -4,33 +4,223 @@
 #include "AnemoneRuntime.Tasks/TaskAwaiter.hxx"
 #include "AnemoneRuntime.System/ProcessorProperties.hxx"
 #include "AnemoneRuntime.Threading/Thread.hxx"
+#include "AnemoneRuntime.Threading/CurrentThread.hxx"
 #include "AnemoneRuntime.Threading/Lock.hxx"
 #include "AnemoneRuntime.Base/Instant.hxx"
 #include "AnemoneRuntime.Base/Intrusive.hxx"
 #include "AnemoneRuntime.Threading/SpinWait.hxx"
 #include "AnemoneRuntime.Profiler/Profiler.hxx"
+#include "AnemoneRuntime.Diagnostics/Trace.hxx"
+#include "AnemoneRuntime.Base/ConsoleVariable.hxx"
+
+#include <algorithm>
+#include <charconv>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <utility>
 
 namespace Anemone
 {
     AE_DECLARE_PROFILE(TaskWorkerWait);
     AE_DECLARE_PROFILE(TaskWorkerProcess);
+    AE_DECLARE_PROFILE(TaskSchedule);
+    AE_DECLARE_PROFILE(TaskExecute);
 
-    DefaultTaskScheduler::DefaultTaskScheduler()
+    // Tasks scheduled and not yet completed. Sampled by workers from per-thread counters.
+    AE_DECLARE_PROFILE_COUNTER(TasksInFlight, int64_t, Instantaneous);
+
+    namespace
     {
+        // Worker executing on current thread. Set only for the lifetime of worker entry point.
+        thread_local DefaultTaskWorker* tlsCurrentWorker{};
+
+        // Task executing on current thread. Used to resolve inherited priority.
+        thread_local Task* tlsCurrentTask{};
+
+        constexpr size_t ToIndex(TaskPriority priority)
+        {
+            return static_cast<size_t>(priority);
+        }
+
+        // Interval in milliseconds at which schedulers write statistics to trace; 0 disables reports.
+        //
+        // Workers read interval while console may change it, so value is kept in atomic, like level of trace category.
+        class TaskStatisticsIntervalVariable final : public IConsoleVariable
+        {
+        private:
+            std::atomic_int64_t m_Value{};
+
+        public:
+            TaskStatisticsIntervalVariable()
+                : IConsoleVariable{"Tasks.StatisticsInterval"}
+            {
+            }
+
+            [[nodiscard]] int64_t Get() const
+            {
+                return this->m_Value.load(std::memory_order::relaxed);
+            }
+
+            [[nodiscard]] std::string ToString() const override
+            {
+                return fmt::format("{}", this->Get());
+            }
+
+            bool FromString(std::string_view value) override
+            {
+                int64_t parsed{};
+                auto const [end, error] = std::from_chars(value.data(), value.data() + value.size(), parsed);
+
+                if ((error != std::errc{}) or (end != (value.data() + value.size())))
+                {
+                    return false;
+                }
+
+                this->m_Value.store(parsed, std::memory_order::relaxed);
+                return true;
+            }
+        };
+
+        TaskStatisticsIntervalVariable gTaskStatisticsInterval{};
+
+        void UpdateHighWater(std::atomic_uint64_t& highWater, uint64_t value)
+        {
+            uint64_t current = highWater.load(std::memory_order::relaxed);
+
+            while ((value > current) and not highWater.compare_exchange_weak(current, value, std::memory_order::relaxed))
+            {
+            }
+        }
+
+        // Orders processors so that every physical core gets one worker before any SMT sibling does.
+        // Processors of the same NUMA node and cache domain are kept together.
+        std::vector<LogicalProcessorInfo> GetPlacementOrder()
+        {
+            std::span<LogicalProcessorInfo const> const processors = ProcessorProperties::GetLogicalProcessors();
+
+            struct Entry final
+            {
+                LogicalProcessorInfo Processor;
+                uint32_t Sibling;
+            };
+
+            std::vector<Entry> entries{};
+            entries.reserve(processors.size());
+
+            for (LogicalProcessorInfo const& processor : processors)
+            {
+                uint32_t const sibling = static_cast<uint32_t>(std::count_if(processors.begin(), processors.end(), [&](LogicalProcessorInfo const& other)
+                {
+                    return (other.Core == processor.Core) and (other.Index < processor.Index);
+                }));
+
+                entries.push_back(Entry{processor, sibling});
+            }
+
+            std::stable_sort(entries.begin(), entries.end(), [](Entry const& left, Entry const& right)
+            {
+                return std::tie(left.Sibling, left.Processor.NumaNode, left.Processor.CacheDomain, left.Processor.Core) <
+                    std::tie(right.Sibling, right.Processor.NumaNode, right.Processor.CacheDomain, right.Processor.Core);
+            });
+
+            std::vector<LogicalProcessorInfo> result{};
+            result.reserve(entries.size());
+
+            for (Entry const& entry : entries)
+            {
+                result.push_back(entry.Processor);
+            }
+
+            return result;
+        }
+    }
+
+    DefaultTaskScheduler::DefaultTaskScheduler()
         //
         // Assume that main thread will contribute as well.
         //
+        : DefaultTaskScheduler{ProcessorProperties::GetLogicalCoresCount() - 1uz}
+    {
+    }
 
-        size_t const workerCount = ProcessorProperties::GetLogicalCoresCount() - 1uz;
-
+    DefaultTaskScheduler::DefaultTaskScheduler(size_t workerCount, TaskWorkerPlacement placement)
+    {
         this->m_Workers.resize(workerCount);
         this->m_Threads.resize(workerCount);
 
+        // Worker registers itself here before parking; reserve upfront to avoid allocations under spinlock.
+        this->m_Sleepers.reserve(workerCount);
+
+        std::vector<LogicalProcessorInfo> const processors = (placement == TaskWorkerPlacement::Topology)
+            ? GetPlacementOrder()
+            : std::vector<LogicalProcessorInfo>{};
+
         for (uint32_t i = 0; i < workerCount; ++i)
         {
-            this->m_Workers[i] = MakeReference<DefaultTaskWorker>(i, this);
+            std::optional<LogicalProcessorInfo> processor{};
+
+            // First processor is left for the thread which created scheduler, as it contributes while waiting.
+            // Workers beyond remaining processors are not pinned, so no processor runs two pinned workers.
+            if ((i + 1) < processors.size())
+            {
+                processor = processors[i + 1];
+            }
+
+            this->m_Workers[i] = MakeReference<DefaultTaskWorker>(i, this, processor);
         }
 
+        //
+        // Build steal order of each worker: workers sharing cache domain first, then workers of the same NUMA node.
+        //
+
+        for (Reference<DefaultTaskWorker> const& worker : this->m_Workers)
+        {
+            std::optional<LogicalProcessorInfo> const& self = worker->GetProcessor();
+
+            auto distance = [&](DefaultTaskWorker const& other) -> size_t
+            {
+                std::optional<LogicalProcessorInfo> const& processor = other.GetProcessor();
+
+                if (self and processor)
+                {
+                    if (self->CacheDomain == processor->CacheDomain)
+                    {
+                        return 0;
+                    }
+
+                    if (self->NumaNode == processor->NumaNode)
+                    {
+                        return 1;
+                    }
+                }
+
+                return 2;
+            };
+
+            std::vector<uint32_t> victims{};
+            std::array<size_t, DefaultTaskWorker::VictimTierCount> tiers{};
+
+            for (size_t tier = 0; tier < tiers.size(); ++tier)
+            {
+                for (Reference<DefaultTaskWorker> const& other : this->m_Workers)
+                {
+                    if ((other.Get() != worker.Get()) and (distance(*other) == tier))
+                    {
+                        victims.push_back(other->GetIndex());
+                    }
+                }
+
+                tiers[tier] = victims.size();
+            }
+
+            worker->SetVictims(std::move(victims), tiers);
+        }
+
+        // Affinity hints are honored only when workers are pinned to NUMA nodes.
+        size_t const nodes = processors.empty() ? 1 : ProcessorProperties::GetNumaNodesCount();
+        this->m_NodeQueues = std::vector<TaskQueue>(nodes);
+
         for (uint32_t i = 0; i < workerCount; ++i)
         {
             this->m_Threads[i] = Thread::Start(
@@ -46,15 +236,12 @@ namespace Anemone
     {
         this->m_CancellationToken.Cancel();
 
-        {
-            //
-            // Notify all threads that we are shutting down.
-            //
-
-            UniqueLock scope{this->m_TasksLock};
-            this->m_TasksCondition.NotifyAll();
-        }
+        //
+        // Notify all threads that we are shutting down. Workers which are about to park check cancellation
+        // after registering as sleepers, so waking all currently registered ones is sufficient.
+        //
 
+        this->WakeWorkers(this->m_Workers.size());
 
         //
         // Stop threads.
@@ -69,9 +256,8 @@ namespace Anemone
         // Drain task queues.
         //
 
-        while (Task* current = this->m_Queue.Pop())
+        while (this->TryExecuteOne())
         {
-            this->ExecuteInplace(*current);
         }
     }
 
@@ -89,7 +275,47 @@ namespace Anemone
 
     void DefaultTaskScheduler::ExecuteInplace(Task& task)
     {
-        task.Execute();
+        Duration const latency = task.GetReadyTime().QueryElapsed();
+
+        DefaultTaskWorker* const worker = this->GetCurrentWorker();
+
+        if (worker != nullptr)
+        {
+            worker->GetLatencyHistograms()[ToIndex(task.GetPriority())].RecordExclusive(latency);
+        }
+        else
+        {
+            this->m_Latency[ToIndex(task.GetPriority())].Record(latency);
+        }
+
+        if (task.WasPending())
+        {
+            // Task became ready when its dependency was completed.
+            if (worker != nullptr)
+            {
+                worker->GetDependencyLatencyHistogram().RecordExclusive(latency);
+            }
+            else
+            {
+                this->m_DependencyLatency.Record(latency);
+            }
+        }
+
+        TaskWorkerCounters& counters = (worker != nullptr) ? worker->GetCounters() : this->m_ExternalCounters;
+        counters.TaskExecuted();
+
+        // Tasks may be executed recursively while waiting; restore previous task afterwards.
+        Task* const parent = std::exchange(tlsCurrentTask, &task);
+
+        {
+            AE_PROFILE_SCOPE(TaskExecute);
+            AE_PROFILE_FLOW_END(TaskSchedule, task.GetId());
+            task.Execute();
+        }
+
+        tlsCurrentTask = parent;
+
+        counters.TaskCompleted();
 
         // Try to get list of dependent tasks to flush them to queues.
         if (task.GetAwaiter()->NotifyCompleted())
@@ -101,53 +327,51 @@ namespace Anemone
             // Every time the awaiter is completed, it will try to flush the waiting list.
             //
 
-            IntrusiveList<Task, Task> list{};
-
-            task.GetAwaiter()->FlushWaitList(list);
-
-            while (Task* child = list.PopFront())
-            {
-                AE_ENSURE(child->GetDependencyAwaiter()->IsCompleted());
-                child->PendingToDispatched();
-                this->m_Queue.Push(child);
-                this->m_TasksCondition.NotifyOne();
-            }
+            this->ReleaseWaitingTasks(*task.GetAwaiter());
         }
 
         // Release task reference acquired in DefaultTaskScheduler::Schedule.
         task.ReleaseReference();
     }
 
-    void DefaultTaskScheduler::TaskWorkerEntryPoint([[maybe_unused]] uint32_t workerId)
+    void DefaultTaskScheduler::TaskWorkerEntryPoint(uint32_t workerId)
     {
-        while (true)
-        {
-            //
-            // Wait for tasks.
-            //
-            {
-                AE_PROFILE_SCOPE(TaskWorkerWait);
+        DefaultTaskWorker* const worker = this->m_Workers[workerId].Get();
 
-                UniqueLock scope{this->m_TasksLock};
+        AE_ASSERT(tlsCurrentWorker == nullptr);
+        tlsCurrentWorker = worker;
 
-                this->m_TasksCondition.Wait(scope, [&]
-                {
-                    return this->m_CancellationToken.IsCancelled() or not this->m_Queue.IsEmpty();
-                });
-            }
+        if (std::optional<LogicalProcessorInfo> const& processor = worker->GetProcessor())
+        {
+            CurrentThread::SetAffinity(processor->Index);
+        }
 
+        TaskWorkerCounters& counters = worker->GetCounters();
+
+        while (true)
+        {
             //
             // Process tasks.
             //
+
+            Instant const processStarted = Instant::Now();
+
             {
                 AE_PROFILE_SCOPE(TaskWorkerProcess);
 
-                while (Task* task = this->m_Queue.Pop())
+                while (Task* task = this->TryAcquireTask(worker))
                 {
                     this->ExecuteInplace(*task);
                 }
             }
 
+            Instant const processFinished = Instant::Now();
+            counters.AddBusyTime(processFinished - processStarted);
+
+            AE_PROFILE_COUNTER_SET(TasksInFlight, this->CountTasksInFlight());
+
+            this->TryReportStatistics(processFinished);
+
             //
             // Worker thread could be notified to stop during the processing of a task.
             //
@@ -156,6 +380,463 @@ namespace Anemone
             {
                 break;
             }
+
+            //
+            // Wait for tasks. Spin briefly first, as new tasks are often dispatched shortly after.
+            //
+            {
+                AE_PROFILE_SCOPE(TaskWorkerWait);
+
+                bool const ready = TryWaitForCompletion([&]
+                {
+                    return this->m_CancellationToken.IsCancelled() or this->HasReadyTasks();
+                },
+                    WorkerSpinCount);
+
+                if (not ready)
+                {
+                    this->ParkWorker(*worker);
+                }
+            }
+
+            counters.AddIdleTime(processFinished.QueryElapsed());
+        }
+
+        tlsCurrentWorker = nullptr;
+    }
+
+    DefaultTaskWorker* DefaultTaskScheduler::GetCurrentWorker() const
+    {
+        DefaultTaskWorker* const worker = tlsCurrentWorker;
+
+        if ((worker != nullptr) and (worker->GetScheduler() == this))
+        {
+            return worker;
+        }
+
+        return nullptr;
+    }
+
+    TaskWorkerCounters& DefaultTaskScheduler::GetCurrentCounters()
+    {
+        if (DefaultTaskWorker* const worker = this->GetCurrentWorker())
+        {
+            return worker->GetCounters();
+        }
+
+        return this->m_ExternalCounters;
+    }
+
+    std::optional<uint32_t> DefaultTaskScheduler::GetCurrentWorkerIndex() const
+    {
+        if (DefaultTaskWorker const* const worker = this->GetCurrentWorker())
+        {
+            return worker->GetIndex();
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<LogicalProcessorInfo> DefaultTaskScheduler::GetWorkerProcessor(uint32_t workerId) const
+    {
+        return this->m_Workers[workerId]->GetProcessor();
+    }
+
+    TaskPriority DefaultTaskScheduler::ResolvePriority(TaskPriority priority)
+    {
+        if (priority == TaskPriority::Inherited)
+        {
+            if (Task const* parent = tlsCurrentTask)
+            {
+                return parent->GetPriority();
+            }
+
+            return TaskPriority::Normal;
+        }
+
+        return priority;
+    }
+
+    void DefaultTaskScheduler::Dispatch(Task& task)
+    {
+        if (not this->TryDispatchLocal(task))
+        {
+            // Task was scheduled from outside of worker thread, or local queue is full.
+            size_t const index = ToIndex(task.GetPriority());
+            TaskQueue& queue = this->m_Queues[index];
+            queue.Push(&task);
+            UpdateHighWater(this->m_QueueHighWater[index], queue.GetCount());
+        }
+    }
+
+    bool DefaultTaskScheduler::TryDispatchLocal(Task& task)
+    {
+        AE_ASSERT(task.GetDependencyAwaiter()->IsCompleted());
+
+        TaskPriority const priority = task.GetPriority();
+        AE_ASSERT(priority != TaskPriority::Inherited);
+
+        task.SetReadyTime(Instant::Now());
+
+        //
+        // Only High and Normal tasks go to local queue. Critical tasks must be visible to all workers immediately,
+        // and Low/Background tasks must not run ahead of Normal tasks just because they were spawned locally.
+        //
+
+        bool const local = (priority == TaskPriority::High) or (priority == TaskPriority::Normal);
+
+        if (not local)
+        {
+            return false;
+        }
+
+        DefaultTaskWorker* const worker = this->GetCurrentWorker();
+
+        if (this->m_NodeQueues.size() > 1)
+        {
+            uint32_t const node = task.GetAffinityHint();
+
+            if ((node < this->m_NodeQueues.size()) and ((worker == nullptr) or not worker->GetProcessor() or (worker->GetNumaNode() != node)))
+            {
+                // Task prefers other NUMA node; let workers of that node pick it up first.
+                this->m_NodeQueues[node].Push(&task);
+                return true;
+            }
+        }
+
+        if ((worker != nullptr) and worker->GetLocalQueue().Push(&task))
+        {
+            worker->GetCounters().UpdateLocalQueueDepth(worker->GetLocalQueue().GetCount());
+            return true;
+        }
+
+        return false;
+    }
+
+    void DefaultTaskScheduler::ReleaseWaitingTasks(TaskAwaiter& awaiter)
+    {
+        IntrusiveList<Task, Task> list{};
+
+        size_t const released = awaiter.FlushWaitList(list);
+
+        if (released == 0)
+        {
+            return;
+        }
+
+        // Tasks which didn't fit into local queue, grouped by priority.
+        std::array<IntrusiveList<Task, Task>, TaskPriorityCount> shared{};
+        std::array<size_t, TaskPriorityCount> sharedCount{};
+
+        while (Task* child = list.PopFront())
+        {
+            AE_ENSURE(child->GetDependencyAwaiter()->IsCompleted());
+            child->PendingToDispatched();
+
+            if (not this->TryDispatchLocal(*child))
+            {
+                size_t const index = ToIndex(child->GetPriority());
+                shared[index].PushBack(child);
+                ++sharedCount[index];
+            }
+        }
+
+        for (size_t index = 0; index < TaskPriorityCount; ++index)
+        {
+            if (sharedCount[index] != 0)
+            {
+                TaskQueue& queue = this->m_Queues[index];
+                queue.PushList(shared[index], sharedCount[index]);
+                UpdateHighWater(this->m_QueueHighWater[index], queue.GetCount());
+            }
+        }
+
+        // Wake workers once for whole batch of released tasks.
+        this->WakeWorkers(released);
+    }
+
+    Task* DefaultTaskScheduler::TryAcquireTask(DefaultTaskWorker* worker)
+    {
+        if (Task* task = this->m_Queues[ToIndex(TaskPriority::Critical)].Pop())
+        {
+            return task;
+        }
+
+        if (Task* task = this->TryAcquireAgedTask(Instant::Now()))
+        {
+            return task;
+        }
+
+        if (worker != nullptr)
+        {
+            if (Task* task = worker->GetLocalQueue().Pop())
+            {
+                return task;
+            }
+
+            if (worker->GetProcessor())
+            {
+                if (Task* task = this->m_NodeQueues[worker->GetNumaNode()].Pop())
+                {
+                    return task;
+                }
+            }
+        }
+
+        if (Task* task = this->m_Queues[ToIndex(TaskPriority::High)].Pop())
+        {
+            return task;
+        }
+
+        if (Task* task = this->m_Queues[ToIndex(TaskPriority::Normal)].Pop())
+        {
+            return task;
+        }
+
+        if (Task* task = this->TrySteal(worker))
+        {
+            return task;
+        }
+
+        if (Task* task = this->m_Queues[ToIndex(TaskPriority::Low)].Pop())
+        {
+            return task;
+        }
+
+        return this->m_Queues[ToIndex(TaskPriority::Background)].Pop();
+    }
+
+    Task* DefaultTaskScheduler::TryAcquireAgedTask(Instant now)
+    {
+        //
+        // Anti-starvation: tasks waiting longer than aging threshold are executed ahead of higher priorities.
+        // Queues are FIFO, so checking the first task is enough.
+        //
+
+        auto tryAcquire = [&](TaskPriority priority, Duration threshold) -> Task*
+        {
+            TaskQueue& queue = this->m_Queues[ToIndex(priority)];
+
+            if (queue.IsEmpty())
+            {
+                return nullptr;
+            }
+
+            return queue.PopIf([&](Task const& task)
+            {
+                return (now - task.GetReadyTime()) >= threshold;
+            });
+        };
+
+        if (Task* task = tryAcquire(TaskPriority::Low, LowPriorityAgingThreshold))
+        {
+            return task;
+        }
+
+        return tryAcquire(TaskPriority::Background, BackgroundPriorityAgingThreshold);
+    }
+
+    Task* DefaultTaskScheduler::TrySteal(DefaultTaskWorker* worker)
+    {
+        if (worker != nullptr)
+        {
+            for (size_t tier = 0; tier < DefaultTaskWorker::VictimTierCount; ++tier)
+            {
+                std::span<uint32_t const> const victims = worker->GetVictims(tier);
+
+                if (victims.empty())
+                {
+                    continue;
+                }
+
+                //
+                // Start from random victim to avoid all thieves hammering the same worker.
+                //
+
+                size_t const first = worker->SelectVictim(victims.size());
+
+                for (size_t i = 0; i < victims.size(); ++i)
+                {
+                    DefaultTaskWorker* const victim = this->m_Workers[victims[(first + i) % victims.size()]].Get();
+
+                    if (Task* task = victim->GetLocalQueue().Steal())
+                    {
+                        worker->GetCounters().Stolen();
+                        return task;
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (Reference<DefaultTaskWorker> const& victim : this->m_Workers)
+            {
+                if (Task* task = victim->GetLocalQueue().Steal())
+                {
+                    this->m_ExternalCounters.Stolen();
+                    return task;
+                }
+            }
+        }
+
+        //
+        // Tasks preferring other NUMA nodes are taken only when there is nothing closer.
+        //
+
+        for (TaskQueue& queue : this->m_NodeQueues)
+        {
+            if (Task* task = queue.Pop())
+            {
+                return task;
+            }
+        }
+
+        return nullptr;
+    }
+
+    bool DefaultTaskScheduler::HasReadyTasks() const
+    {
+        for (TaskQueue const& queue : this->m_Queues)
+        {
+            if (not queue.IsEmpty())
+            {
+                return true;
+            }
+        }
+
+        for (TaskQueue const& queue : this->m_NodeQueues)
+        {
+            if (not queue.IsEmpty())
+            {
+                return true;
+            }
+        }
+
+        for (Reference<DefaultTaskWorker> const& worker : this->m_Workers)
+        {
+            if (not worker->GetLocalQueue().IsEmpty())
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool DefaultTaskScheduler::TryExecuteOne()
+    {
+        DefaultTaskWorker* const worker = this->GetCurrentWorker();
+
+        if (Task* task = this->TryAcquireTask(worker))
+        {
+            if ((worker != nullptr) or (tlsCurrentTask != nullptr))
+            {
+                // Busy time of workers is measured by their main loop; nested tasks are included in time of parent.
+                this->ExecuteInplace(*task);
+            }
+            else
+            {
+                Instant const started = Instant::Now();
+                this->ExecuteInplace(*task);
+                this->m_ExternalCounters.AddBusyTime(started.QueryElapsed());
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void DefaultTaskScheduler::ParkWorker(DefaultTaskWorker& worker)
+    {
+        {
+            UniqueLock scope{this->m_SleepersLock};
+            this->m_Sleepers.push_back(&worker);
+            this->m_SleepersCount.fetch_add(1, std::memory_order::relaxed);
+        }
+
+        //
+        // Pairs with fence in WakeWorkers: either we observe tasks dispatched before registration,
+        // or dispatching thread observes us in sleepers list.
+        //
+
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+
+        if (this->m_CancellationToken.IsCancelled() or this->HasReadyTasks())
+        {
+            bool unregistered = false;
+
+            {
+                UniqueLock scope{this->m_SleepersLock};
+
+                auto const it = std::find(this->m_Sleepers.begin(), this->m_Sleepers.end(), &worker);
+
+                if (it != this->m_Sleepers.end())
+                {
+                    this->m_Sleepers.erase(it);
+                    this->m_SleepersCount.fetch_sub(1, std::memory_order::relaxed);
+                    unregistered = true;
+                }
+            }
+
+            if (unregistered)
+            {
+                return;
+            }
+
+            // Some other thread already removed this worker and is about to signal it; consume that signal.
+        }
+
+        worker.Park();
+        worker.GetCounters().Wakeup();
+    }
+
+    void DefaultTaskScheduler::WakeWorkers(size_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        // Pairs with fence in ParkWorker.
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+
+        if (this->m_SleepersCount.load(std::memory_order::relaxed) == 0)
+        {
+            // Fast path: all workers are busy or spinning.
+            return;
+        }
+
+        std::array<DefaultTaskWorker*, 16> batch;
+
+        while (count != 0)
+        {
+            size_t woken = 0;
+
+            {
+                UniqueLock scope{this->m_SleepersLock};
+
+                while ((woken < batch.size()) and (woken < count) and not this->m_Sleepers.empty())
+                {
+                    batch[woken++] = this->m_Sleepers.back();
+                    this->m_Sleepers.pop_back();
+                }
+
+                this->m_SleepersCount.fetch_sub(woken, std::memory_order::relaxed);
+            }
+
+            if (woken == 0)
+            {
+                break;
+            }
+
+            // Signal workers outside of lock, so they won't contend on it right after wakeup.
+            for (size_t i = 0; i < woken; ++i)
+            {
+                batch[i]->Unpark();
+            }
+
+            count -= woken;
         }
     }
 
@@ -165,7 +846,9 @@ namespace Anemone
         TaskAwaiterHandle const& dependency,
         TaskPriority priority)
     {
-        task.SetPriority(priority);
+        AE_PROFILE_SCOPE(TaskSchedule);
+
+        task.SetPriority(ResolvePriority(priority));
 
         // Scheduler takes reference to this task internally.
         task.AcquireReference();
@@ -176,17 +859,38 @@ namespace Anemone
         // Dispatch task.
         task.Dispatched(this->GenerateTaskId(), awaiter, dependency);
 
+        // Task identifiers are unique within scheduler, so they identify flow to execution of task.
+        AE_PROFILE_FLOW_BEGIN(TaskSchedule, task.GetId());
+
+        this->GetCurrentCounters().TaskScheduled();
+
         if (dependency->IsCompleted())
         {
             // Dependency counter is completed, push task to the queue.
-            this->m_Queue.Push(&task);
-            this->m_TasksCondition.NotifyOne();
+            this->Dispatch(task);
+            this->WakeWorkers(1);
         }
         else
         {
             // Dependency is not completed, add task to the pending list.
             task.DispatchedToPending();
-            dependency->AddWaitingTask(task);
+
+            if (dependency->AddWaitingTask(task))
+            {
+                // Dependency was completed while task was being added; its wait list might have been flushed
+                // already, so task would never be dispatched.
+                this->ReleaseWaitingTasks(*dependency);
+            }
+        }
+    }
+
+    void DefaultTaskScheduler::ReleaseDependency(TaskAwaiterHandle const& awaiter)
+    {
+        AE_ASSERT(awaiter);
+
+        if (awaiter->NotifyCompleted())
+        {
+            this->ReleaseWaitingTasks(*awaiter);
         }
     }
 
@@ -202,10 +906,7 @@ namespace Anemone
         },
             [&]
         {
-            if (Task* current = this->m_Queue.Pop())
-            {
-                ExecuteInplace(*current);
-            }
+            this->TryExecuteOne();
 
             return awaiter->IsCompleted();
         });
@@ -231,10 +932,7 @@ namespace Anemone
         },
             [&]
         {
-            if (Task* current = this->m_Queue.Pop())
-            {
-                this->ExecuteInplace(*current);
-            }
+            this->TryExecuteOne();
 
             elapsed = started.QueryElapsed();
 
@@ -261,10 +959,7 @@ namespace Anemone
         },
             [&]
         {
-            if (Task* current = this->m_Queue.Pop())
-            {
-                this->ExecuteInplace(*current);
-            }
+            this->TryExecuteOne();
 
             elapsed = started.QueryElapsed();
 
@@ -277,4 +972,206 @@ namespace Anemone
         return static_cast<uint32_t>(this->m_Workers.size());
     }
 
+    bool DefaultTaskScheduler::IsLocalQueueEmpty() const
+    {
+        if (DefaultTaskWorker* const worker = this->GetCurrentWorker())
+        {
+            return worker->GetLocalQueue().IsEmpty();
+        }
+
+        // External threads push tasks to shared queues.
+        return this->m_Queues[ToIndex(TaskPriority::Critical)].IsEmpty() and
+            this->m_Queues[ToIndex(TaskPriority::High)].IsEmpty() and
+            this->m_Queues[ToIndex(TaskPriority::Normal)].IsEmpty();
+    }
+
+    int64_t DefaultTaskScheduler::CountTasksInFlight() const
+    {
+        int64_t result = this->m_ExternalCounters.GetTasksInFlight();
+
+        for (Reference<DefaultTaskWorker> const& worker : this->m_Workers)
+        {
+            result += worker->GetCounters().GetTasksInFlight();
+        }
+
+        return result;
+    }
+
+    void DefaultTaskScheduler::TryReportStatistics(Instant now)
+    {
+        int64_t const interval = gTaskStatisticsInterval.Get();
+
+        if (interval <= 0)
+        {
+            return;
+        }
+
+        int64_t const current = now.SinceEpoch().ToNanoseconds();
+        int64_t next = this->m_NextStatisticsReport.load(std::memory_order::relaxed);
+
+        if (current < next)
+        {
+            return;
+        }
+
+        // Only one worker reports per interval.
+        if (this->m_NextStatisticsReport.compare_exchange_strong(
+                next,
+                current + Duration::FromMilliseconds(interval).ToNanoseconds(),
+                std::memory_order::relaxed))
+        {
+            this->ReportStatistics();
+        }
+    }
+
+    DefaultTaskSchedulerStatistics DefaultTaskScheduler::GetStatistics() const
+    {
+        TaskLatencySnapshot const dependencyLatency = this->GetDependencyLatencyHistogram();
+
+        DefaultTaskSchedulerStatistics result{
+            .Allocator = TaskAllocator::GetStatistics(),
+            .Workers = {},
+            .External = this->m_ExternalCounters.Snapshot(),
+            .TasksInFlight = this->CountTasksInFlight(),
+            .QueueHighWater = {},
+            .DependencyResolutions = dependencyLatency.GetCount(),
+            .DependencyLatencyP50 = dependencyLatency.GetPercentile(0.50),
+            .DependencyLatencyP99 = dependencyLatency.GetPercentile(0.99),
+        };
+
+        result.Workers.reserve(this->m_Workers.size());
+
+        for (Reference<DefaultTaskWorker> const& worker : this->m_Workers)
+        {
+            result.Workers.push_back(worker->GetCounters().Snapshot());
+        }
+
+        for (size_t i = 0; i < TaskPriorityCount; ++i)
+        {
+            result.QueueHighWater[i] = this->m_QueueHighWater[i].load(std::memory_order::relaxed);
+        }
+
+        return result;
+    }
+
+    void DefaultTaskScheduler::ResetStatistics()
+    {
+        for (Reference<DefaultTaskWorker> const& worker : this->m_Workers)
+        {
+            worker->GetCounters().Reset();
+        }
+
+        this->m_ExternalCounters.Reset();
+
+        for (std::atomic_uint64_t& highWater : this->m_QueueHighWater)
+        {
+            highWater.store(0, std::memory_order::relaxed);
+        }
+
+        this->ResetLatencyHistograms();
+    }
+
+    void DefaultTaskScheduler::ReportStatistics() const
+    {
+        DefaultTaskSchedulerStatistics const statistics = this->GetStatistics();
+
+        TraceDispatcher& trace = Trace::Get();
+
+        auto report = [&](std::string_view name, TaskWorkerStatistics const& worker)
+        {
+            int64_t const busy = worker.BusyTime.ToMicroseconds();
+            int64_t const idle = worker.IdleTime.ToMicroseconds();
+            int64_t const total = std::max<int64_t>(busy + idle, 1);
+
+            trace.TraceInformation(
+                "tasks: {}: executed = {}, busy = {} us ({}%), idle = {} us, wakeups = {}, steals = {}, local queue high-water = {}",
+                name,
+                worker.TasksExecuted,
+                busy,
+                (busy * 100) / total,
+                idle,
+                worker.Wakeups,
+                worker.Steals,
+                worker.LocalQueueHighWater);
+        };
+
+        for (size_t i = 0; i < statistics.Workers.size(); ++i)
+        {
+            report(fmt::format("worker {}", i), statistics.Workers[i]);
+        }
+
+        report("external", statistics.External);
+
+        trace.TraceInformation("tasks: in flight = {}", statistics.TasksInFlight);
+
+        trace.TraceInformation(
+            "tasks: queue high-water: critical = {}, high = {}, normal = {}, low = {}, background = {}",
+            statistics.QueueHighWater[ToIndex(TaskPriority::Critical)],
+            statistics.QueueHighWater[ToIndex(TaskPriority::High)],
+            statistics.QueueHighWater[ToIndex(TaskPriority::Normal)],
+            statistics.QueueHighWater[ToIndex(TaskPriority::Low)],
+            statistics.QueueHighWater[ToIndex(TaskPriority::Background)]);
+
+        trace.TraceInformation(
+            "tasks: dependency resolutions = {}, latency p50 <= {} us, p99 <= {} us",
+            statistics.DependencyResolutions,
+            statistics.DependencyLatencyP50.ToMicroseconds(),
+            statistics.DependencyLatencyP99.ToMicroseconds());
+
+        trace.TraceInformation(
+            "tasks: allocator: allocations = {}, deallocations = {}, heap = {}, transfers = {}",
+            statistics.Allocator.Allocations,
+            statistics.Allocator.Deallocations,
+            statistics.Allocator.HeapAllocations,
+            statistics.Allocator.Transfers);
+    }
+
+    TaskLatencySnapshot DefaultTaskScheduler::GetLatencyHistogram(TaskPriority priority) const
+    {
+        AE_ASSERT(priority != TaskPriority::Inherited);
+
+        TaskLatencySnapshot result{};
+        result.Accumulate(this->m_Latency[ToIndex(priority)]);
+
+        for (Reference<DefaultTaskWorker> const& worker : this->m_Workers)
+        {
+            result.Accumulate(worker->GetLatencyHistograms()[ToIndex(priority)]);
+        }
+
+        return result;
+    }
+
+    TaskLatencySnapshot DefaultTaskScheduler::GetDependencyLatencyHistogram() const
+    {
+        TaskLatencySnapshot result{};
+        result.Accumulate(this->m_DependencyLatency);
+
+        for (Reference<DefaultTaskWorker> const& worker : this->m_Workers)
+        {
+            result.Accumulate(worker->GetDependencyLatencyHistogram());
+        }
+
+        return result;
+    }
+
+    void DefaultTaskScheduler::ResetLatencyHistograms()
+    {
+        for (TaskLatencyHistogram& histogram : this->m_Latency)
+        {
+            histogram.Reset();
+        }
+
+        this->m_DependencyLatency.Reset();
+
+        for (Reference<DefaultTaskWorker> const& worker : this->m_Workers)
+        {
+            for (TaskLatencyHistogram& histogram : worker->GetLatencyHistograms())
+            {
+                histogram.Reset();
+            }
+
+            worker->GetDependencyLatencyHistogram().Reset();
+        }
+    }
+
 }
@@ -2,15 +2,20 @@
 #include "AnemoneRuntime.Interop/Headers.hxx"
 #include "AnemoneRuntime.Tasks/TaskScheduler.hxx"
 #include "AnemoneRuntime.Tasks/TaskQueue.hxx"
+#include "AnemoneRuntime.Tasks/TaskLatencyHistogram.hxx"
+#include "AnemoneRuntime.Tasks/TaskAllocator.hxx"
+#include "AnemoneRuntime.Tasks/TaskWorkerCounters.hxx"
 #include "AnemoneRuntime.Tasks/Task.hxx"
-#include "AnemoneRuntime.Threading/CriticalSection.hxx"
-#include "AnemoneRuntime.Threading/ConditionVariable.hxx"
+#include "AnemoneRuntime.Threading/Spinlock.hxx"
 #include "AnemoneRuntime.Threading/CancellationToken.hxx"
+#include "AnemoneRuntime.System/ProcessorProperties.hxx"
 #include "AnemoneRuntime.Base/Reference.hxx"
 #include "AnemoneRuntime.Base/Duration.hxx"
 
 
+#include <array>
 #include <atomic>
+#include <optional>
 #include <vector>
 
 namespace Anemone
@@ -19,20 +24,79 @@ namespace Anemone
 
     class DefaultTaskWorker;
 
+    //! Specifies how worker threads are placed on logical processors.
+    enum class TaskWorkerPlacement : uint8_t
+    {
+        //! Workers are not pinned; operating system decides where they run.
+        Unpinned,
+
+        //! Workers are pinned to logical processors, filling physical cores before SMT siblings, and prefer
+        //! stealing from workers sharing cache or NUMA node.
+        Topology,
+    };
+
+    struct DefaultTaskSchedulerStatistics final
+    {
+        //! Statistics of pooled allocator used for tasks and awaiters.
+        TaskAllocatorStatistics Allocator;
+
+        //! Counters of each worker thread.
+        std::vector<TaskWorkerStatistics> Workers;
+
+        //! Counters of threads outside of scheduler which executed tasks while waiting.
+        TaskWorkerStatistics External;
+
+        //! Number of tasks scheduled and not yet completed.
+        int64_t TasksInFlight;
+
+        //! Largest observed number of tasks in shared queue of each priority.
+        std::array<uint64_t, TaskPriorityCount> QueueHighWater;
+
+        //! Number of tasks which became ready after their dependency was completed.
+        uint64_t DependencyResolutions;
+
+        //! Median time between dependency completion and start of dependent task.
+        Duration DependencyLatencyP50;
+
+        //! 99th percentile of time between dependency completion and start of dependent task.
+        Duration DependencyLatencyP99;
+    };
+
     class DefaultTaskScheduler final : public TaskScheduler
     {
+    public:
+        //! Time after which waiting Low priority task is executed ahead of higher priority tasks.
+        static constexpr Duration LowPriorityAgingThreshold = Duration::FromMilliseconds(4);
+
+        //! Time after which waiting Background priority task is executed ahead of higher priority tasks.
+        static constexpr Duration BackgroundPriorityAgingThreshold = Duration::FromMilliseconds(32);
+
+        //! Number of spins worker performs looking for tasks before it parks.
+        static constexpr size_t WorkerSpinCount = 64;
+
     private:
         std::atomic_uint32_t m_LastTaskId{};
-        TaskQueue m_Queue{};
+        std::array<TaskQueue, TaskPriorityCount> m_Queues{};
+        //! Latency histograms of threads outside of scheduler; workers record to their own histograms.
+        std::array<TaskLatencyHistogram, TaskPriorityCount> m_Latency{};
+        //! Queues of High/Normal tasks with NUMA affinity hint; one per NUMA node when placement is topology-aware.
+        std::vector<TaskQueue> m_NodeQueues{};
         std::vector<Reference<Thread>> m_Threads{};
         std::vector<Reference<DefaultTaskWorker>> m_Workers{};
-        CriticalSection m_TasksLock{};
-        ConditionVariable m_TasksCondition{};
+        Spinlock m_SleepersLock{};
+        std::vector<DefaultTaskWorker*> m_Sleepers{};
+        std::atomic_size_t m_SleepersCount{};
         CancellationToken m_CancellationToken{};
+        TaskWorkerCounters m_ExternalCounters{};
+        std::array<std::atomic_uint64_t, TaskPriorityCount> m_QueueHighWater{};
+        TaskLatencyHistogram m_DependencyLatency{};
+        std::atomic_int64_t m_NextStatisticsReport{};
 
     public:
         DefaultTaskScheduler();
 
+        explicit DefaultTaskScheduler(size_t workerCount, TaskWorkerPlacement placement = TaskWorkerPlacement::Topology);
+
         DefaultTaskScheduler(DefaultTaskScheduler const&) = delete;
 
         DefaultTaskScheduler(DefaultTaskScheduler&&) = delete;
@@ -50,6 +114,56 @@ namespace Anemone
 
         void TaskWorkerEntryPoint(uint32_t workerId);
 
+    private:
+        //! Gets worker associated with current thread, or nullptr when called from outside of this scheduler.
+        DefaultTaskWorker* GetCurrentWorker() const;
+
+        //! Resolves Inherited priority from task executing on current thread.
+        static TaskPriority ResolvePriority(TaskPriority priority);
+
+        //! Pushes ready task to local queue of current worker, or to the shared queue of its priority.
+        void Dispatch(Task& task);
+
+        //! Pushes ready task to local queue of current worker or to queue of preferred NUMA node.
+        //!
+        //! \return False when task has to be pushed to the shared queue of its priority.
+        bool TryDispatchLocal(Task& task);
+
+        //! Dispatches tasks waiting for completed awaiter. Tasks going to the same shared queue are pushed
+        //! with single lock acquisition, and workers are woken up once for whole batch.
+        void ReleaseWaitingTasks(TaskAwaiter& awaiter);
+
+        //! Tries to acquire ready task in priority order.
+        //!
+        //! Critical tasks are picked first, then aged Low/Background tasks, then local queue of the worker,
+        //! then shared queues by priority with stealing from other workers before falling back to Low/Background.
+        Task* TryAcquireTask(DefaultTaskWorker* worker);
+
+        Task* TryAcquireAgedTask(Instant now);
+
+        //! Tries to steal task, starting with closest workers. Falls back to queues of other NUMA nodes.
+        Task* TrySteal(DefaultTaskWorker* worker);
+
+        bool HasReadyTasks() const;
+
+        //! Executes single ready task, if available.
+        bool TryExecuteOne();
+
+        //! Parks worker until new tasks are dispatched or scheduler is cancelled.
+        void ParkWorker(DefaultTaskWorker& worker);
+
+        //! Wakes up to given number of parked workers.
+        void WakeWorkers(size_t count);
+
+        //! Gets counters of current worker, or counters shared by threads outside of scheduler.
+        TaskWorkerCounters& GetCurrentCounters();
+
+        //! Sums balance of scheduled and completed tasks of all threads.
+        int64_t CountTasksInFlight() const;
+
+        //! Reports statistics when interval configured by console variable elapsed.
+        void TryReportStatistics(Instant now);
+
     public:
         void Schedule(
             Task& task,
@@ -57,6 +171,8 @@ namespace Anemone
             TaskAwaiterHandle const& dependency,
             TaskPriority priority) override;
 
+        void ReleaseDependency(TaskAwaiterHandle const& awaiter) override;
+
         void Wait(TaskAwaiterHandle const& awaiter) override;
 
         bool TryWait(TaskAwaiterHandle const& awaiter, Duration timeout) override;
@@ -64,5 +180,31 @@ namespace Anemone
         void Delay(Duration timeout) override;
 
         uint32_t GetThreadsCount() const override;
+
+        bool IsLocalQueueEmpty() const override;
+
+    public:
+        //! Gets index of worker thread calling this function, or nothing when called from outside of this scheduler.
+        std::optional<uint32_t> GetCurrentWorkerIndex() const;
+
+        //! Gets logical processor worker thread is pinned to, or nothing when it is not pinned.
+        std::optional<LogicalProcessorInfo> GetWorkerProcessor(uint32_t workerId) const;
+
+        //! Gets histogram of time between task becoming ready and starting execution, summed over all threads.
+        TaskLatencySnapshot GetLatencyHistogram(TaskPriority priority) const;
+
+        //! Gets histogram of time between dependency completion and start of dependent task, summed over all threads.
+        TaskLatencySnapshot GetDependencyLatencyHistogram() const;
+
+        void ResetLatencyHistograms();
+
+        //! Captures snapshot of scheduler counters.
+        DefaultTaskSchedulerStatistics GetStatistics() const;
+
+        //! Resets worker counters, queue high-water marks and latency histograms.
+        void ResetStatistics();
+
+        //! Writes snapshot of scheduler counters to trace.
+        void ReportStatistics() const;
     };
 }
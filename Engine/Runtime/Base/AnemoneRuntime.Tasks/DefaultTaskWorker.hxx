@@ -1,6 +1,18 @@
 #pragma once
 #include "AnemoneRuntime.Interop/Headers.hxx"
 #include "AnemoneRuntime.Threading/Runnable.hxx"
+#include "AnemoneRuntime.Tasks/TaskDeque.hxx"
+#include "AnemoneRuntime.Tasks/TaskWorkerCounters.hxx"
+#include "AnemoneRuntime.Tasks/TaskLatencyHistogram.hxx"
+#include "AnemoneRuntime.Tasks/Task.hxx"
+#include "AnemoneRuntime.Random/Generator.hxx"
+#include "AnemoneRuntime.Threading/UserAutoResetEvent.hxx"
+#include "AnemoneRuntime.System/ProcessorProperties.hxx"
+
+#include <array>
+#include <optional>
+#include <span>
+#include <vector>
 
 namespace Anemone
 {
@@ -8,15 +20,44 @@ namespace Anemone
 
     class DefaultTaskWorker final : public Runnable
     {
+    public:
+        //! Number of tasks that can be queued locally before spilling to the shared queue.
+        static constexpr size_t LocalQueueCapacity = 4096;
+
+        //! Number of victim groups, from closest to farthest: same cache domain, same NUMA node, any worker.
+        static constexpr size_t VictimTierCount = 3;
+
     private:
         uint32_t m_Index{};
 
         DefaultTaskScheduler* m_Scheduler{};
 
+        TaskDeque m_LocalQueue{LocalQueueCapacity};
+
+        Xorshiro256ss m_Random;
+
+        //! Parking slot; worker sleeps on this event when there are no tasks to execute.
+        UserAutoResetEvent m_WakeEvent{};
+
+        //! Logical processor to which worker thread is pinned.
+        std::optional<LogicalProcessorInfo> m_Processor{};
+
+        //! Indices of other workers ordered by distance; tiers store end offsets of each group.
+        std::vector<uint32_t> m_Victims{};
+        std::array<size_t, VictimTierCount> m_VictimTiers{};
+
+        TaskWorkerCounters m_Counters{};
+
+        //! Latency histograms updated only by worker thread, so recording does not contend with other workers.
+        std::array<TaskLatencyHistogram, TaskPriorityCount> m_Latency{};
+        TaskLatencyHistogram m_DependencyLatency{};
+
     public:
-        explicit DefaultTaskWorker(uint32_t index, DefaultTaskScheduler* scheduler)
+        explicit DefaultTaskWorker(uint32_t index, DefaultTaskScheduler* scheduler, std::optional<LogicalProcessorInfo> processor)
             : m_Index{index}
             , m_Scheduler{scheduler}
+            , m_Random{index + 1u}
+            , m_Processor{processor}
         {
             AE_ASSERT(scheduler != nullptr);
         }
@@ -26,6 +67,90 @@ namespace Anemone
             return this->m_Index;
         }
 
+        DefaultTaskScheduler* GetScheduler() const
+        {
+            return this->m_Scheduler;
+        }
+
+        TaskDeque& GetLocalQueue()
+        {
+            return this->m_LocalQueue;
+        }
+
+        TaskWorkerCounters& GetCounters()
+        {
+            return this->m_Counters;
+        }
+
+        TaskWorkerCounters const& GetCounters() const
+        {
+            return this->m_Counters;
+        }
+
+        std::array<TaskLatencyHistogram, TaskPriorityCount>& GetLatencyHistograms()
+        {
+            return this->m_Latency;
+        }
+
+        std::array<TaskLatencyHistogram, TaskPriorityCount> const& GetLatencyHistograms() const
+        {
+            return this->m_Latency;
+        }
+
+        TaskLatencyHistogram& GetDependencyLatencyHistogram()
+        {
+            return this->m_DependencyLatency;
+        }
+
+        TaskLatencyHistogram const& GetDependencyLatencyHistogram() const
+        {
+            return this->m_DependencyLatency;
+        }
+
+        std::optional<LogicalProcessorInfo> const& GetProcessor() const
+        {
+            return this->m_Processor;
+        }
+
+        //! Gets NUMA node of worker, or zero when worker is not pinned.
+        uint32_t GetNumaNode() const
+        {
+            return this->m_Processor ? this->m_Processor->NumaNode : 0;
+        }
+
+        //! Selects random victim for stealing.
+        size_t SelectVictim(size_t count)
+        {
+            return static_cast<size_t>(this->m_Random.Next() % count);
+        }
+
+        void SetVictims(std::vector<uint32_t> victims, std::array<size_t, VictimTierCount> const& tiers)
+        {
+            AE_ASSERT(tiers.back() == victims.size());
+
+            this->m_Victims = std::move(victims);
+            this->m_VictimTiers = tiers;
+        }
+
+        //! Gets victims of given tier.
+        std::span<uint32_t const> GetVictims(size_t tier) const
+        {
+            size_t const first = (tier != 0) ? this->m_VictimTiers[tier - 1] : 0;
+            return std::span{this->m_Victims}.subspan(first, this->m_VictimTiers[tier] - first);
+        }
+
+        //! Blocks worker thread until woken by scheduler.
+        void Park()
+        {
+            this->m_WakeEvent.Wait();
+        }
+
+        //! Wakes parked worker. When worker is not parked, next call to Park returns immediately.
+        void Unpark()
+        {
+            this->m_WakeEvent.Set();
+        }
+
     protected:
         void OnRun() override;
     };
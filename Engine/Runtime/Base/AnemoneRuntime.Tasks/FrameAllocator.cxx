@@ -0,0 +1,178 @@
+#include "AnemoneRuntime.Tasks/FrameAllocator.hxx"
+#include "AnemoneRuntime.Tasks/DefaultTaskScheduler.hxx"
+#include "AnemoneRuntime.Threading/CurrentThread.hxx"
+#include "AnemoneRuntime.Threading/Lock.hxx"
+
+#include <cstring>
+
+namespace Anemone
+{
+    namespace
+    {
+        std::atomic<FrameAllocator*> gCurrentFrameAllocator{};
+    }
+
+    FrameAllocator::FrameAllocator(DefaultTaskScheduler& scheduler, size_t bufferCount, size_t arenaReserve)
+        : m_Scheduler{scheduler}
+        , m_OwnerThread{CurrentThread::Id()}
+    {
+        AE_ENSURE((MinBufferCount <= bufferCount) and (bufferCount <= MaxBufferCount), "Frame allocator must be double or triple buffered");
+
+        // Owner thread, every worker, and threads sharing single arena.
+        size_t const arenaCount = scheduler.GetThreadsCount() + 2;
+
+        this->m_Buffers.resize(bufferCount);
+
+        for (Buffer& buffer : this->m_Buffers)
+        {
+            buffer.Arenas.reserve(arenaCount);
+
+            for (size_t i = 0; i < arenaCount; ++i)
+            {
+                // Arenas commit memory on demand and return memory not used for a while.
+                buffer.Arenas.push_back(std::make_unique<RawMemoryArena>(RawMemoryArenaReservation{
+                    .Reserve = arenaReserve,
+                    .TrimAfterIdleResets = 60,
+                }));
+            }
+        }
+    }
+
+    FrameAllocator::~FrameAllocator()
+    {
+        FrameAllocator* self = this;
+        gCurrentFrameAllocator.compare_exchange_strong(self, nullptr, std::memory_order::acq_rel);
+
+        for (Buffer const& buffer : this->m_Buffers)
+        {
+            if (buffer.Fence)
+            {
+                this->m_Scheduler.Wait(buffer.Fence);
+            }
+        }
+    }
+
+    FrameAllocator& FrameAllocator::GetCurrent()
+    {
+        FrameAllocator* const allocator = gCurrentFrameAllocator.load(std::memory_order::acquire);
+        AE_ENSURE(allocator != nullptr, "No frame allocator installed");
+        return *allocator;
+    }
+
+    void FrameAllocator::SetCurrent(FrameAllocator* allocator)
+    {
+        gCurrentFrameAllocator.store(allocator, std::memory_order::release);
+    }
+
+    void FrameAllocator::BeginFrame()
+    {
+        AE_ASSERT(CurrentThread::Id() == this->m_OwnerThread);
+
+        uint64_t const frame = this->m_Frame.load(std::memory_order::relaxed) + 1;
+        Buffer& buffer = this->m_Buffers[frame % this->m_Buffers.size()];
+
+        // Frame which used this buffer must be done with its allocations.
+        if (TaskAwaiterHandle const fence = std::exchange(buffer.Fence, {}))
+        {
+            this->m_Scheduler.Wait(fence);
+        }
+
+        for (std::unique_ptr<RawMemoryArena> const& arena : buffer.Arenas)
+        {
+#if ANEMONE_FEATURE_FRAME_ALLOCATOR_VALIDATION
+            // Make reads through escaped pointers visible.
+            std::span<std::byte> const allocated = arena->GetVirtualAllocated();
+            std::memset(allocated.data(), static_cast<int>(PoisonValue), allocated.size());
+#endif
+
+            arena->Reset();
+        }
+
+        this->m_Frame.store(frame, std::memory_order::release);
+    }
+
+    void FrameAllocator::EndFrame(TaskAwaiterHandle fence)
+    {
+        AE_ASSERT(CurrentThread::Id() == this->m_OwnerThread);
+
+        Buffer& buffer = this->m_Buffers[this->m_Frame.load(std::memory_order::relaxed) % this->m_Buffers.size()];
+        buffer.Fence = std::move(fence);
+    }
+
+    void* FrameAllocator::Allocate(size_t size, size_t alignment)
+    {
+        Buffer& buffer = this->m_Buffers[this->GetFrame() % this->m_Buffers.size()];
+
+        size_t const index = this->GetArenaIndex();
+        RawMemoryArena& arena = *buffer.Arenas[index];
+
+        void* result;
+
+        if (index == (buffer.Arenas.size() - 1))
+            [[unlikely]]
+        {
+            UniqueLock scope{this->m_SharedLock};
+            result = arena.Allocate(size, alignment);
+        }
+        else
+        {
+            result = arena.Allocate(size, alignment);
+        }
+
+        AE_ASSERT(result != nullptr, "Out of memory");
+        return result;
+    }
+
+    void FrameAllocator::ValidatePointer(void const* pointer) const
+    {
+#if ANEMONE_FEATURE_FRAME_ALLOCATOR_VALIDATION
+        std::byte const* const address = static_cast<std::byte const*>(pointer);
+
+        for (Buffer const& buffer : this->m_Buffers)
+        {
+            for (std::unique_ptr<RawMemoryArena> const& arena : buffer.Arenas)
+            {
+                if (arena->IsReserved(address))
+                {
+                    std::span<std::byte> const allocated = arena->GetVirtualAllocated();
+
+                    if (address >= (allocated.data() + allocated.size()))
+                    {
+                        AE_PANIC("Frame allocation escaped its frame (address {}, current frame {})", pointer, this->GetFrame());
+                    }
+
+                    return;
+                }
+            }
+        }
+#else
+        (void)pointer;
+#endif
+    }
+
+    void FrameAllocator::QueryMemoryUsage(size_t& reserved, size_t& allocated) const
+    {
+        for (Buffer const& buffer : this->m_Buffers)
+        {
+            for (std::unique_ptr<RawMemoryArena> const& arena : buffer.Arenas)
+            {
+                arena->QueryMemoryUsage(reserved, allocated);
+            }
+        }
+    }
+
+    size_t FrameAllocator::GetArenaIndex() const
+    {
+        if (std::optional<uint32_t> const worker = this->m_Scheduler.GetCurrentWorkerIndex())
+        {
+            return *worker + 1;
+        }
+
+        if (CurrentThread::Id() == this->m_OwnerThread)
+        {
+            return 0;
+        }
+
+        return this->m_Scheduler.GetThreadsCount() + 1;
+    }
+}
@@ -0,0 +1,194 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+#include "AnemoneRuntime.Memory/RawMemoryArena.hxx"
+#include "AnemoneRuntime.Tasks/TaskAwaiter.hxx"
+#include "AnemoneRuntime.Threading/Spinlock.hxx"
+#include "AnemoneRuntime.Threading/Thread.hxx"
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
+
+#include <atomic>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Anemone
+{
+    class DefaultTaskScheduler;
+
+    //! Linear allocator for data living until end of frame, such as command lists, culling results or job payloads.
+    //!
+    //! Every thread has own arena, so allocation is just a pointer bump without synchronization: worker threads
+    //! of the scheduler and thread which created allocator each use their arena, while other threads share single
+    //! locked arena. Arenas are double or triple buffered; memory allocated during frame N is reclaimed in bulk
+    //! by BeginFrame of frame N + buffer count, after fence of frame N completed.
+    //!
+    //! Destructors of frame allocated objects are never called.
+    class ANEMONE_RUNTIME_BASE_API FrameAllocator final
+    {
+    public:
+        //! Size of virtual range reserved by every arena.
+        static constexpr size_t DefaultArenaReserve = size_t{64} << 20u;
+
+        static constexpr size_t MinBufferCount = 2;
+        static constexpr size_t MaxBufferCount = 3;
+
+        //! Byte written over reclaimed frame memory when validation is enabled.
+        static constexpr std::byte PoisonValue{0xDD};
+
+    private:
+        struct Buffer final
+        {
+            std::vector<std::unique_ptr<RawMemoryArena>> Arenas{};
+            TaskAwaiterHandle Fence{};
+        };
+
+        DefaultTaskScheduler& m_Scheduler;
+        ThreadId m_OwnerThread{};
+        std::vector<Buffer> m_Buffers{};
+        std::atomic_uint64_t m_Frame{};
+
+        //! Guards arena used by threads which don't own one.
+        Spinlock m_SharedLock{};
+
+    public:
+        //! \param bufferCount Number of frames which may use their allocations at the same time.
+        explicit FrameAllocator(DefaultTaskScheduler& scheduler, size_t bufferCount = MinBufferCount, size_t arenaReserve = DefaultArenaReserve);
+        FrameAllocator(FrameAllocator const&) = delete;
+        FrameAllocator(FrameAllocator&&) = delete;
+        FrameAllocator& operator=(FrameAllocator const&) = delete;
+        FrameAllocator& operator=(FrameAllocator&&) = delete;
+        ~FrameAllocator();
+
+    public:
+        //! Gets frame allocator used by FrameAlloc.
+        static FrameAllocator& GetCurrent();
+
+        static void SetCurrent(FrameAllocator* allocator);
+
+    public:
+        //! Starts next frame. Waits for fence of frame which used the same buffer, then reclaims its memory.
+        //!
+        //! Must be called by thread which created allocator.
+        void BeginFrame();
+
+        //! Sets fence which completes when allocations made during current frame are no longer used.
+        void EndFrame(TaskAwaiterHandle fence);
+
+        uint64_t GetFrame() const
+        {
+            return this->m_Frame.load(std::memory_order::acquire);
+        }
+
+        size_t GetBufferCount() const
+        {
+            return this->m_Buffers.size();
+        }
+
+        //! Checks whether allocations made during given frame were not reclaimed yet.
+        bool IsFrameAlive(uint64_t frame) const
+        {
+            uint64_t const current = this->GetFrame();
+            return (frame <= current) and ((frame + this->m_Buffers.size()) > current);
+        }
+
+        [[nodiscard]] void* Allocate(size_t size, size_t alignment);
+
+        template <typename T, typename... Args>
+        [[nodiscard]] T* Make(Args&&... args)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "Frame allocated objects are never destroyed");
+            return std::construct_at(static_cast<T*>(this->Allocate(sizeof(T), alignof(T))), std::forward<Args>(args)...);
+        }
+
+        template <typename T>
+        [[nodiscard]] std::span<T> MakeSpan(size_t count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "Frame allocated objects are never destroyed");
+
+            if (count == 0)
+            {
+                return {};
+            }
+
+            T* const memory = static_cast<T*>(this->Allocate(sizeof(T) * count, alignof(T)));
+            std::uninitialized_default_construct_n(memory, count);
+            return std::span<T>{memory, count};
+        }
+
+        //! Checks that pointer into frame memory was not used after its frame was reclaimed.
+        //!
+        //! Panics when pointer lies in arena range not used by any live frame. Pointers not allocated by frame
+        //! allocator are ignored. Does nothing when validation is disabled. Arenas are inspected without
+        //! synchronization, so this is meant for debugging from thread which drives frames.
+        void ValidatePointer(void const* pointer) const;
+
+        void QueryMemoryUsage(size_t& reserved, size_t& allocated) const;
+
+    private:
+        //! Gets index of arena used by calling thread. Last arena is shared by threads which don't own one.
+        size_t GetArenaIndex() const;
+    };
+
+    //! Pointer to frame allocated object, which detects use after its frame was reclaimed.
+    //!
+    //! Validation records frame of allocation and adds a check on every access; otherwise this is plain pointer.
+    template <typename T>
+    class FramePointer final
+    {
+    private:
+        T* m_Pointer{};
+#if ANEMONE_FEATURE_FRAME_ALLOCATOR_VALIDATION
+        FrameAllocator const* m_Allocator{};
+        uint64_t m_Frame{};
+#endif
+
+    public:
+        FramePointer() = default;
+
+        FramePointer(FrameAllocator const& allocator, T* pointer)
+            : m_Pointer{pointer}
+#if ANEMONE_FEATURE_FRAME_ALLOCATOR_VALIDATION
+            , m_Allocator{&allocator}
+            , m_Frame{allocator.GetFrame()}
+#endif
+        {
+            (void)allocator;
+        }
+
+        [[nodiscard]] T* Get() const
+        {
+#if ANEMONE_FEATURE_FRAME_ALLOCATOR_VALIDATION
+            if ((this->m_Allocator != nullptr) and not this->m_Allocator->IsFrameAlive(this->m_Frame))
+            {
+                AE_PANIC("Frame allocation escaped its frame (allocated in frame {}, current frame {})", this->m_Frame, this->m_Allocator->GetFrame());
+            }
+#endif
+
+            return this->m_Pointer;
+        }
+
+        [[nodiscard]] T* operator->() const
+        {
+            return this->Get();
+        }
+
+        [[nodiscard]] T& operator*() const
+        {
+            return *this->Get();
+        }
+
+        [[nodiscard]] explicit operator bool() const
+        {
+            return this->m_Pointer != nullptr;
+        }
+    };
+
+    //! Allocates object from current frame allocator. Object is valid until its frame is reclaimed.
+    template <typename T, typename... Args>
+    [[nodiscard]] FramePointer<T> FrameAlloc(Args&&... args)
+    {
+        FrameAllocator& allocator = FrameAllocator::GetCurrent();
+        return FramePointer<T>{allocator, allocator.Make<T>(std::forward<Args>(args)...)};
+    }
+}
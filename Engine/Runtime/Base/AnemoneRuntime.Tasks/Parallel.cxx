@@ -1,99 +1,62 @@
 #include "AnemoneRuntime.Tasks/Parallel.hxx"
 #include "AnemoneRuntime.Tasks/TaskScheduler.hxx"
+#include "AnemoneRuntime.Base/Instant.hxx"
+
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 
 namespace Anemone
 {
-    void Parallel::For(
-        size_t count,
-        size_t batch,
-        FunctionRef<void(size_t index, size_t count)> callback,
-        FunctionRef<void(size_t count)> finalize,
-        size_t workers,
-        TaskPriority priority)
+    namespace
     {
-        AE_ASSERT(batch != 0);
-
-        if (count == 0)
+        struct ParallelForContext final
         {
-            //
-            // Make sure to call the finalize callback when the count is zero.
-            //
+            FunctionRef<void(size_t index, size_t count)> Callback;
+            TaskScheduler& Scheduler;
+            TaskAwaiterHandle Join;
+            TaskAwaiterHandle Dependency;
+            TaskPriority Priority;
+            size_t Grain;
 
-            finalize(count);
-            return;
-        }
+            // Number of tasks which can still be spawned; limits concurrency when requested.
+            std::atomic<size_t> Budget;
 
-        TaskScheduler& taskScheduler = TaskScheduler::Get();
-
-        struct Partitioner final
-        {
-            FunctionRef<void(size_t index, size_t count)> Callback{};
-            size_t Count{};
-            size_t Batch{};
-
-            std::atomic<size_t> CurrentIndex{};
-
-            bool Partition(size_t& first, size_t& last)
+            bool TryAcquireBudget()
             {
-                size_t const batch = this->Batch;
-                size_t const count = this->Count;
-
-                size_t current = this->CurrentIndex.load(std::memory_order::relaxed);
+                size_t current = this->Budget.load(std::memory_order::relaxed);
 
-                while (true)
+                while (current != 0)
                 {
-                    if (current >= count)
+                    if (this->Budget.compare_exchange_weak(current, current - 1, std::memory_order::relaxed))
                     {
-                        // No more work.
-                        return false;
-                    }
-
-                    size_t next;
-
-                    if (batch > (count - current))
-                    {
-                        next = count;
-                    }
-                    else
-                    {
-                        next = current + batch;
-                    }
-
-                    if (this->CurrentIndex.compare_exchange_weak(
-                            current,
-                            next,
-                            std::memory_order::acquire,
-                            std::memory_order::relaxed))
-                    {
-                        // Successfully claimed the batch.
-                        first = current;
-                        last = next;
                         return true;
                     }
                 }
+
+                return false;
             }
 
-            void Execute()
+            void ReleaseBudget()
             {
-                size_t first;
-                size_t last;
-
-                while (this->Partition(first, last))
-                {
-                    this->Callback(first, last - first);
-                }
+                this->Budget.fetch_add(1, std::memory_order::relaxed);
             }
         };
 
+        void ProcessRange(ParallelForContext& context, size_t first, size_t last);
+
         class ParallelForTask final : public Task
         {
         private:
-            Partitioner& m_Partitioner;
+            ParallelForContext& m_Context;
+            size_t m_First;
+            size_t m_Last;
 
         public:
-            explicit ParallelForTask(Partitioner& parent)
-                : m_Partitioner{parent}
+            ParallelForTask(ParallelForContext& context, size_t first, size_t last)
+                : m_Context{context}
+                , m_First{first}
+                , m_Last{last}
             {
             }
 
@@ -106,61 +69,132 @@ namespace Anemone
         protected:
             void OnExecute() override
             {
-                this->m_Partitioner.Execute();
+                ProcessRange(this->m_Context, this->m_First, this->m_Last);
+                this->m_Context.ReleaseBudget();
             }
         };
 
-        // Number of worker threads in pool.
-        auto workersCount = std::max<size_t>(1, taskScheduler.GetThreadsCount());
-
-        if (workers == 0)
+        void ProcessRange(ParallelForContext& context, size_t first, size_t last)
         {
-            // Caller did not specify the number of threads.
-            workers = workersCount;
+            //
+            // Lazy binary splitting: hand out upper half of the range only when current thread has nothing
+            // else queued, which means that other threads might be idle and looking for work to steal.
+            // Otherwise process single chunk and check again.
+            //
+
+            size_t const grain = context.Grain;
+
+            while ((last - first) > grain)
+            {
+                if (context.Scheduler.IsLocalQueueEmpty() and context.TryAcquireBudget())
+                {
+                    size_t const middle = first + ((last - first) / 2);
+
+                    TaskHandle const task = MakeReference<ParallelForTask>(context, middle, last);
+                    context.Scheduler.Schedule(*task, context.Join, context.Dependency, context.Priority);
+
+                    last = middle;
+                }
+                else
+                {
+                    context.Callback(first, grain);
+                    first += grain;
+                }
+            }
+
+            if (first != last)
+            {
+                context.Callback(first, last - first);
+            }
         }
-        else
+
+        // Executes chunks of growing size on calling thread until execution time can be measured, then derives grain size from it.
+        size_t ProbeGrain(FunctionRef<void(size_t index, size_t count)> callback, size_t batch, size_t count, size_t& processed)
         {
-            // Adjust the number of threads to the number of workers.
-            workers = std::min<size_t>(workers, workersCount);
-        }
+            size_t probe = batch;
+
+            while (processed < count)
+            {
+                size_t const n = std::min(probe, count - processed);
 
-        // Estimated number of slices.
-        size_t const slices = (count / batch) + 1;
+                Instant const started = Instant::Now();
+                callback(processed, n);
+                Duration const elapsed = started.QueryElapsed();
 
-        // TODO: Promote this to some configurable constant.
-        constexpr auto maximumThreads = 32uz;
+                processed += n;
 
-        // Adjust the number of threads to the number of slices.
-        workers = std::min<size_t>(workers, std::min<size_t>(slices, maximumThreads));
+                int64_t const target = Parallel::TargetChunkDuration.ToNanoseconds();
+                int64_t const measured = elapsed.ToNanoseconds();
 
-        // Spawn tasks to (hopefully) saturate thread pool.
-        TaskHandle children[32];
+                if (measured >= (target / 4))
+                {
+                    double const scale = static_cast<double>(target) / static_cast<double>(measured);
 
-        // Create partitioner for given range.
-        Partitioner partitioner{
-            callback,
-            count,
-            batch,
-        };
+                    return std::max(batch, static_cast<size_t>(static_cast<double>(n) * scale));
+                }
 
-        // Fork/Join awaiter.
-        TaskAwaiterHandle joinCounter = MakeReference<TaskAwaiter>();
-        TaskAwaiterHandle forkCounter = MakeReference<TaskAwaiter>();
+                probe *= 2;
+            }
 
-        // Spawn tasks.
-        for (auto i = 0uz; i < workers; ++i)
+            return probe;
+        }
+    }
+
+    void Parallel::For(
+        TaskScheduler& taskScheduler,
+        size_t count,
+        size_t batch,
+        FunctionRef<void(size_t index, size_t count)> callback,
+        FunctionRef<void(size_t count)> finalize,
+        size_t workers,
+        TaskPriority priority)
+    {
+        AE_ASSERT(batch != 0);
+
+        if (count == 0)
         {
-            children[i] = MakeReference<ParallelForTask>(partitioner);
+            //
+            // Make sure to call the finalize callback when the count is zero.
+            //
 
-            taskScheduler.Schedule(*children[i], joinCounter, forkCounter, priority);
+            finalize(count);
+            return;
+        }
+
+        size_t const threads = size_t{taskScheduler.GetThreadsCount()} + 1;
+
+        if ((workers == 1) or (threads == 1) or (count <= batch))
+        {
+            // Nothing to parallelize.
+            callback(0, count);
+            finalize(count);
+            return;
         }
 
-        // Contribute with executing tasks.
-        partitioner.Execute();
+        // Measure cost of work on first items.
+        size_t processed = 0;
+        size_t grain = ProbeGrain(callback, batch, count, processed);
 
-        // Wait for counter.
-        // TODO: for diagnostic purposes, could we return number of processed tasks during awaiting?
-        taskScheduler.Wait(joinCounter);
+        if (processed < count)
+        {
+            // Keep enough chunks for load balancing, even when items are expensive.
+            grain = std::clamp(grain, batch, std::max(batch, (count - processed) / (threads * 8)));
+
+            ParallelForContext context{
+                .Callback = callback,
+                .Scheduler = taskScheduler,
+                .Join = MakeReference<TaskAwaiter>(),
+                .Dependency = MakeReference<TaskAwaiter>(),
+                .Priority = priority,
+                .Grain = grain,
+                .Budget = (workers == 0) ? SIZE_MAX : (workers - 1),
+            };
+
+            ProcessRange(context, processed, count);
+
+            // Help executing tasks until all spawned ranges are completed.
+            taskScheduler.Wait(context.Join);
+        }
 
         // Finalize range.
         finalize(count);
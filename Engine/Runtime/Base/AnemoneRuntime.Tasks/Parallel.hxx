@@ -3,6 +3,14 @@
 #include "AnemoneRuntime.Base/FunctionRef.hxx"
 #include "AnemoneRuntime.Tasks/Task.hxx"
 #include "AnemoneRuntime.Tasks/TaskAwaiter.hxx"
+#include "AnemoneRuntime.Tasks/TaskScheduler.hxx"
+#include "AnemoneRuntime.Threading/Spinlock.hxx"
+#include "AnemoneRuntime.Threading/Lock.hxx"
+#include "AnemoneRuntime.Base/Duration.hxx"
+
+#include <algorithm>
+#include <span>
+#include <vector>
 
 namespace Anemone
 {
@@ -10,7 +18,19 @@ namespace Anemone
     {
         Parallel() = delete;
 
+        //! Target duration of single chunk of work. Grain size is adjusted to match it.
+        static constexpr Duration TargetChunkDuration = Duration::FromMicroseconds(25);
+
+        //! Executes callback over range [0, count) split into chunks.
+        //!
+        //! Range is split lazily in halves, only when current thread has no other queued work; busy workers
+        //! process their ranges sequentially. Chunk size adapts to measured cost of callback, with `batch`
+        //! being the minimal chunk size. Calling thread executes part of the range and helps executing other
+        //! tasks while waiting, so loops may be safely nested inside tasks.
+        //!
+        //! \param workers Maximum number of threads working on this loop at once; 0 means no limit.
         ANEMONE_RUNTIME_BASE_API static void For(
+            TaskScheduler& scheduler,
             size_t count,
             size_t batch,
             FunctionRef<void(size_t index, size_t count)> callback,
@@ -18,6 +38,17 @@ namespace Anemone
             size_t workers = 0,
             TaskPriority priority = TaskPriority::Inherited);
 
+        static void For(
+            size_t count,
+            size_t batch,
+            FunctionRef<void(size_t index, size_t count)> callback,
+            FunctionRef<void(size_t count)> finalize,
+            size_t workers = 0,
+            TaskPriority priority = TaskPriority::Inherited)
+        {
+            For(TaskScheduler::Get(), count, batch, callback, finalize, workers, priority);
+        }
+
         static void For(
             size_t count,
             size_t batch,
@@ -29,6 +60,115 @@ namespace Anemone
             {
             }, workers, priority);
         }
+
+        //! Reduces range [0, count) in parallel.
+        //!
+        //! Map is called with chunks of range and returns partial result for that chunk. Partial results are
+        //! combined in unspecified order, so combine must be associative and commutative.
+        template <typename T, typename MapT, typename CombineT>
+        static T Reduce(
+            size_t count,
+            size_t batch,
+            T identity,
+            MapT&& map,
+            CombineT&& combine,
+            TaskPriority priority = TaskPriority::Inherited)
+        {
+            T result = identity;
+            Spinlock lock{};
+
+            For(count, batch, [&](size_t index, size_t n)
+            {
+                T partial = map(index, n);
+
+                UniqueLock scope{lock};
+                result = combine(std::move(result), std::move(partial));
+            }, 0, priority);
+
+            return result;
+        }
+
+        //! Computes inclusive prefix scan of input into output in parallel.
+        //!
+        //! Input is processed in blocks: block totals are computed in parallel, then scanned sequentially,
+        //! and finally propagated to blocks in parallel. Combine must be associative.
+        template <typename T, typename CombineT>
+        static void Scan(
+            std::span<T const> input,
+            std::span<T> output,
+            T identity,
+            CombineT&& combine,
+            TaskPriority priority = TaskPriority::Inherited)
+        {
+            AE_ASSERT(input.size() == output.size());
+
+            size_t const count = input.size();
+
+            if (count == 0)
+            {
+                return;
+            }
+
+            // Few blocks per thread for load balancing; each block is scanned twice.
+            size_t const threads = size_t{TaskScheduler::Get().GetThreadsCount()} + 1;
+            size_t const blockCount = std::min(count, threads * 4);
+            size_t const blockSize = (count + blockCount - 1) / blockCount;
+
+            std::vector<T> offsets(blockCount, identity);
+
+            auto blockRange = [&](size_t block, size_t& first, size_t& last)
+            {
+                first = std::min(count, block * blockSize);
+                last = std::min(count, first + blockSize);
+            };
+
+            // Local scan of each block.
+            For(blockCount, 1, [&](size_t index, size_t n)
+            {
+                for (size_t block = index; block < (index + n); ++block)
+                {
+                    size_t first;
+                    size_t last;
+                    blockRange(block, first, last);
+
+                    T accumulator = identity;
+
+                    for (size_t i = first; i < last; ++i)
+                    {
+                        accumulator = combine(accumulator, input[i]);
+                        output[i] = accumulator;
+                    }
+
+                    offsets[block] = accumulator;
+                }
+            }, 0, priority);
+
+            // Exclusive scan of block totals.
+            T carry = identity;
+
+            for (T& offset : offsets)
+            {
+                T const total = offset;
+                offset = carry;
+                carry = combine(carry, total);
+            }
+
+            // Propagate offsets; first block is already complete.
+            For(blockCount - 1, 1, [&](size_t index, size_t n)
+            {
+                for (size_t block = index + 1; block < (index + n + 1); ++block)
+                {
+                    size_t first;
+                    size_t last;
+                    blockRange(block, first, last);
+
+                    for (size_t i = first; i < last; ++i)
+                    {
+                        output[i] = combine(offsets[block], output[i]);
+                    }
+                }
+            }, 0, priority);
+        }
     };
 }
 
@@ -73,6 +73,7 @@ namespace Anemone
     {
         AE_ENSURE(this->m_Status == TaskStatus::Dispatched, "Invalid task state");
         this->m_Status = TaskStatus::Pending;
+        this->m_WasPending = true;
     }
 
     void Task::PendingToDispatched()
@@ -81,6 +82,29 @@ namespace Anemone
         this->m_Status = TaskStatus::Dispatched;
     }
 
+    void Task::Reset()
+    {
+        switch (this->m_Status)
+        {
+        case TaskStatus::Created:
+        case TaskStatus::Completed:
+        case TaskStatus::Cancelled:
+        case TaskStatus::Abandoned:
+            break;
+
+        case TaskStatus::Dispatched:
+        case TaskStatus::Pending:
+        case TaskStatus::Executing:
+            AE_PANIC("Invalid task state");
+        }
+
+        this->m_Awaiter = {};
+        this->m_DependencyAwaiter = {};
+        this->m_Status = TaskStatus::Created;
+        this->m_WasPending = false;
+        this->m_Id = 0;
+    }
+
     uint32_t Task::AcquireReference()
     {
         return this->m_ReferenceCount.fetch_add(1, std::memory_order::relaxed);
@@ -3,7 +3,11 @@
 #include "AnemoneRuntime.Base/Flags.hxx"
 #include "AnemoneRuntime.Base/Intrusive.hxx"
 #include "AnemoneRuntime.Base/Reference.hxx"
+#include "AnemoneRuntime.Base/Instant.hxx"
 #include "AnemoneRuntime.Tasks/TaskAwaiter.hxx"
+#include "AnemoneRuntime.Tasks/TaskAllocator.hxx"
+
+#include <limits>
 
 namespace Anemone
 {
@@ -43,6 +47,9 @@ namespace Anemone
         Inherited,
     };
 
+    //! Number of priority levels which have own run queue. Does not include Inherited.
+    inline constexpr size_t TaskPriorityCount = static_cast<size_t>(TaskPriority::Inherited);
+
     enum class TaskOption : uint8_t
     {
         None = 0u,
@@ -57,15 +64,24 @@ namespace Anemone
         friend struct IntrusiveList<Task, Task>;
         friend class Reference<Task>;
         friend class TaskScheduler;
+        friend class TaskAwaiter;
+
+    public:
+        //! Affinity hint value for tasks which may run on any NUMA node.
+        static constexpr uint32_t AnyNumaNode = std::numeric_limits<uint32_t>::max();
 
     private:
         TaskAwaiterHandle m_Awaiter{};
         TaskAwaiterHandle m_DependencyAwaiter{};
+        Task* m_NextWaiting{};
+        Instant m_ReadyTime{};
         std::atomic<uint32_t> m_ReferenceCount{};
         TaskOptions m_Options{TaskOption::Dispose};
         TaskPriority m_Priority{TaskPriority::Inherited};
         TaskStatus m_Status{TaskStatus::Created};
+        bool m_WasPending{};
         uint32_t m_Id{};
+        uint32_t m_AffinityHint{AnyNumaNode};
 
     public:
         Task() = default;
@@ -75,6 +91,18 @@ namespace Anemone
         Task& operator=(Task&&) = delete;
         virtual ~Task() = default;
 
+    public:
+        //! Tasks are short-lived and allocated at high rate; recycle them through pooled allocator.
+        static void* operator new(size_t size)
+        {
+            return TaskAllocator::Allocate(size);
+        }
+
+        static void operator delete(void* pointer, size_t size)
+        {
+            TaskAllocator::Deallocate(pointer, size);
+        }
+
     protected:
         virtual void OnExecute() { }
 
@@ -86,6 +114,11 @@ namespace Anemone
         void DispatchedToPending();
         void PendingToDispatched();
 
+        //! Returns finished task to Created state, so it may be scheduled again.
+        //!
+        //! Scheduler must have already released its reference to the task.
+        void Reset();
+
     public:
         TaskAwaiterHandle& GetAwaiter()
         {
@@ -112,11 +145,42 @@ namespace Anemone
             this->m_Priority = value;
         }
 
+        //! Gets time at which task was made ready to run.
+        Instant GetReadyTime() const
+        {
+            return this->m_ReadyTime;
+        }
+
+        void SetReadyTime(Instant value)
+        {
+            this->m_ReadyTime = value;
+        }
+
+        //! Gets NUMA node on which task prefers to run.
+        uint32_t GetAffinityHint() const
+        {
+            return this->m_AffinityHint;
+        }
+
+        //! Sets NUMA node on which task prefers to run, e.g. node owning memory it processes.
+        //!
+        //! This is only a hint; when workers of that node are busy, task may be stolen by any other worker.
+        void SetAffinityHint(uint32_t numaNode)
+        {
+            this->m_AffinityHint = numaNode;
+        }
+
         TaskStatus GetStatus() const
         {
             return this->m_Status;
         }
 
+        //! Checks whether task had to wait for its dependency before it was ready to run.
+        bool WasPending() const
+        {
+            return this->m_WasPending;
+        }
+
         uint32_t GetId() const
         {
             return this->m_Id;
@@ -126,6 +190,11 @@ namespace Anemone
         uint32_t AcquireReference();
 
         uint32_t ReleaseReference();
+
+        uint32_t GetReferenceCount() const
+        {
+            return this->m_ReferenceCount.load(std::memory_order::acquire);
+        }
     };
 
     using TaskHandle = Reference<Task>;
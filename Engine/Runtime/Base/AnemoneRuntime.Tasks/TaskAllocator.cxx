@@ -0,0 +1,380 @@
+#include "AnemoneRuntime.Tasks/TaskAllocator.hxx"
+#include "AnemoneRuntime.Base/Intrusive.hxx"
+#include "AnemoneRuntime.Base/LockfreeIntrusive.hxx"
+#include "AnemoneRuntime.Threading/Spinlock.hxx"
+#include "AnemoneRuntime.Threading/Lock.hxx"
+#include "AnemoneRuntime.Profiler/Profiler.hxx"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <new>
+#include <vector>
+
+namespace Anemone
+{
+    AE_DECLARE_PROFILE(TaskAllocator);
+
+    namespace
+    {
+        // Number of blocks moved between thread cache and shared pool at once.
+        constexpr size_t BatchSize = 32;
+
+        // Thread cache returns one batch to shared pool when it holds this many free blocks.
+        constexpr size_t ThreadCacheCapacity = BatchSize * 2;
+
+        // Size of memory chunk carved into blocks of single size class.
+        constexpr size_t ChunkSize = size_t{64} << 10u;
+
+        constexpr size_t GetSizeClass(size_t size)
+        {
+            return (size - 1) / TaskAllocator::Granularity;
+        }
+
+        constexpr size_t GetBlockSize(size_t sizeClass)
+        {
+            return (sizeClass + 1) * TaskAllocator::Granularity;
+        }
+
+        // Free block. Blocks are linked into batches; first block of batch is pushed onto shared stack.
+        struct FreeBlock final : LockFreeIntrusiveStackNode<FreeBlock>
+        {
+            FreeBlock* NextInBatch{};
+            size_t BatchCount{};
+        };
+
+        static_assert(sizeof(FreeBlock) <= TaskAllocator::Granularity);
+
+        struct ThreadCache;
+
+        struct SharedPool final
+        {
+            std::array<LockFreeIntrusiveStack<FreeBlock>, TaskAllocator::SizeClassCount> Batches{};
+
+            // Guards chunks and registry of thread caches.
+            Spinlock Lock{};
+            std::vector<void*> Chunks{};
+            IntrusiveList<ThreadCache> Caches{};
+
+            std::atomic_uint64_t HeapAllocations{};
+            std::atomic_uint64_t Transfers{};
+
+            // Counters of thread caches which were already destroyed.
+            std::atomic_uint64_t RetiredAllocations{};
+            std::atomic_uint64_t RetiredDeallocations{};
+
+            SharedPool() = default;
+            SharedPool(SharedPool const&) = delete;
+            SharedPool(SharedPool&&) = delete;
+            SharedPool& operator=(SharedPool const&) = delete;
+            SharedPool& operator=(SharedPool&&) = delete;
+
+            ~SharedPool()
+            {
+                // Blocks live inside chunks; unlink them before chunks are released.
+                for (LockFreeIntrusiveStack<FreeBlock>& batches : this->Batches)
+                {
+                    while (batches.Pop())
+                    {
+                    }
+                }
+
+                for (void* chunk : this->Chunks)
+                {
+                    ::operator delete(chunk, std::align_val_t{TaskAllocator::Granularity});
+                }
+            }
+
+            void PushBatch(size_t sizeClass, FreeBlock* first, size_t count)
+            {
+                first->BatchCount = count;
+                this->Batches[sizeClass].Push(first);
+                this->Transfers.fetch_add(1, std::memory_order::relaxed);
+            }
+
+            FreeBlock* PopBatch(size_t sizeClass)
+            {
+                FreeBlock* const result = this->Batches[sizeClass].Pop();
+
+                if (result != nullptr)
+                {
+                    this->Transfers.fetch_add(1, std::memory_order::relaxed);
+                }
+
+                return result;
+            }
+
+            // Carves new chunk into batches. Returns first batch, pushes remaining ones to shared stack.
+            FreeBlock* AllocateChunk(size_t sizeClass)
+            {
+                std::byte* const chunk = static_cast<std::byte*>(::operator new(ChunkSize, std::align_val_t{TaskAllocator::Granularity}));
+                this->HeapAllocations.fetch_add(1, std::memory_order::relaxed);
+
+                // Chunks are released only when process exits.
+                AE_PROFILE_ALLOCATE(TaskAllocator, chunk, ChunkSize);
+
+                {
+                    UniqueLock scope{this->Lock};
+                    this->Chunks.push_back(chunk);
+                }
+
+                size_t const blockSize = GetBlockSize(sizeClass);
+                size_t const blockCount = ChunkSize / blockSize;
+
+                FreeBlock* result = nullptr;
+
+                for (size_t first = 0; first < blockCount; first += BatchSize)
+                {
+                    size_t const count = std::min(BatchSize, blockCount - first);
+
+                    FreeBlock* head = nullptr;
+
+                    for (size_t i = count; i != 0; --i)
+                    {
+                        head = new (chunk + ((first + i - 1) * blockSize)) FreeBlock{.NextInBatch = head};
+                    }
+
+                    head->BatchCount = count;
+
+                    if (result == nullptr)
+                    {
+                        result = head;
+                    }
+                    else
+                    {
+                        this->Batches[sizeClass].Push(head);
+                    }
+                }
+
+                return result;
+            }
+
+            // Allocates single block bypassing thread cache.
+            void* AllocateOne(size_t sizeClass)
+            {
+                FreeBlock* batch = this->PopBatch(sizeClass);
+
+                if (batch == nullptr)
+                {
+                    batch = this->AllocateChunk(sizeClass);
+                }
+
+                if (FreeBlock* const rest = batch->NextInBatch)
+                {
+                    this->PushBatch(sizeClass, rest, batch->BatchCount - 1);
+                }
+
+                batch->~FreeBlock();
+                return batch;
+            }
+        };
+
+        SharedPool& GetSharedPool()
+        {
+            static SharedPool instance{};
+            return instance;
+        }
+
+        struct ThreadCache final : IntrusiveListNode<ThreadCache>
+        {
+            struct Bin final
+            {
+                FreeBlock* Head{};
+                size_t Count{};
+            };
+
+            std::array<Bin, TaskAllocator::SizeClassCount> Bins{};
+
+            // Written only by owning thread; read by statistics.
+            std::atomic_uint64_t Allocations{};
+            std::atomic_uint64_t Deallocations{};
+
+            ThreadCache()
+            {
+                SharedPool& pool = GetSharedPool();
+                UniqueLock scope{pool.Lock};
+                pool.Caches.PushBack(this);
+            }
+
+            ThreadCache(ThreadCache const&) = delete;
+            ThreadCache(ThreadCache&&) = delete;
+            ThreadCache& operator=(ThreadCache const&) = delete;
+            ThreadCache& operator=(ThreadCache&&) = delete;
+
+            ~ThreadCache();
+
+            void* Allocate(size_t sizeClass)
+            {
+                Bin& bin = this->Bins[sizeClass];
+
+                if (bin.Head == nullptr)
+                    [[unlikely]]
+                {
+                    SharedPool& pool = GetSharedPool();
+
+                    FreeBlock* batch = pool.PopBatch(sizeClass);
+
+                    if (batch == nullptr)
+                    {
+                        batch = pool.AllocateChunk(sizeClass);
+                    }
+
+                    bin.Head = batch;
+                    bin.Count = batch->BatchCount;
+                }
+
+                FreeBlock* const result = bin.Head;
+                bin.Head = result->NextInBatch;
+                --bin.Count;
+
+                this->Allocations.store(this->Allocations.load(std::memory_order::relaxed) + 1, std::memory_order::relaxed);
+
+                result->~FreeBlock();
+                return result;
+            }
+
+            void Deallocate(void* pointer, size_t sizeClass)
+            {
+                Bin& bin = this->Bins[sizeClass];
+
+                bin.Head = new (pointer) FreeBlock{.NextInBatch = bin.Head};
+                ++bin.Count;
+
+                this->Deallocations.store(this->Deallocations.load(std::memory_order::relaxed) + 1, std::memory_order::relaxed);
+
+                if (bin.Count >= ThreadCacheCapacity)
+                    [[unlikely]]
+                {
+                    this->ReleaseBatch(sizeClass);
+                }
+            }
+
+            // Moves one batch of most recently freed blocks to shared pool.
+            void ReleaseBatch(size_t sizeClass)
+            {
+                Bin& bin = this->Bins[sizeClass];
+
+                size_t const count = std::min(BatchSize, bin.Count);
+
+                FreeBlock* const first = bin.Head;
+                FreeBlock* last = first;
+
+                for (size_t i = 1; i < count; ++i)
+                {
+                    last = last->NextInBatch;
+                }
+
+                bin.Head = last->NextInBatch;
+                bin.Count -= count;
+                last->NextInBatch = nullptr;
+
+                GetSharedPool().PushBatch(sizeClass, first, count);
+            }
+        };
+
+        // Set when thread cache of current thread was destroyed; allocator falls back to shared pool.
+        thread_local bool tlsThreadCacheDestroyed{};
+
+        thread_local ThreadCache tlsThreadCache{};
+
+        ThreadCache::~ThreadCache()
+        {
+            tlsThreadCacheDestroyed = true;
+
+            for (size_t sizeClass = 0; sizeClass < TaskAllocator::SizeClassCount; ++sizeClass)
+            {
+                while (this->Bins[sizeClass].Count != 0)
+                {
+                    this->ReleaseBatch(sizeClass);
+                }
+            }
+
+            SharedPool& pool = GetSharedPool();
+
+            pool.RetiredAllocations.fetch_add(this->Allocations.load(std::memory_order::relaxed), std::memory_order::relaxed);
+            pool.RetiredDeallocations.fetch_add(this->Deallocations.load(std::memory_order::relaxed), std::memory_order::relaxed);
+
+            UniqueLock scope{pool.Lock};
+            pool.Caches.Remove(this);
+        }
+    }
+
+    void* TaskAllocator::Allocate(size_t size)
+    {
+        AE_ASSERT(size != 0);
+
+        if (size > MaxPooledSize)
+            [[unlikely]]
+        {
+            SharedPool& pool = GetSharedPool();
+            pool.HeapAllocations.fetch_add(1, std::memory_order::relaxed);
+            pool.RetiredAllocations.fetch_add(1, std::memory_order::relaxed);
+
+            void* const result = ::operator new(size, std::align_val_t{Granularity});
+            AE_PROFILE_ALLOCATE(TaskAllocator, result, size);
+            return result;
+        }
+
+        if (tlsThreadCacheDestroyed)
+            [[unlikely]]
+        {
+            // Thread is exiting; allocate directly from shared pool.
+            SharedPool& pool = GetSharedPool();
+            pool.RetiredAllocations.fetch_add(1, std::memory_order::relaxed);
+            return pool.AllocateOne(GetSizeClass(size));
+        }
+
+        return tlsThreadCache.Allocate(GetSizeClass(size));
+    }
+
+    void TaskAllocator::Deallocate(void* pointer, size_t size)
+    {
+        if (pointer == nullptr)
+        {
+            return;
+        }
+
+        if (size > MaxPooledSize)
+            [[unlikely]]
+        {
+            GetSharedPool().RetiredDeallocations.fetch_add(1, std::memory_order::relaxed);
+            AE_PROFILE_FREE(TaskAllocator, pointer);
+            ::operator delete(pointer, std::align_val_t{Granularity});
+            return;
+        }
+
+        if (tlsThreadCacheDestroyed)
+            [[unlikely]]
+        {
+            // Thread is exiting; return block directly to shared pool as single-element batch.
+            SharedPool& pool = GetSharedPool();
+            pool.RetiredDeallocations.fetch_add(1, std::memory_order::relaxed);
+            pool.PushBatch(GetSizeClass(size), new (pointer) FreeBlock{}, 1);
+            return;
+        }
+
+        tlsThreadCache.Deallocate(pointer, GetSizeClass(size));
+    }
+
+    TaskAllocatorStatistics TaskAllocator::GetStatistics()
+    {
+        SharedPool& pool = GetSharedPool();
+
+        TaskAllocatorStatistics result{
+            .Allocations = pool.RetiredAllocations.load(std::memory_order::relaxed),
+            .Deallocations = pool.RetiredDeallocations.load(std::memory_order::relaxed),
+            .HeapAllocations = pool.HeapAllocations.load(std::memory_order::relaxed),
+            .Transfers = pool.Transfers.load(std::memory_order::relaxed),
+        };
+
+        UniqueLock scope{pool.Lock};
+
+        pool.Caches.ForEach([&](ThreadCache const& cache)
+        {
+            result.Allocations += cache.Allocations.load(std::memory_order::relaxed);
+            result.Deallocations += cache.Deallocations.load(std::memory_order::relaxed);
+        });
+
+        return result;
+    }
+}
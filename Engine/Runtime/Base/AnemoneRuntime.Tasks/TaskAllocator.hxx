@@ -0,0 +1,48 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Anemone
+{
+    struct TaskAllocatorStatistics final
+    {
+        //! Number of objects allocated by task allocator.
+        uint64_t Allocations;
+
+        //! Number of objects returned to task allocator.
+        uint64_t Deallocations;
+
+        //! Number of requests which had to go to the global heap: new chunks and oversized objects.
+        uint64_t HeapAllocations;
+
+        //! Number of batches moved between thread caches and shared pool.
+        uint64_t Transfers;
+    };
+
+    //! Pooled allocator for tasks and task awaiters.
+    //!
+    //! Objects are rounded up to cacheline-sized size classes, so pooled objects never share cache lines.
+    //! Each thread keeps its own freelist per size class; blocks are exchanged with shared pool in batches
+    //! through lock-free stacks, so allocation and deallocation never take a global lock.
+    struct TaskAllocator final
+    {
+        TaskAllocator() = delete;
+
+        //! Allocation granularity and alignment of pooled objects.
+        static constexpr size_t Granularity = ANEMONE_CACHELINE_SIZE;
+
+        //! Number of size classes. Larger objects are allocated from global heap.
+        static constexpr size_t SizeClassCount = 8;
+
+        //! Maximum size of pooled object.
+        static constexpr size_t MaxPooledSize = Granularity * SizeClassCount;
+
+        ANEMONE_RUNTIME_BASE_API static void* Allocate(size_t size);
+
+        ANEMONE_RUNTIME_BASE_API static void Deallocate(void* pointer, size_t size);
+
+        ANEMONE_RUNTIME_BASE_API static TaskAllocatorStatistics GetStatistics();
+    };
+}
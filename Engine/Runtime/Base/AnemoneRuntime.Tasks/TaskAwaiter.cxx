@@ -1,12 +1,49 @@
 #include "AnemoneRuntime.Tasks/TaskAwaiter.hxx"
 #include "AnemoneRuntime.Tasks/Task.hxx"
 
+#include <utility>
+
 namespace Anemone
 {
-    void TaskAwaiter::AddWaitingTask(Task& task)
+    bool TaskAwaiter::AddWaitingTask(Task& task)
+    {
+        AE_ASSERT(task.m_NextWaiting == nullptr);
+
+        Task* head = this->m_WaitList.load(std::memory_order::relaxed);
+
+        do
+        {
+            task.m_NextWaiting = head;
+        } while (not this->m_WaitList.compare_exchange_weak(head, &task, std::memory_order::seq_cst, std::memory_order::relaxed));
+
+        // Pairs with decrement in NotifyCompleted and exchange in FlushWaitList: either completing thread
+        // observes this task in wait list, or we observe completed counter here.
+        return this->m_Value.load(std::memory_order::seq_cst) == 0;
+    }
+
+    size_t TaskAwaiter::FlushWaitList(IntrusiveList<Task, Task>& list)
     {
-        UniqueLock scope{this->m_Lock};
+        if (not this->IsCompleted())
+        {
+            return 0;
+        }
+
+        // Detach whole stack at once; concurrent flushes get disjoint sets of tasks.
+        Task* head = this->m_WaitList.exchange(nullptr, std::memory_order::seq_cst);
+
+        // Stack is in reverse order of insertion; restore FIFO order.
+        IntrusiveList<Task, Task> reversed{};
+        size_t count = 0;
+
+        while (head != nullptr)
+        {
+            Task* const next = std::exchange(head->m_NextWaiting, nullptr);
+            reversed.PushFront(head);
+            head = next;
+            ++count;
+        }
 
-        this->m_WaitList.PushBack(&task);
+        list.SpliceBack(reversed);
+        return count;
     }
 }
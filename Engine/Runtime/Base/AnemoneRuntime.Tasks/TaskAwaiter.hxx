@@ -2,7 +2,9 @@
 #include "AnemoneRuntime.Interop/Headers.hxx"
 #include "AnemoneRuntime.Base/Intrusive.hxx"
 #include "AnemoneRuntime.Base/Reference.hxx"
-#include "AnemoneRuntime.Threading/Spinlock.hxx"
+#include "AnemoneRuntime.Tasks/TaskAllocator.hxx"
+
+#include <atomic>
 
 namespace Anemone
 {
@@ -15,8 +17,21 @@ namespace Anemone
     private:
         std::atomic<uint32_t> m_Value{};
         std::atomic<uint32_t> m_ReferenceCount{};
-        Spinlock m_Lock{};
-        IntrusiveList<Task, Task> m_WaitList{};
+
+        //! Lock-free stack of tasks waiting for this awaiter, linked through Task::m_NextWaiting.
+        std::atomic<Task*> m_WaitList{};
+
+    public:
+        //! Awaiters are short-lived and allocated at high rate; recycle them through pooled allocator.
+        static void* operator new(size_t size)
+        {
+            return TaskAllocator::Allocate(size);
+        }
+
+        static void operator delete(void* pointer, size_t size)
+        {
+            TaskAllocator::Deallocate(pointer, size);
+        }
 
     public:
         bool IsCompleted() const
@@ -29,24 +44,21 @@ namespace Anemone
             ++this->m_Value;
         }
 
-        void AddWaitingTask(Task& task);
+        //! Adds task to wait list.
+        //!
+        //! \return True when awaiter was completed concurrently; caller must flush wait list, as completing
+        //!         thread may have flushed it before task was added.
+        [[nodiscard]] bool AddWaitingTask(Task& task);
 
         bool NotifyCompleted()
         {
             return --this->m_Value == 0;
         }
 
-        void FlushWaitList(IntrusiveList<Task, Task>& list)
-        {
-            AE_ASSERT(list.IsEmpty());
-
-            UniqueLock scope{this->m_Lock};
-
-            if (this->IsCompleted())
-            {
-                list.Splice(this->m_WaitList);
-            }
-        }
+        //! Takes all waiting tasks when awaiter is completed. Tasks are appended to list in order they were added.
+        //!
+        //! \return Number of tasks taken.
+        size_t FlushWaitList(IntrusiveList<Task, Task>& list);
 
     private:
         uint32_t AcquireReference()
@@ -0,0 +1 @@
+#include "AnemoneRuntime.Tasks/TaskDeque.hxx"
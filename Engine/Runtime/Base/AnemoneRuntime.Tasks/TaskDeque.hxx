@@ -0,0 +1,150 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <bit>
+
+namespace Anemone
+{
+    class Task;
+
+    //! Bounded work-stealing deque (Chase-Lev).
+    //!
+    //! The owning worker pushes and pops tasks at the bottom end in LIFO order. Other workers steal
+    //! from the top end in FIFO order. Owner operations are wait-free in the common case; thieves
+    //! race with a single CAS on the top index.
+    //
+    // Implementation notes:
+    // - capacity must be a power of 2, so indices can be masked instead of wrapped
+    // - capacity is fixed; when full, the caller is expected to spill tasks to a shared queue
+    // - memory ordering follows "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al.)
+    class TaskDeque final
+    {
+    private:
+        alignas(ANEMONE_CACHELINE_SIZE) std::atomic<int64_t> m_Top{};
+        alignas(ANEMONE_CACHELINE_SIZE) std::atomic<int64_t> m_Bottom{};
+        alignas(ANEMONE_CACHELINE_SIZE) std::unique_ptr<std::atomic<Task*>[]> m_Items{};
+        int64_t m_Mask{};
+
+    public:
+        explicit TaskDeque(size_t capacity)
+        {
+            size_t const alignedCapacity = std::bit_ceil(capacity);
+
+            this->m_Items = std::make_unique<std::atomic<Task*>[]>(alignedCapacity);
+            this->m_Mask = static_cast<int64_t>(alignedCapacity - 1);
+        }
+
+        TaskDeque(TaskDeque const&) = delete;
+        TaskDeque(TaskDeque&&) = delete;
+        TaskDeque& operator=(TaskDeque const&) = delete;
+        TaskDeque& operator=(TaskDeque&&) = delete;
+        ~TaskDeque() = default;
+
+    public:
+        //! Pushes task at the bottom of the deque. Must be called by the owner thread only.
+        //!
+        //! \return False when deque is full.
+        bool Push(Task* task)
+        {
+            int64_t const bottom = this->m_Bottom.load(std::memory_order::relaxed);
+            int64_t const top = this->m_Top.load(std::memory_order::acquire);
+
+            if ((bottom - top) > this->m_Mask)
+            {
+                // Deque is full.
+                return false;
+            }
+
+            this->m_Items[bottom & this->m_Mask].store(task, std::memory_order::relaxed);
+            std::atomic_thread_fence(std::memory_order::release);
+            this->m_Bottom.store(bottom + 1, std::memory_order::relaxed);
+            return true;
+        }
+
+        //! Pops most recently pushed task. Must be called by the owner thread only.
+        Task* Pop()
+        {
+            int64_t const bottom = this->m_Bottom.load(std::memory_order::relaxed) - 1;
+            this->m_Bottom.store(bottom, std::memory_order::relaxed);
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+            int64_t top = this->m_Top.load(std::memory_order::relaxed);
+
+            if (top > bottom)
+            {
+                // Deque is empty; restore bottom index.
+                this->m_Bottom.store(bottom + 1, std::memory_order::relaxed);
+                return nullptr;
+            }
+
+            Task* result = this->m_Items[bottom & this->m_Mask].load(std::memory_order::relaxed);
+
+            if (top == bottom)
+            {
+                // Last item in deque; race against thieves.
+                if (not this->m_Top.compare_exchange_strong(
+                        top,
+                        top + 1,
+                        std::memory_order::seq_cst,
+                        std::memory_order::relaxed))
+                {
+                    // Thief won.
+                    result = nullptr;
+                }
+
+                this->m_Bottom.store(bottom + 1, std::memory_order::relaxed);
+            }
+
+            return result;
+        }
+
+        //! Steals the oldest task from the deque. May be called by any thread.
+        //!
+        //! \return nullptr when deque is empty or when another thread won the race.
+        Task* Steal()
+        {
+            int64_t top = this->m_Top.load(std::memory_order::acquire);
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+            int64_t const bottom = this->m_Bottom.load(std::memory_order::acquire);
+
+            if (top >= bottom)
+            {
+                return nullptr;
+            }
+
+            Task* const result = this->m_Items[top & this->m_Mask].load(std::memory_order::relaxed);
+
+            if (not this->m_Top.compare_exchange_strong(
+                    top,
+                    top + 1,
+                    std::memory_order::seq_cst,
+                    std::memory_order::relaxed))
+            {
+                // Lost race with owner or another thief.
+                return nullptr;
+            }
+
+            return result;
+        }
+
+        //! Gets approximate number of tasks in deque.
+        size_t GetCount() const
+        {
+            int64_t const bottom = this->m_Bottom.load(std::memory_order::relaxed);
+            int64_t const top = this->m_Top.load(std::memory_order::relaxed);
+            return static_cast<size_t>(std::max<int64_t>(bottom - top, 0));
+        }
+
+        bool IsEmpty() const
+        {
+            return this->GetCount() == 0;
+        }
+
+        size_t GetCapacity() const
+        {
+            return static_cast<size_t>(this->m_Mask + 1);
+        }
+    };
+}
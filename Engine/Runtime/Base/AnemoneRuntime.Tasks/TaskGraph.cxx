@@ -0,0 +1,335 @@
+#include "AnemoneRuntime.Tasks/TaskGraph.hxx"
+#include "AnemoneRuntime.Threading/SpinWait.hxx"
+#include "AnemoneRuntime.Diagnostics/Trace.hxx"
+#include "AnemoneRuntime.Diagnostics/Debug.hxx"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace Anemone
+{
+    namespace
+    {
+        constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+        // Reusable task executing single node of graph.
+        class TaskGraphNodeTask final : public Task
+        {
+        private:
+            TaskGraph& m_Graph;
+            uint32_t m_Index;
+
+        public:
+            TaskGraphNodeTask(TaskGraph& graph, uint32_t index)
+                : m_Graph{graph}
+                , m_Index{index}
+            {
+            }
+
+        protected:
+            void OnExecute() override
+            {
+                this->m_Graph.ExecuteNode(this->m_Index);
+            }
+        };
+    }
+
+    TaskGraph::TaskGraph()
+        : m_NoDependency{MakeReference<TaskAwaiter>()}
+    {
+    }
+
+    TaskGraph::~TaskGraph()
+    {
+        AE_ENSURE(not this->m_Completion or this->m_Completion->IsCompleted(), "Task graph destroyed while running");
+
+        // Node tasks refer to this graph; make sure scheduler is done with them.
+        this->WaitForTasksReleased();
+    }
+
+    TaskGraphNode TaskGraph::AddNode(std::string_view name, std::function<void()> callback, TaskPriority priority)
+    {
+        AE_ASSERT(callback);
+
+        uint32_t const index = static_cast<uint32_t>(this->m_Nodes.size());
+
+        this->m_Nodes.push_back(NodeDescriptor{
+            .Name = std::string{name},
+            .Callback = std::move(callback),
+            .Priority = priority,
+        });
+
+        this->m_Compiled = false;
+
+        return TaskGraphNode{index};
+    }
+
+    void TaskGraph::AddEdge(TaskGraphNode before, TaskGraphNode after)
+    {
+        AE_ASSERT(before.Index < this->m_Nodes.size());
+        AE_ASSERT(after.Index < this->m_Nodes.size());
+        AE_ASSERT(before.Index != after.Index);
+
+        this->m_Edges.emplace_back(before.Index, after.Index);
+        this->m_Compiled = false;
+    }
+
+    void TaskGraph::Compile()
+    {
+        AE_ENSURE(not this->m_Completion or this->m_Completion->IsCompleted(), "Task graph modified while running");
+
+        size_t const count = this->m_Nodes.size();
+
+        //
+        // Build successor lists as single flat array indexed by per-node offsets.
+        //
+
+        this->m_SuccessorOffsets.assign(count + 1, 0);
+        this->m_DependencyCount.assign(count, 0);
+
+        for (auto const& [before, after] : this->m_Edges)
+        {
+            ++this->m_SuccessorOffsets[before + 1];
+            ++this->m_DependencyCount[after];
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            this->m_SuccessorOffsets[i + 1] += this->m_SuccessorOffsets[i];
+        }
+
+        this->m_Successors.resize(this->m_Edges.size());
+
+        {
+            std::vector<uint32_t> cursor{this->m_SuccessorOffsets.begin(), this->m_SuccessorOffsets.end() - 1};
+
+            for (auto const& [before, after] : this->m_Edges)
+            {
+                this->m_Successors[cursor[before]++] = after;
+            }
+        }
+
+        //
+        // Sort nodes topologically.
+        //
+
+        this->m_Order.clear();
+        this->m_Order.reserve(count);
+        this->m_Roots.clear();
+
+        std::vector<uint32_t> remaining{this->m_DependencyCount};
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (remaining[i] == 0)
+            {
+                this->m_Roots.push_back(i);
+                this->m_Order.push_back(i);
+            }
+        }
+
+        for (size_t position = 0; position < this->m_Order.size(); ++position)
+        {
+            uint32_t const node = this->m_Order[position];
+
+            for (uint32_t i = this->m_SuccessorOffsets[node]; i < this->m_SuccessorOffsets[node + 1]; ++i)
+            {
+                uint32_t const successor = this->m_Successors[i];
+
+                if (--remaining[successor] == 0)
+                {
+                    this->m_Order.push_back(successor);
+                }
+            }
+        }
+
+        AE_ENSURE(this->m_Order.size() == count, "Task graph contains cycle");
+
+        //
+        // Allocate per-node state once; runs only reset it.
+        //
+
+        this->WaitForTasksReleased();
+
+        this->m_Counters = std::make_unique<std::atomic_uint32_t[]>(count);
+        this->m_Tasks.clear();
+        this->m_Tasks.reserve(count);
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            this->m_Tasks.push_back(MakeReference<TaskGraphNodeTask>(*this, i));
+        }
+
+        this->m_NodeStarted.assign(count, Instant{});
+        this->m_NodeFinished.assign(count, Instant{});
+
+        this->m_Compiled = true;
+    }
+
+    TaskAwaiterHandle TaskGraph::Start(TaskScheduler& scheduler)
+    {
+        AE_ENSURE(this->m_Compiled, "Task graph must be compiled before it's started");
+        AE_ENSURE(not this->m_Completion or this->m_Completion->IsCompleted(), "Task graph is already running");
+
+        this->WaitForTasksReleased();
+
+        size_t const count = this->m_Nodes.size();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            this->m_Counters[i].store(this->m_DependencyCount[i], std::memory_order::relaxed);
+            this->m_Tasks[i]->Reset();
+        }
+
+        this->m_Scheduler = &scheduler;
+        this->m_Completion = MakeReference<TaskAwaiter>();
+        this->m_StartTime = Instant::Now();
+
+        // Keep completion pending until all roots are scheduled; first root may finish before second one is dispatched.
+        TaskAwaiterHandle completion = this->m_Completion;
+        completion->AddDependency();
+
+        for (uint32_t const root : this->m_Roots)
+        {
+            this->Dispatch(root);
+        }
+
+        // All nodes may have finished already; tasks waiting for graph must be dispatched then.
+        scheduler.ReleaseDependency(completion);
+
+        return completion;
+    }
+
+    void TaskGraph::Run(TaskScheduler& scheduler)
+    {
+        TaskAwaiterHandle const completion = this->Start(scheduler);
+        scheduler.Wait(completion);
+    }
+
+    void TaskGraph::ExecuteNode(uint32_t index)
+    {
+        this->m_NodeStarted[index] = Instant::Now();
+        this->m_Nodes[index].Callback();
+        this->m_NodeFinished[index] = Instant::Now();
+
+        for (uint32_t i = this->m_SuccessorOffsets[index]; i < this->m_SuccessorOffsets[index + 1]; ++i)
+        {
+            uint32_t const successor = this->m_Successors[i];
+
+            // Last predecessor to finish dispatches successor.
+            if (this->m_Counters[successor].fetch_sub(1, std::memory_order::acq_rel) == 1)
+            {
+                this->Dispatch(successor);
+            }
+        }
+    }
+
+    void TaskGraph::Dispatch(uint32_t index)
+    {
+        // Completion awaiter gets new dependency before the dispatching node completes, so it can't complete early.
+        this->m_Scheduler->Schedule(
+            *this->m_Tasks[index],
+            this->m_Completion,
+            this->m_NoDependency,
+            this->m_Nodes[index].Priority);
+    }
+
+    void TaskGraph::WaitForTasksReleased() const
+    {
+        // Scheduler releases its reference right after task completes its awaiter.
+        for (TaskHandle const& task : this->m_Tasks)
+        {
+            WaitForCompletion([&]
+            {
+                return task->GetReferenceCount() == 1;
+            });
+        }
+    }
+
+    TaskGraphCriticalPath TaskGraph::GetCriticalPath() const
+    {
+        AE_ENSURE(this->m_Compiled, "Task graph must be compiled");
+        AE_ENSURE(this->m_Completion and this->m_Completion->IsCompleted(), "Task graph has not completed");
+
+        size_t const count = this->m_Nodes.size();
+
+        TaskGraphCriticalPath result{};
+
+        if (count == 0)
+        {
+            return result;
+        }
+
+        // Length of longest chain ending at given node, and predecessor on that chain.
+        std::vector<Duration> length(count);
+        std::vector<uint32_t> previous(count, InvalidIndex);
+
+        Instant finished = this->m_StartTime;
+        uint32_t last = this->m_Order.front();
+
+        for (uint32_t const node : this->m_Order)
+        {
+            Duration const duration = this->m_NodeFinished[node] - this->m_NodeStarted[node];
+
+            result.Work += duration;
+            length[node] += duration;
+
+            finished = std::max(finished, this->m_NodeFinished[node]);
+
+            if (length[node] > length[last])
+            {
+                last = node;
+            }
+
+            for (uint32_t i = this->m_SuccessorOffsets[node]; i < this->m_SuccessorOffsets[node + 1]; ++i)
+            {
+                uint32_t const successor = this->m_Successors[i];
+
+                if ((previous[successor] == InvalidIndex) or (length[node] > length[previous[successor]]))
+                {
+                    previous[successor] = node;
+                    length[successor] = length[node];
+                }
+            }
+        }
+
+        result.Length = length[last];
+        result.Elapsed = finished - this->m_StartTime;
+
+        for (uint32_t node = last; node != InvalidIndex; node = previous[node])
+        {
+            result.Nodes.push_back(TaskGraphNode{node});
+        }
+
+        std::reverse(result.Nodes.begin(), result.Nodes.end());
+
+        return result;
+    }
+
+    void TaskGraph::ReportCriticalPath() const
+    {
+        TaskGraphCriticalPath const path = this->GetCriticalPath();
+
+        TraceDispatcher& trace = Trace::Get();
+
+        int64_t const length = std::max<int64_t>(path.Length.ToMicroseconds(), 1);
+
+        trace.TraceInformation(
+            "task graph: nodes = {}, elapsed = {} us, work = {} us, critical path = {} us, parallelism = {:.2f}",
+            this->m_Nodes.size(),
+            path.Elapsed.ToMicroseconds(),
+            path.Work.ToMicroseconds(),
+            path.Length.ToMicroseconds(),
+            static_cast<double>(path.Work.ToMicroseconds()) / static_cast<double>(length));
+
+        for (TaskGraphNode const node : path.Nodes)
+        {
+            trace.TraceInformation(
+                "task graph: {}: started = +{} us, duration = {} us",
+                this->m_Nodes[node.Index].Name,
+                (this->m_NodeStarted[node.Index] - this->m_StartTime).ToMicroseconds(),
+                (this->m_NodeFinished[node.Index] - this->m_NodeStarted[node.Index]).ToMicroseconds());
+        }
+    }
+}
@@ -0,0 +1,138 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+#include "AnemoneRuntime.Base/Duration.hxx"
+#include "AnemoneRuntime.Base/Instant.hxx"
+#include "AnemoneRuntime.Tasks/Task.hxx"
+#include "AnemoneRuntime.Tasks/TaskAwaiter.hxx"
+#include "AnemoneRuntime.Tasks/TaskScheduler.hxx"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Anemone
+{
+    //! Identifies node of task graph.
+    struct TaskGraphNode final
+    {
+        uint32_t Index;
+    };
+
+    struct TaskGraphCriticalPath final
+    {
+        //! Nodes on the longest chain of dependent nodes, in execution order.
+        std::vector<TaskGraphNode> Nodes;
+
+        //! Sum of execution times of nodes on critical path. Graph can't complete faster than this.
+        Duration Length;
+
+        //! Sum of execution times of all nodes.
+        Duration Work;
+
+        //! Time between start of graph and completion of its last node.
+        Duration Elapsed;
+    };
+
+    //! Graph of tasks declared once and executed many times.
+    //!
+    //! Nodes and edges are declared up front and compiled into topologically sorted order with successors
+    //! stored in flat arrays. Each node owns reusable task object and dependency counter, so running
+    //! compiled graph again only resets counters; no awaiters are created per edge.
+    class ANEMONE_RUNTIME_BASE_API TaskGraph final
+    {
+    private:
+        struct NodeDescriptor final
+        {
+            std::string Name;
+            std::function<void()> Callback;
+            TaskPriority Priority;
+        };
+
+        std::vector<NodeDescriptor> m_Nodes{};
+        std::vector<std::pair<uint32_t, uint32_t>> m_Edges{};
+
+        // Compiled plan.
+        std::vector<uint32_t> m_Order{};
+        std::vector<uint32_t> m_Roots{};
+        std::vector<uint32_t> m_SuccessorOffsets{};
+        std::vector<uint32_t> m_Successors{};
+        std::vector<uint32_t> m_DependencyCount{};
+        std::unique_ptr<std::atomic_uint32_t[]> m_Counters{};
+        std::vector<TaskHandle> m_Tasks{};
+        bool m_Compiled{};
+
+        // State of current run.
+        TaskScheduler* m_Scheduler{};
+        TaskAwaiterHandle m_Completion{};
+        TaskAwaiterHandle m_NoDependency{};
+        Instant m_StartTime{};
+        std::vector<Instant> m_NodeStarted{};
+        std::vector<Instant> m_NodeFinished{};
+
+    public:
+        TaskGraph();
+        TaskGraph(TaskGraph const&) = delete;
+        TaskGraph(TaskGraph&&) = delete;
+        TaskGraph& operator=(TaskGraph const&) = delete;
+        TaskGraph& operator=(TaskGraph&&) = delete;
+        ~TaskGraph();
+
+    public:
+        //! Adds node executing callback. Graph has to be compiled again after adding nodes.
+        TaskGraphNode AddNode(std::string_view name, std::function<void()> callback, TaskPriority priority = TaskPriority::Normal);
+
+        //! Makes node `after` wait for completion of node `before`.
+        void AddEdge(TaskGraphNode before, TaskGraphNode after);
+
+        //! Sorts nodes topologically and builds execution plan. Graph must not contain cycles.
+        void Compile();
+
+        bool IsCompiled() const
+        {
+            return this->m_Compiled;
+        }
+
+        size_t GetNodeCount() const
+        {
+            return this->m_Nodes.size();
+        }
+
+        std::string_view GetNodeName(TaskGraphNode node) const
+        {
+            return this->m_Nodes[node.Index].Name;
+        }
+
+        //! Gets nodes in order in which they may be executed sequentially.
+        std::span<uint32_t const> GetTopologicalOrder() const
+        {
+            return this->m_Order;
+        }
+
+        //! Starts compiled graph on scheduler.
+        //!
+        //! \return Awaiter completed when all nodes finish.
+        TaskAwaiterHandle Start(TaskScheduler& scheduler = TaskScheduler::Get());
+
+        //! Runs compiled graph and waits for its completion. Calling thread helps executing tasks.
+        void Run(TaskScheduler& scheduler = TaskScheduler::Get());
+
+        //! Computes critical path of last completed run.
+        TaskGraphCriticalPath GetCriticalPath() const;
+
+        //! Writes critical path of last completed run to trace.
+        void ReportCriticalPath() const;
+
+    public: // internal
+        void ExecuteNode(uint32_t index);
+
+    private:
+        void Dispatch(uint32_t index);
+
+        //! Waits until scheduler released all tasks of previous run, so they can be reset.
+        void WaitForTasksReleased() const;
+    };
+}
@@ -0,0 +1,105 @@
+#include "AnemoneRuntime.Tasks/TaskLatencyHistogram.hxx"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace Anemone
+{
+    void TaskLatencyHistogram::Record(Duration latency)
+    {
+        uint64_t const microseconds = static_cast<uint64_t>(std::max<int64_t>(latency.ToMicroseconds(), 0));
+        size_t const bucket = std::min<size_t>(std::bit_width(microseconds), BucketCount - 1);
+        this->m_Buckets[bucket].fetch_add(1, std::memory_order::relaxed);
+    }
+
+    void TaskLatencyHistogram::RecordExclusive(Duration latency)
+    {
+        uint64_t const microseconds = static_cast<uint64_t>(std::max<int64_t>(latency.ToMicroseconds(), 0));
+        size_t const bucket = std::min<size_t>(std::bit_width(microseconds), BucketCount - 1);
+        std::atomic_uint64_t& counter = this->m_Buckets[bucket];
+        counter.store(counter.load(std::memory_order::relaxed) + 1, std::memory_order::relaxed);
+    }
+
+    void TaskLatencyHistogram::Reset()
+    {
+        for (std::atomic_uint64_t& bucket : this->m_Buckets)
+        {
+            bucket.store(0, std::memory_order::relaxed);
+        }
+    }
+
+    TaskLatencyHistogram::Buckets TaskLatencyHistogram::Snapshot() const
+    {
+        Buckets result{};
+
+        for (size_t i = 0; i < BucketCount; ++i)
+        {
+            result[i] = this->m_Buckets[i].load(std::memory_order::relaxed);
+        }
+
+        return result;
+    }
+
+    uint64_t TaskLatencyHistogram::GetCount() const
+    {
+        TaskLatencySnapshot snapshot{};
+        snapshot.Accumulate(*this);
+        return snapshot.GetCount();
+    }
+
+    Duration TaskLatencyHistogram::GetPercentile(double fraction) const
+    {
+        TaskLatencySnapshot snapshot{};
+        snapshot.Accumulate(*this);
+        return snapshot.GetPercentile(fraction);
+    }
+
+    void TaskLatencySnapshot::Accumulate(TaskLatencyHistogram const& histogram)
+    {
+        TaskLatencyHistogram::Buckets const buckets = histogram.Snapshot();
+
+        for (size_t i = 0; i < TaskLatencyHistogram::BucketCount; ++i)
+        {
+            this->Buckets[i] += buckets[i];
+        }
+    }
+
+    uint64_t TaskLatencySnapshot::GetCount() const
+    {
+        uint64_t result = 0;
+
+        for (uint64_t const count : this->Buckets)
+        {
+            result += count;
+        }
+
+        return result;
+    }
+
+    Duration TaskLatencySnapshot::GetPercentile(double fraction) const
+    {
+        uint64_t const total = this->GetCount();
+
+        if (total == 0)
+        {
+            return {};
+        }
+
+        uint64_t const threshold = static_cast<uint64_t>(std::ceil(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(total)));
+
+        uint64_t accumulated = 0;
+
+        for (size_t i = 0; i < TaskLatencyHistogram::BucketCount; ++i)
+        {
+            accumulated += this->Buckets[i];
+
+            if (accumulated >= threshold)
+            {
+                return TaskLatencyHistogram::GetBucketUpperBound(i);
+            }
+        }
+
+        return TaskLatencyHistogram::GetBucketUpperBound(TaskLatencyHistogram::BucketCount - 1);
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+#include "AnemoneRuntime.Base/Duration.hxx"
+
+#include <array>
+#include <atomic>
+
+namespace Anemone
+{
+    struct TaskLatencySnapshot;
+
+    //! Lock-free histogram of task latencies with power-of-two microsecond buckets.
+    //!
+    //! Bucket N counts samples in range [2^(N-1), 2^N) microseconds; bucket 0 counts samples below 1 microsecond.
+    class TaskLatencyHistogram final
+    {
+    public:
+        static constexpr size_t BucketCount = 32;
+
+        using Buckets = std::array<uint64_t, BucketCount>;
+
+    private:
+        std::array<std::atomic_uint64_t, BucketCount> m_Buckets{};
+
+    public:
+        TaskLatencyHistogram() = default;
+        TaskLatencyHistogram(TaskLatencyHistogram const&) = delete;
+        TaskLatencyHistogram(TaskLatencyHistogram&&) = delete;
+        TaskLatencyHistogram& operator=(TaskLatencyHistogram const&) = delete;
+        TaskLatencyHistogram& operator=(TaskLatencyHistogram&&) = delete;
+        ~TaskLatencyHistogram() = default;
+
+    public:
+        //! Records sample; may be called by any thread.
+        ANEMONE_RUNTIME_BASE_API void Record(Duration latency);
+
+        //! Records sample without atomic read-modify-write. Only for histogram updated by single thread; it still
+        //! may be read by other threads. Samples recorded concurrently with reset may survive it.
+        ANEMONE_RUNTIME_BASE_API void RecordExclusive(Duration latency);
+
+        ANEMONE_RUNTIME_BASE_API void Reset();
+
+        ANEMONE_RUNTIME_BASE_API Buckets Snapshot() const;
+
+        ANEMONE_RUNTIME_BASE_API uint64_t GetCount() const;
+
+        //! Gets upper bound of latency below which given fraction of samples fall.
+        ANEMONE_RUNTIME_BASE_API Duration GetPercentile(double fraction) const;
+
+        //! Gets upper bound of latency represented by bucket.
+        static constexpr Duration GetBucketUpperBound(size_t bucket)
+        {
+            return Duration::FromMicroseconds(int64_t{1} << bucket);
+        }
+    };
+
+    //! Snapshot of latency histogram, possibly summed over histograms recorded by different threads.
+    struct TaskLatencySnapshot final
+    {
+        TaskLatencyHistogram::Buckets Buckets{};
+
+        //! Adds current values of histogram to snapshot.
+        ANEMONE_RUNTIME_BASE_API void Accumulate(TaskLatencyHistogram const& histogram);
+
+        ANEMONE_RUNTIME_BASE_API uint64_t GetCount() const;
+
+        //! Gets upper bound of latency below which given fraction of samples fall.
+        ANEMONE_RUNTIME_BASE_API Duration GetPercentile(double fraction) const;
+    };
+}
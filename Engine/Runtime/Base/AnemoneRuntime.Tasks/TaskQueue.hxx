@@ -1,6 +1,7 @@
 #pragma once
 #include "AnemoneRuntime.Interop/Headers.hxx"
 #include "AnemoneRuntime.Tasks/Task.hxx"
+#include "AnemoneRuntime.Threading/Spinlock.hxx"
 
 namespace Anemone
 {
@@ -9,7 +10,7 @@ namespace Anemone
     private:
         mutable Spinlock m_lock{};
         IntrusiveList<Task, Task> m_items{};
-        size_t m_count{};
+        std::atomic_size_t m_count{};
 
     public:
         TaskQueue() = default;
@@ -26,7 +27,15 @@ namespace Anemone
 
             UniqueLock scope{this->m_lock};
             this->m_items.PushBack(task);
-            ++this->m_count;
+            this->m_count.fetch_add(1, std::memory_order::relaxed);
+        }
+
+        //! Appends whole list of tasks under single lock acquisition.
+        void PushList(IntrusiveList<Task, Task>& tasks, size_t count)
+        {
+            UniqueLock scope{this->m_lock};
+            this->m_items.SpliceBack(tasks);
+            this->m_count.fetch_add(count, std::memory_order::relaxed);
         }
 
         Task* Pop()
@@ -36,22 +45,39 @@ namespace Anemone
 
             if (result)
             {
-                --this->m_count;
+                this->m_count.fetch_sub(1, std::memory_order::relaxed);
             }
 
             return result;
         }
 
-        bool IsEmpty() const
+        //! Pops first task only if it matches predicate.
+        template <typename PredicateT = bool(Task const&)>
+        Task* PopIf(PredicateT&& predicate)
         {
             UniqueLock scope{this->m_lock};
-            return this->m_items.IsEmpty();
+
+            Task* result = this->m_items.PeekFront();
+
+            if (result and std::forward<PredicateT>(predicate)(*result))
+            {
+                this->m_items.PopFront();
+                this->m_count.fetch_sub(1, std::memory_order::relaxed);
+                return result;
+            }
+
+            return nullptr;
+        }
+
+        // Note: count is updated under lock but can be queried without it; result is approximate.
+        bool IsEmpty() const
+        {
+            return this->m_count.load(std::memory_order::relaxed) == 0;
         }
 
         size_t GetCount() const
         {
-            UniqueLock scope{this->m_lock};
-            return this->m_count;
+            return this->m_count.load(std::memory_order::relaxed);
         }
     };
 }
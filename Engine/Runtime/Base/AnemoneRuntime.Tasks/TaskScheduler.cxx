@@ -1,12 +1,31 @@
 #include "AnemoneRuntime.Tasks/TaskScheduler.hxx"
 #include "AnemoneRuntime.Base/UninitializedObject.hxx"
 #include "AnemoneRuntime.Tasks/DefaultTaskScheduler.hxx"
+#include "AnemoneRuntime.Base/ConsoleFunction.hxx"
 
 namespace Anemone
 {
     namespace
     {
         UninitializedObject<DefaultTaskScheduler> gDefaultTaskScheduler{};
+
+        // Writes statistics of default scheduler to trace; "reset" argument resets them instead.
+        ConsoleFunction gTaskStatisticsFunction{"Tasks.Statistics", [](std::string_view args)
+        {
+            if (not gDefaultTaskScheduler.IsInitialized())
+            {
+                return;
+            }
+
+            if (args == "reset")
+            {
+                gDefaultTaskScheduler->ResetStatistics();
+            }
+            else
+            {
+                gDefaultTaskScheduler->ReportStatistics();
+            }
+        }};
     }
 
     void TaskScheduler::Initialize()
@@ -30,6 +30,10 @@ namespace Anemone
             TaskAwaiterHandle const& dependency,
             TaskPriority priority) = 0;
 
+        //! Releases dependency added with TaskAwaiter::AddDependency. When awaiter becomes completed, tasks
+        //! waiting for it are dispatched.
+        virtual void ReleaseDependency(TaskAwaiterHandle const& awaiter) = 0;
+
         virtual void Wait(TaskAwaiterHandle const& awaiter) = 0;
 
         virtual bool TryWait(TaskAwaiterHandle const& awaiter, Duration timeout) = 0;
@@ -37,5 +41,10 @@ namespace Anemone
         virtual void Delay(Duration timeout) = 0;
 
         virtual uint32_t GetThreadsCount() const = 0;
+
+        //! Checks whether there is no queued work which current thread would execute next.
+        //!
+        //! Used by parallel algorithms to decide whether splitting work is worth it.
+        virtual bool IsLocalQueueEmpty() const = 0;
     };
 }
@@ -0,0 +1,26 @@
+#include "AnemoneRuntime.Tasks/TaskWorkerCounters.hxx"
+
+namespace Anemone
+{
+    TaskWorkerStatistics TaskWorkerCounters::Snapshot() const
+    {
+        return TaskWorkerStatistics{
+            .TasksExecuted = this->m_TasksExecuted.load(std::memory_order::relaxed),
+            .BusyTime = Duration::FromNanoseconds(this->m_BusyTime.load(std::memory_order::relaxed)),
+            .IdleTime = Duration::FromNanoseconds(this->m_IdleTime.load(std::memory_order::relaxed)),
+            .Wakeups = this->m_Wakeups.load(std::memory_order::relaxed),
+            .Steals = this->m_Steals.load(std::memory_order::relaxed),
+            .LocalQueueHighWater = this->m_LocalQueueHighWater.load(std::memory_order::relaxed),
+        };
+    }
+
+    void TaskWorkerCounters::Reset()
+    {
+        this->m_TasksExecuted.store(0, std::memory_order::relaxed);
+        this->m_BusyTime.store(0, std::memory_order::relaxed);
+        this->m_IdleTime.store(0, std::memory_order::relaxed);
+        this->m_Wakeups.store(0, std::memory_order::relaxed);
+        this->m_Steals.store(0, std::memory_order::relaxed);
+        this->m_LocalQueueHighWater.store(0, std::memory_order::relaxed);
+    }
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include "AnemoneRuntime.Interop/Headers.hxx"
+#include "AnemoneRuntime.Base/Duration.hxx"
+
+#include <atomic>
+#include <cstdint>
+
+namespace Anemone
+{
+    struct TaskWorkerStatistics final
+    {
+        //! Number of tasks executed by thread.
+        uint64_t TasksExecuted;
+
+        //! Time spent executing tasks.
+        Duration BusyTime;
+
+        //! Time spent spinning or parked while waiting for tasks.
+        Duration IdleTime;
+
+        //! Number of times thread was woken up after parking.
+        uint64_t Wakeups;
+
+        //! Number of tasks stolen from other workers.
+        uint64_t Steals;
+
+        //! Largest observed number of tasks in local queue.
+        uint64_t LocalQueueHighWater;
+    };
+
+    //! Always-on counters of single thread executing tasks.
+    //!
+    //! Counters are updated with relaxed atomics and may be read at any time; snapshot is not consistent
+    //! between fields. Counters are padded to own cache line, so updates of different workers don't interfere.
+    class alignas(ANEMONE_CACHELINE_SIZE) TaskWorkerCounters final
+    {
+    private:
+        std::atomic_uint64_t m_TasksExecuted{};
+        std::atomic_int64_t m_BusyTime{};
+        std::atomic_int64_t m_IdleTime{};
+        std::atomic_uint64_t m_Wakeups{};
+        std::atomic_uint64_t m_Steals{};
+        std::atomic_uint64_t m_LocalQueueHighWater{};
+
+        //! Number of tasks scheduled minus number of tasks completed by thread. Task is often scheduled and
+        //! completed by different threads, so only sum over all threads is meaningful. Not affected by reset.
+        std::atomic_int64_t m_TasksInFlight{};
+
+    public:
+        TaskWorkerCounters() = default;
+        TaskWorkerCounters(TaskWorkerCounters const&) = delete;
+        TaskWorkerCounters(TaskWorkerCounters&&) = delete;
+        TaskWorkerCounters& operator=(TaskWorkerCounters const&) = delete;
+        TaskWorkerCounters& operator=(TaskWorkerCounters&&) = delete;
+        ~TaskWorkerCounters() = default;
+
+    public:
+        void TaskExecuted()
+        {
+            this->m_TasksExecuted.fetch_add(1, std::memory_order::relaxed);
+        }
+
+        void TaskScheduled()
+        {
+            this->m_TasksInFlight.fetch_add(1, std::memory_order::relaxed);
+        }
+
+        void TaskCompleted()
+        {
+            this->m_TasksInFlight.fetch_sub(1, std::memory_order::relaxed);
+        }
+
+        int64_t GetTasksInFlight() const
+        {
+            return this->m_TasksInFlight.load(std::memory_order::relaxed);
+        }
+
+        void AddBusyTime(Duration value)
+        {
+            this->m_BusyTime.fetch_add(value.ToNanoseconds(), std::memory_order::relaxed);
+        }
+
+        void AddIdleTime(Duration value)
+        {
+            this->m_IdleTime.fetch_add(value.ToNanoseconds(), std::memory_order::relaxed);
+        }
+
+        void Wakeup()
+        {
+            this->m_Wakeups.fetch_add(1, std::memory_order::relaxed);
+        }
+
+        void Stolen()
+        {
+            this->m_Steals.fetch_add(1, std::memory_order::relaxed);
+        }
+
+        void UpdateLocalQueueDepth(size_t depth)
+        {
+            // Only owner pushes to local queue, so plain store is enough.
+            if (depth > this->m_LocalQueueHighWater.load(std::memory_order::relaxed))
+            {
+                this->m_LocalQueueHighWater.store(depth, std::memory_order::relaxed);
+            }
+        }
+
+        ANEMONE_RUNTIME_BASE_API TaskWorkerStatistics Snapshot() const;
+
+        ANEMONE_RUNTIME_BASE_API void Reset();
+    };
+}
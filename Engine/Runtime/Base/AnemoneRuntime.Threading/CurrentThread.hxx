@@ -14,5 +14,8 @@ namespace Anemone
         ANEMONE_RUNTIME_BASE_API static void Sleep(Duration const& timeout);
         ANEMONE_RUNTIME_BASE_API static void Pause();
         ANEMONE_RUNTIME_BASE_API static ThreadId Id();
+
+        //! Restricts current thread to run only on specified logical processor.
+        ANEMONE_RUNTIME_BASE_API static void SetAffinity(uint32_t processor);
     };
 }
@@ -1,5 +1,6 @@
 #include "AnemoneRuntime.Interop/Linux/Headers.hxx"
 #include "AnemoneRuntime.Interop/Linux/Process.hxx"
+#include "AnemoneRuntime.Interop/Linux/Threading.hxx"
 
 #if ANEMONE_PLATFORM_LINUX || ANEMONE_PLATFORM_ANDROID
 
@@ -65,6 +66,11 @@ namespace Anemone
     {
         return ThreadId{static_cast<uintptr_t>(Interop::Linux::GetThreadId())};
     }
+
+    void CurrentThread::SetAffinity(uint32_t processor)
+    {
+        Interop::Linux::SetCurrentThreadAffinity(processor);
+    }
 }
 
 #endif
@@ -6,6 +6,7 @@
 #include "AnemoneRuntime.Interop/Linux/Threading.hxx"
 #include "AnemoneRuntime.Interop/StringBuffer.hxx"
 #include "AnemoneRuntime.Base/Bitwise.hxx"
+#include "AnemoneRuntime.Profiler/Profiler.hxx"
 
 #include <cmath>
 #include <utility>
@@ -54,6 +55,10 @@ namespace Anemone
         {
             Interop::string_buffer<char, 64> name{*context.start->Name};
             pthread_setname_np(self->_handle.Get(), name.c_str());
+
+#if ANEMONE_BUILD_PROFILING
+            Profiler::SetThreadName(*context.start->Name);
+#endif
         }
 
         // Set thread priority
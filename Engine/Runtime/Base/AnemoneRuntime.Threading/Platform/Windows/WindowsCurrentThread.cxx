@@ -73,6 +73,11 @@ namespace Anemone
     {
         return ThreadId{GetCurrentThreadId()};
     }
+
+    void CurrentThread::SetAffinity(uint32_t processor)
+    {
+        Interop::Windows::SetCurrentThreadAffinity(processor);
+    }
 }
 
 #endif
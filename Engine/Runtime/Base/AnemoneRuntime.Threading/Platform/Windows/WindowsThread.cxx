@@ -2,6 +2,7 @@
 #include "AnemoneRuntime.Threading/Platform/Windows/WindowsThread.hxx"
 #include "AnemoneRuntime.Base/Instant.hxx"
 #include "AnemoneRuntime.Diagnostics/Trace.hxx"
+#include "AnemoneRuntime.Profiler/Profiler.hxx"
 #include "AnemoneRuntime.Interop/Windows/Text.hxx"
 #include "AnemoneRuntime.Interop/Windows/Environment.hxx"
 #include "AnemoneRuntime.Threading/SpinWait.hxx"
@@ -53,6 +54,13 @@ namespace Anemone
             WindowsThread* self = context.thread.load(std::memory_order::acquire);
             AE_ASSERT(self);
 
+#if ANEMONE_BUILD_PROFILING
+            if (context.start->Name)
+            {
+                Profiler::SetThreadName(*context.start->Name);
+            }
+#endif
+
             context.initialized.store(true, std::memory_order::release);
 
             self->_runnable->Run();
@@ -47,6 +47,11 @@ namespace Anemone
         {
             Callback _callback;
 
+            explicit Wrapper(Callback&& callback)
+                : _callback{std::move(callback)}
+            {
+            }
+
             void OnRun() override
             {
                 this->_callback();
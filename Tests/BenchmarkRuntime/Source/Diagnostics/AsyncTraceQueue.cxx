@@ -0,0 +1,153 @@
+#include "AnemoneRuntime.Diagnostics/FileTraceListener.hxx"
+#include "AnemoneRuntime.Diagnostics/TraceDispatcher.hxx"
+#include "AnemoneRuntime.Base/Instant.hxx"
+#include "AnemoneRuntime.Storage/FilePath.hxx"
+#include "AnemoneRuntime.Storage/FileSystem.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
+#include "AnemoneRuntime.Threading/Runnable.hxx"
+#include "AnemoneRuntime.Threading/Thread.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr size_t CallsPerThread = 10000;
+
+    // Runs trace calls on multiple threads at once. Collects latency of each call when requested.
+    void RunContended(Anemone::TraceDispatcher& dispatcher, size_t threadCount, std::vector<int64_t>* latencies)
+    {
+        using namespace Anemone;
+
+        std::vector<std::vector<int64_t>> samples(threadCount);
+        std::vector<Reference<Thread>> threads{};
+
+        for (size_t t = 0; t < threadCount; ++t)
+        {
+            std::vector<int64_t>* const local = (latencies != nullptr) ? &samples[t] : nullptr;
+
+            threads.push_back(Thread::Start(ThreadStart{
+                .Name = "TraceProducer",
+                .Callback = MakeRunnable([&dispatcher, local, t]
+                {
+                    if (local != nullptr)
+                    {
+                        local->reserve(CallsPerThread);
+                    }
+
+                    for (size_t i = 0; i < CallsPerThread; ++i)
+                    {
+                        Instant const started = Instant::Now();
+
+                        dispatcher.TraceInformation("worker {} processed item {} in {} us", t, i, i % 97);
+
+                        if (local != nullptr)
+                        {
+                            local->push_back(started.QueryElapsed().ToNanoseconds());
+                        }
+                    }
+                }),
+            }));
+        }
+
+        for (Reference<Thread> const& thread : threads)
+        {
+            thread->Join();
+        }
+
+        if (latencies != nullptr)
+        {
+            for (std::vector<int64_t> const& local : samples)
+            {
+                latencies->insert(latencies->end(), local.begin(), local.end());
+            }
+        }
+    }
+}
+
+TEST_CASE("Diagnostics / AsyncTraceQueue - Call Latency Under Contention", "[benchmark][diagnostics]")
+{
+    using namespace Anemone;
+
+    std::string path{Environment::GetTemporaryPath()};
+    FilePath::PushFragment(path, "Anemone.AsyncTrace.Benchmark.log");
+
+    {
+        auto handle = FileSystem::GetPlatformFileSystem().CreateFileWriter(path);
+        REQUIRE(handle);
+
+        FileTraceListener listener{MakeReference<FileOutputStream>(std::move(*handle))};
+
+        TraceDispatcher dispatcher{};
+        dispatcher.Register(listener);
+
+        struct Mode final
+        {
+            char const* Name;
+            std::optional<TraceOverflowPolicy> Policy;
+        };
+
+        constexpr Mode Modes[]{
+            {"synchronous", std::nullopt},
+            {"async / drop", TraceOverflowPolicy::Drop},
+            {"async / block", TraceOverflowPolicy::Block},
+            {"async / sample", TraceOverflowPolicy::Sample},
+        };
+
+        for (Mode const& mode : Modes)
+        {
+            if (mode.Policy)
+            {
+                dispatcher.EnableAsync(AsyncTraceOptions{.OverflowPolicy = *mode.Policy});
+            }
+
+            for (size_t const threads : {1uz, 4uz, 8uz})
+            {
+                BENCHMARK_ADVANCED(fmt::format("{} / threads = {} / calls = {}", mode.Name, threads, threads * CallsPerThread))(Catch::Benchmark::Chronometer meter)
+                {
+                    meter.measure([&]
+                    {
+                        RunContended(dispatcher, threads, nullptr);
+                    });
+
+                    // Sink must not carry backlog into next sample.
+                    dispatcher.Flush();
+                };
+
+                std::vector<int64_t> latencies{};
+                RunContended(dispatcher, threads, &latencies);
+                dispatcher.Flush();
+
+                std::ranges::sort(latencies);
+
+                AsyncTraceQueue const* const queue = dispatcher.GetAsyncQueue();
+
+                fmt::println(
+                    "{} / threads = {}: p50 = {} ns, p99 = {} ns, p99.9 = {} ns, max = {} ns, dropped = {}",
+                    mode.Name,
+                    threads,
+                    latencies[latencies.size() / 2],
+                    latencies[(latencies.size() * 99) / 100],
+                    latencies[(latencies.size() * 999) / 1000],
+                    latencies.back(),
+                    (queue != nullptr) ? queue->GetDroppedCount() : 0);
+            }
+
+            dispatcher.DisableAsync();
+        }
+
+        dispatcher.Unregister(listener);
+    }
+
+    REQUIRE(FileSystem::GetPlatformFileSystem().FileDelete(path));
+}
@@ -0,0 +1,145 @@
+#include "AnemoneRuntime.Diagnostics/BinaryTraceListener.hxx"
+#include "AnemoneRuntime.Diagnostics/TraceDispatcher.hxx"
+#include "AnemoneRuntime.Base/MemoryBuffer.hxx"
+#include "AnemoneRuntime.Storage/MemoryOutputStream.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <string_view>
+
+namespace
+{
+    // Accepts records without doing any work, so only cost of trace call is measured.
+    class NullTraceListener final : public Anemone::TraceListener
+    {
+    public:
+        void TraceEvent(Anemone::TraceLevel level, const char* message, size_t size) override
+        {
+            (void)level;
+            (void)message;
+            (void)size;
+        }
+
+        void TraceRecord(Anemone::TraceSite const& site, std::span<std::byte const> payload) override
+        {
+            (void)site;
+            (void)payload;
+        }
+    };
+
+    struct BenchmarkTraceSite final
+    {
+        static constexpr Anemone::TraceLevel Level() { return Anemone::TraceLevel::Information; }
+        static constexpr std::string_view Format() { return "worker {} processed '{}' in {:.3f} ms"; }
+        static constexpr std::string_view File() { return __FILE__; }
+        static constexpr uint32_t Line() { return __LINE__; }
+    };
+
+    void RunCalls(Anemone::TraceDispatcher& dispatcher, Catch::Benchmark::Chronometer& meter)
+    {
+        meter.measure([&](int i)
+        {
+            dispatcher.TraceInformation("worker {} processed '{}' in {:.3f} ms", i, std::string_view{"item"}, 1.25);
+        });
+    }
+
+    void RunDeferredCalls(Anemone::TraceDispatcher& dispatcher, Catch::Benchmark::Chronometer& meter)
+    {
+        meter.measure([&](int i)
+        {
+            dispatcher.TraceDeferred<BenchmarkTraceSite>(i, std::string_view{"item"}, 1.25);
+        });
+    }
+}
+
+TEST_CASE("Diagnostics / TraceRecord - Call Cost", "[benchmark][diagnostics]")
+{
+    using namespace Anemone;
+
+    SECTION("No listeners")
+    {
+        TraceDispatcher dispatcher{};
+
+        BENCHMARK_ADVANCED("formatted")(Catch::Benchmark::Chronometer meter)
+        {
+            RunCalls(dispatcher, meter);
+        };
+
+        BENCHMARK_ADVANCED("deferred")(Catch::Benchmark::Chronometer meter)
+        {
+            RunDeferredCalls(dispatcher, meter);
+        };
+    }
+
+    SECTION("Null listener")
+    {
+        NullTraceListener listener{};
+        TraceDispatcher dispatcher{};
+        dispatcher.Register(listener);
+
+        BENCHMARK_ADVANCED("formatted")(Catch::Benchmark::Chronometer meter)
+        {
+            RunCalls(dispatcher, meter);
+        };
+
+        BENCHMARK_ADVANCED("deferred")(Catch::Benchmark::Chronometer meter)
+        {
+            RunDeferredCalls(dispatcher, meter);
+        };
+
+        dispatcher.Unregister(listener);
+    }
+
+    SECTION("Binary listener")
+    {
+        auto buffer = MemoryBuffer::Create(0);
+        REQUIRE(buffer);
+
+        BinaryTraceListener listener{MakeReference<MemoryOutputStream>(*buffer)};
+        TraceDispatcher dispatcher{};
+        dispatcher.Register(listener);
+
+        BENCHMARK_ADVANCED("formatted")(Catch::Benchmark::Chronometer meter)
+        {
+            RunCalls(dispatcher, meter);
+        };
+
+        BENCHMARK_ADVANCED("deferred")(Catch::Benchmark::Chronometer meter)
+        {
+            RunDeferredCalls(dispatcher, meter);
+        };
+
+        fmt::println("binary log size: {} bytes", (*buffer)->GetSize());
+
+        dispatcher.Unregister(listener);
+    }
+
+    SECTION("Async null listener")
+    {
+        NullTraceListener listener{};
+        TraceDispatcher dispatcher{};
+        dispatcher.Register(listener);
+        dispatcher.EnableAsync(AsyncTraceOptions{});
+
+        BENCHMARK_ADVANCED("formatted")(Catch::Benchmark::Chronometer meter)
+        {
+            RunCalls(dispatcher, meter);
+            dispatcher.Flush();
+        };
+
+        BENCHMARK_ADVANCED("deferred")(Catch::Benchmark::Chronometer meter)
+        {
+            RunDeferredCalls(dispatcher, meter);
+            dispatcher.Flush();
+        };
+
+        dispatcher.DisableAsync();
+        dispatcher.Unregister(listener);
+    }
+}
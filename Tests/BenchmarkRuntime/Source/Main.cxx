@@ -0,0 +1,11 @@
+#include "AnemoneRuntime.EntryPoint/EntryPoint.hxx"
+
+#include <catch_amalgamated.hpp>
+
+void BenchmarkRuntime_ModuleInitialize() { }
+void BenchmarkRuntime_ModuleFinalize() { }
+
+int AnemoneMain(int argc, char* argv[])
+{
+    return Catch::Session().run(argc, argv);
+}
@@ -0,0 +1,162 @@
+#include "AnemoneRuntime.Base/Memory/ThreadCachingAllocator.hxx"
+#include "AnemoneRuntime.Base/Memory/SystemAllocator.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
+#include "AnemoneRuntime.System/ProcessorProperties.hxx"
+#include "AnemoneRuntime.Threading/Thread.hxx"
+#include "AnemoneRuntime.Threading/Runnable.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+    constexpr size_t Operations = 64 * 1024;
+    constexpr size_t LiveBlocks = 512;
+
+    // Typical engine allocation sizes: mostly small objects, occasionally bigger buffers.
+    constexpr std::array<size_t, 8> Sizes{16, 24, 32, 48, 64, 128, 256, 1024};
+
+    // Each thread keeps window of live blocks and replaces random one on every step. Remaining blocks are freed
+    // by calling thread after workers exit.
+    template <typename AllocateFn, typename DeallocateFn>
+    size_t RunWorkload(size_t threads, AllocateFn allocate, DeallocateFn deallocate)
+    {
+        using namespace Anemone;
+
+        std::vector<std::vector<void*>> windows(threads);
+        std::vector<Reference<Thread>> workers{};
+
+        auto run = [&](size_t thread)
+        {
+            std::vector<void*>& window = windows[thread];
+            window.assign(LiveBlocks, nullptr);
+
+            uint64_t random = 0x9E3779B97F4A7C15u * (thread + 1);
+
+            for (size_t i = 0; i < Operations; ++i)
+            {
+                random = (random * 6364136223846793005u) + 1442695040888963407u;
+
+                size_t const slot = (random >> 33u) % LiveBlocks;
+                size_t const size = Sizes[(random >> 17u) % Sizes.size()];
+
+                if (window[slot] != nullptr)
+                {
+                    deallocate(window[slot]);
+                }
+
+                window[slot] = allocate(size);
+                *static_cast<volatile char*>(window[slot]) = static_cast<char>(i);
+            }
+        };
+
+        for (size_t thread = 0; thread < threads; ++thread)
+        {
+            workers.push_back(Thread::Start(ThreadStart{
+                .Callback = MakeRunnable([&run, thread]
+                {
+                    run(thread);
+                }),
+            }));
+        }
+
+        for (Reference<Thread> const& worker : workers)
+        {
+            worker->Join();
+        }
+
+        size_t result = 0;
+
+        // For allocator with thread heaps all of these are remote frees.
+        for (std::vector<void*> const& window : windows)
+        {
+            for (void* block : window)
+            {
+                if (block != nullptr)
+                {
+                    deallocate(block);
+                    ++result;
+                }
+            }
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("Memory / ThreadCachingAllocator - Throughput", "[benchmark][memory]")
+{
+    using namespace Anemone;
+    using namespace Anemone::Memory;
+
+    size_t const threads = std::max<size_t>(2, ProcessorProperties::GetLogicalCoresCount());
+
+    SystemAllocator backing{};
+    ThreadCachingAllocator allocator{backing};
+
+    // Size is stored in front of block, as callers of Deallocate must pass it back.
+    auto allocateCaching = [&](size_t size) -> void*
+    {
+        Allocation const allocation = allocator.Allocate(Layout{.Size = size + 16, .Alignment = 16});
+        *static_cast<size_t*>(allocation.Address) = allocation.Size;
+        return static_cast<std::byte*>(allocation.Address) + 16;
+    };
+
+    auto deallocateCaching = [&](void* pointer)
+    {
+        void* const address = static_cast<std::byte*>(pointer) - 16;
+        allocator.Deallocate(Allocation{.Address = address, .Size = *static_cast<size_t*>(address)});
+    };
+
+    auto allocateSystem = [](size_t size) -> void*
+    {
+        return std::malloc(size);
+    };
+
+    auto deallocateSystem = [](void* pointer)
+    {
+        std::free(pointer);
+    };
+
+    size_t const baseline = Environment::GetMemoryUsage().UsedPhysical;
+
+    BENCHMARK(fmt::format("malloc / operations = {} / threads = {}", Operations, threads))
+    {
+        return RunWorkload(threads, allocateSystem, deallocateSystem);
+    };
+
+    size_t const afterSystem = Environment::GetMemoryUsage().UsedPhysical;
+
+    BENCHMARK(fmt::format("thread caching / operations = {} / threads = {}", Operations, threads))
+    {
+        return RunWorkload(threads, allocateCaching, deallocateCaching);
+    };
+
+    size_t const afterCaching = Environment::GetMemoryUsage().UsedPhysical;
+
+    ThreadCachingAllocatorStatistics const statistics = allocator.GetStatistics();
+
+    fmt::println(
+        "resident memory: baseline = {} KiB, after malloc = {} KiB, after thread caching = {} KiB",
+        baseline >> 10u,
+        afterSystem >> 10u,
+        afterCaching >> 10u);
+
+    fmt::println(
+        "thread caching: heaps = {}, spans = {} ({} cached), remote frees = {}, large = {}",
+        statistics.Heaps,
+        statistics.Spans,
+        statistics.CachedSpans,
+        statistics.RemoteDeallocations,
+        statistics.LargeAllocations);
+}
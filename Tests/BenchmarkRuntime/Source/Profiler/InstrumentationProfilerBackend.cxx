@@ -0,0 +1,87 @@
+#include "AnemoneRuntime.Profiler/InstrumentationProfilerBackend.hxx"
+
+#if ANEMONE_BUILD_PROFILING
+
+#include "AnemoneRuntime.Base/MemoryBuffer.hxx"
+#include "AnemoneRuntime.Storage/MemoryOutputStream.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <memory>
+#include <vector>
+
+TEST_CASE("Profiler / InstrumentationProfilerBackend - Scope Cost", "[benchmark][profiler]")
+{
+    using namespace Anemone;
+
+    ProfilerMarker marker{"BenchmarkScope"};
+
+    IProfilerBackend* const previous = Profiler::GetBackend();
+
+    // Budget large enough to keep whole benchmark run without dropping events.
+    InstrumentationProfilerOptions const options{
+        .MaxChunksPerThread = 1024,
+    };
+
+    // Fresh backend for each run, so thread buffer never fills up.
+    BENCHMARK_ADVANCED("scope")(Catch::Benchmark::Chronometer meter)
+    {
+        InstrumentationProfilerBackend backend{options};
+        Profiler::SetBackend(&backend);
+
+        meter.measure([&]
+        {
+            ProfilerScope scope{marker};
+        });
+
+        Profiler::SetBackend(previous);
+    };
+
+    BENCHMARK_ADVANCED("scope / no backend")(Catch::Benchmark::Chronometer meter)
+    {
+        Profiler::SetBackend(nullptr);
+
+        meter.measure([&]
+        {
+            ProfilerScope scope{marker};
+        });
+
+        Profiler::SetBackend(previous);
+    };
+
+    auto buffer = MemoryBuffer::Create(0);
+    REQUIRE(buffer);
+
+    BENCHMARK_ADVANCED("export / events = 200000")(Catch::Benchmark::Chronometer meter)
+    {
+        // Export drains recorded events; every run exports fresh backend.
+        std::vector<std::unique_ptr<InstrumentationProfilerBackend>> backends{};
+
+        for (int run = 0; run < meter.runs(); ++run)
+        {
+            auto& backend = backends.emplace_back(std::make_unique<InstrumentationProfilerBackend>(options));
+
+            for (size_t i = 0; i < 100000; ++i)
+            {
+                backend->BeginMarker(marker);
+                backend->EndMarker(marker);
+            }
+        }
+
+        meter.measure([&](int run)
+        {
+            MemoryOutputStream stream{*buffer};
+            return backends[static_cast<size_t>(run)]->WriteChromeTrace(stream).has_value();
+        });
+    };
+
+    fmt::println("chrome trace size: {} bytes", (*buffer)->GetSize());
+}
+
+#endif
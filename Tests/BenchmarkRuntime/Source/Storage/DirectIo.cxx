@@ -0,0 +1,160 @@
+#include "AnemoneRuntime.Storage/DirectIoBuffer.hxx"
+#include "AnemoneRuntime.Storage/FilePath.hxx"
+#include "AnemoneRuntime.Storage/FileSystem.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <string>
+
+#if ANEMONE_PLATFORM_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr size_t FileSize = size_t{256} << 20u;
+    constexpr size_t ChunkSize = size_t{4} << 20u;
+
+    void EvictFromPageCache(std::string const& path)
+    {
+#if ANEMONE_PLATFORM_LINUX
+        int const fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (fd >= 0)
+        {
+            fdatasync(fd);
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            close(fd);
+        }
+#else
+        (void)path;
+#endif
+    }
+
+    // Gets number of bytes of file resident in page cache.
+    size_t GetResidentSize(std::string const& path)
+    {
+        size_t result = 0;
+
+#if ANEMONE_PLATFORM_LINUX
+        int const fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (fd >= 0)
+        {
+            if (void* const address = mmap(nullptr, FileSize, PROT_READ, MAP_SHARED, fd, 0); address != MAP_FAILED)
+            {
+                size_t const pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+                std::vector<unsigned char> residency((FileSize + pageSize - 1) / pageSize);
+
+                if (mincore(address, FileSize, residency.data()) == 0)
+                {
+                    for (unsigned char const page : residency)
+                    {
+                        result += (page & 1u) * pageSize;
+                    }
+                }
+
+                munmap(address, FileSize);
+            }
+
+            close(fd);
+        }
+#else
+        (void)path;
+#endif
+
+        return result;
+    }
+
+    size_t Stream(std::string const& path, Anemone::Flags<Anemone::FileOption> options, Anemone::DirectIoBuffer const& buffer)
+    {
+        using namespace Anemone;
+
+        size_t result = 0;
+
+        if (auto reader = FileSystem::GetPlatformFileSystem().CreateFileReader(path, options))
+        {
+            while (true)
+            {
+                auto const processed = (*reader)->Read(buffer.GetView().first(ChunkSize));
+
+                if (not processed or (*processed == 0))
+                {
+                    break;
+                }
+
+                result += *processed;
+            }
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("Storage / FileSystem - Unbuffered Streaming", "[benchmark][storage]")
+{
+    using namespace Anemone;
+
+    FileSystem& fs = FileSystem::GetPlatformFileSystem();
+
+    std::string path{Environment::GetTemporaryPath()};
+    FilePath::PushFragment(path, "Anemone.DirectIo.Benchmark.bin");
+
+    DirectIoBuffer const buffer{ChunkSize};
+
+    {
+        auto writer = fs.CreateFileWriter(path, FileOption::NoBuffering);
+
+        if (not writer and (writer.error() == Error::NotSupported))
+        {
+            SKIP("Unbuffered I/O is not supported");
+        }
+
+        REQUIRE(writer);
+
+        for (size_t i = 0; i < (FileSize / ChunkSize); ++i)
+        {
+            std::ranges::fill(buffer.GetView(), static_cast<std::byte>(i));
+            REQUIRE((*writer)->Write(buffer.GetView().first(ChunkSize)) == ChunkSize);
+        }
+    }
+
+    for (bool const unbuffered : {false, true})
+    {
+        Flags<FileOption> const options = unbuffered ? FileOption::NoBuffering : FileOption::None;
+        char const* const mode = unbuffered ? "unbuffered" : "buffered";
+
+        BENCHMARK_ADVANCED(fmt::format("{} / cold / size = {} MiB", mode, FileSize >> 20u))(Catch::Benchmark::Chronometer meter)
+        {
+            EvictFromPageCache(path);
+
+            meter.measure([&]
+            {
+                return Stream(path, options, buffer);
+            });
+        };
+
+        // Page cache pollution left behind by single pass over file.
+        EvictFromPageCache(path);
+        REQUIRE(Stream(path, options, buffer) == FileSize);
+
+        size_t const resident = GetResidentSize(path);
+        fmt::println("{}: {} MiB of {} MiB left in page cache", mode, resident >> 20u, FileSize >> 20u);
+
+        if (unbuffered)
+        {
+            CHECK(resident < (FileSize / 8));
+        }
+    }
+
+    REQUIRE(fs.FileDelete(path));
+}
@@ -0,0 +1,125 @@
+#include "AnemoneRuntime.Storage/FilePath.hxx"
+#include "AnemoneRuntime.Storage/FileSystem.hxx"
+#include "AnemoneRuntime.Base/MemoryBuffer.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr size_t LargeFileSize = size_t{128} << 20u;
+    constexpr size_t SmallFileCount = 500;
+    constexpr size_t SmallFileSize = 8192;
+
+    std::string MakePath(std::string_view root, std::string_view name)
+    {
+        std::string result{root};
+        Anemone::FilePath::PushFragment(result, name);
+        return result;
+    }
+
+    void WriteFile(std::string_view path, size_t size, size_t seed)
+    {
+        using namespace Anemone;
+
+        auto content = MemoryBuffer::Create(size);
+        REQUIRE(content);
+        std::ranges::fill((*content)->GetView(), static_cast<std::byte>(seed));
+        REQUIRE(FileSystem::GetPlatformFileSystem().WriteBinaryFile(path, **content));
+    }
+
+    // Copies tree one file at a time with buffered copy of base implementation.
+    void CopySequentialBuffered(std::string_view source, std::string_view destination, std::vector<std::string> const& names)
+    {
+        using namespace Anemone;
+
+        FileSystem& fs = FileSystem::GetPlatformFileSystem();
+
+        (void)fs.DirectoryCreateRecursive(destination);
+
+        for (std::string const& name : names)
+        {
+            (void)fs.FileSystem::FileCopy(MakePath(source, name), MakePath(destination, name), NameCollisionResolve::Overwrite);
+        }
+    }
+}
+
+TEST_CASE("Storage / FileSystem - Copy", "[benchmark][storage]")
+{
+    using namespace Anemone;
+
+    FileSystem& fs = FileSystem::GetPlatformFileSystem();
+
+    std::string const root = MakePath(Environment::GetTemporaryPath(), "Anemone.FileCopy.Benchmark");
+
+    (void)fs.DirectoryDeleteRecursive(root);
+    REQUIRE(fs.DirectoryCreateRecursive(root));
+
+    SECTION("Large File")
+    {
+        std::string const source = MakePath(root, "Large.bin");
+        std::string const destination = MakePath(root, "Large.Copy.bin");
+
+        WriteFile(source, LargeFileSize, 0x5A);
+
+        BENCHMARK(fmt::format("buffered / size = {} MiB", LargeFileSize >> 20u))
+        {
+            return fs.FileSystem::FileCopy(source, destination, NameCollisionResolve::Overwrite).has_value();
+        };
+
+        BENCHMARK(fmt::format("platform / size = {} MiB", LargeFileSize >> 20u))
+        {
+            return fs.FileCopy(source, destination, NameCollisionResolve::Overwrite).has_value();
+        };
+    }
+
+    SECTION("Small Files")
+    {
+        std::string const source = MakePath(root, "Source");
+        std::string const destination = MakePath(root, "Destination");
+
+        std::vector<std::string> names{};
+
+        for (size_t i = 0; i < SmallFileCount; ++i)
+        {
+            std::string& name = names.emplace_back(fmt::format("{:02}", i % 16));
+            FilePath::PushFragment(name, fmt::format("{:04}.bin", i));
+        }
+
+        for (size_t i = 0; i < 16; ++i)
+        {
+            REQUIRE(fs.DirectoryCreateRecursive(MakePath(source, fmt::format("{:02}", i))));
+        }
+
+        for (size_t i = 0; i < SmallFileCount; ++i)
+        {
+            WriteFile(MakePath(source, names[i]), SmallFileSize, i);
+        }
+
+        for (size_t i = 0; i < 16; ++i)
+        {
+            REQUIRE(fs.DirectoryCreateRecursive(MakePath(destination, fmt::format("{:02}", i))));
+        }
+
+        BENCHMARK(fmt::format("sequential buffered / files = {}", SmallFileCount))
+        {
+            CopySequentialBuffered(source, destination, names);
+        };
+
+        BENCHMARK(fmt::format("parallel platform / files = {}", SmallFileCount))
+        {
+            return fs.DirectoryCopyRecursive(source, destination, NameCollisionResolve::Overwrite).has_value();
+        };
+    }
+
+    REQUIRE(fs.DirectoryDeleteRecursive(root));
+}
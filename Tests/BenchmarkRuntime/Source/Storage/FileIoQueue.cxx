@@ -0,0 +1,176 @@
+#include "AnemoneRuntime.Storage/FileIoQueue.hxx"
+#include "AnemoneRuntime.Storage/FilePath.hxx"
+#include "AnemoneRuntime.Storage/FileSystem.hxx"
+#include "AnemoneRuntime.Base/MemoryBuffer.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
+#include "AnemoneRuntime.Tasks/DefaultTaskScheduler.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <string>
+#include <vector>
+
+#if ANEMONE_PLATFORM_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr size_t FileCount = 1000;
+
+    // Typical sizes of small assets: shaders, materials, metadata.
+    constexpr size_t FileSizes[]{1024, 4096, 6000, 16384};
+
+    void EvictFromPageCache(std::vector<std::string> const& paths)
+    {
+#if ANEMONE_PLATFORM_LINUX
+        for (std::string const& path : paths)
+        {
+            int const fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+            if (fd >= 0)
+            {
+                posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+                close(fd);
+            }
+        }
+#else
+        (void)paths;
+#endif
+    }
+
+    size_t LoadSynchronous(std::vector<std::string> const& paths)
+    {
+        using namespace Anemone;
+
+        size_t result = 0;
+
+        for (std::string const& path : paths)
+        {
+            if (auto const buffer = FileSystem::GetPlatformFileSystem().ReadBinaryFile(path))
+            {
+                result += (*buffer)->GetView().size();
+            }
+        }
+
+        return result;
+    }
+
+    size_t LoadAsynchronous(Anemone::TaskScheduler& scheduler, Anemone::FileIoQueue& queue, std::vector<std::string> const& paths)
+    {
+        using namespace Anemone;
+
+        std::vector<std::vector<std::byte>> buffers(paths.size());
+        std::vector<FileIoRequest> requests{};
+        requests.reserve(paths.size());
+
+        for (size_t i = 0; i < paths.size(); ++i)
+        {
+            if (auto reader = FileSystem::GetPlatformFileSystem().CreateFileReader(paths[i]))
+            {
+                buffers[i].resize((*reader)->GetLength().value_or(0));
+
+                requests.push_back(FileIoRequest{
+                    .Operation = FileIoOperation::Read,
+                    .File = std::move(*reader),
+                    .Buffer = buffers[i],
+                });
+            }
+        }
+
+        scheduler.Wait(queue.Submit(requests));
+
+        size_t result = 0;
+
+        for (std::vector<std::byte> const& buffer : buffers)
+        {
+            result += buffer.size();
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("Storage / FileIoQueue - Small Files", "[benchmark][storage]")
+{
+    using namespace Anemone;
+
+    std::string directory{Environment::GetTemporaryPath()};
+    FilePath::PushFragment(directory, "Anemone.FileIoQueue.Benchmark");
+
+    REQUIRE((FileSystem::GetPlatformFileSystem().DirectoryExists(directory) or FileSystem::GetPlatformFileSystem().DirectoryCreate(directory)));
+
+    std::vector<std::string> paths{};
+    size_t totalSize = 0;
+
+    for (size_t i = 0; i < FileCount; ++i)
+    {
+        std::string& path = paths.emplace_back(directory);
+        FilePath::PushFragment(path, fmt::format("{:04}.bin", i));
+
+        size_t const size = FileSizes[i % std::size(FileSizes)];
+        totalSize += size;
+
+        auto content = MemoryBuffer::Create(size);
+        REQUIRE(content);
+        std::ranges::fill((*content)->GetView(), static_cast<std::byte>(i));
+        REQUIRE(FileSystem::GetPlatformFileSystem().WriteBinaryFile(path, **content));
+    }
+
+    DefaultTaskScheduler scheduler{};
+
+    std::unique_ptr<FileIoQueue> const native = FileIoQueue::Create(scheduler, FileIoQueueOptions{.QueueDepth = 64});
+    std::unique_ptr<FileIoQueue> const pool = FileIoQueue::CreateThreadPool(scheduler, FileIoQueueOptions{.QueueDepth = 64, .ThreadCount = 8});
+
+    for (bool const cold : {false, true})
+    {
+        char const* const cache = cold ? "cold" : "warm";
+
+        BENCHMARK_ADVANCED(fmt::format("synchronous / {} / files = {}", cache, FileCount))(Catch::Benchmark::Chronometer meter)
+        {
+            if (cold)
+            {
+                EvictFromPageCache(paths);
+            }
+
+            meter.measure([&]
+            {
+                return LoadSynchronous(paths);
+            });
+        };
+
+        for (FileIoQueue* const queue : {native.get(), pool.get()})
+        {
+            BENCHMARK_ADVANCED(fmt::format("{} / {} / files = {}", queue->GetBackendName(), cache, FileCount))(Catch::Benchmark::Chronometer meter)
+            {
+                if (cold)
+                {
+                    EvictFromPageCache(paths);
+                }
+
+                meter.measure([&]
+                {
+                    return LoadAsynchronous(scheduler, *queue, paths);
+                });
+            };
+
+            REQUIRE(LoadAsynchronous(scheduler, *queue, paths) == totalSize);
+        }
+    }
+
+    REQUIRE(LoadSynchronous(paths) == totalSize);
+
+    for (std::string const& path : paths)
+    {
+        REQUIRE(FileSystem::GetPlatformFileSystem().FileDelete(path));
+    }
+
+    REQUIRE(FileSystem::GetPlatformFileSystem().DirectoryDelete(directory));
+}
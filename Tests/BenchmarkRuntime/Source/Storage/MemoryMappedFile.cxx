@@ -0,0 +1,156 @@
+#include "AnemoneRuntime.Storage/MemoryMappedFile.hxx"
+#include "AnemoneRuntime.Storage/FilePath.hxx"
+#include "AnemoneRuntime.Storage/FileSystem.hxx"
+#include "AnemoneRuntime.Base/MemoryBuffer.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <cstring>
+#include <string>
+
+#if ANEMONE_PLATFORM_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr size_t FileSize = size_t{64} << 20u;
+
+    // Drops file pages from page cache, so next access reads from storage.
+    void EvictFromPageCache(std::string const& path)
+    {
+#if ANEMONE_PLATFORM_LINUX
+        int const fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (fd >= 0)
+        {
+            fdatasync(fd);
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            close(fd);
+        }
+#else
+        (void)path;
+#endif
+    }
+
+    uint64_t Checksum(std::span<std::byte const> data)
+    {
+        uint64_t result = 0;
+
+        for (size_t i = 0; (i + sizeof(uint64_t)) <= data.size(); i += sizeof(uint64_t))
+        {
+            uint64_t value;
+            std::memcpy(&value, data.data() + i, sizeof(value));
+            result += value;
+        }
+
+        return result;
+    }
+
+    uint64_t ReadCopied(std::string const& path)
+    {
+        using namespace Anemone;
+
+        auto const buffer = FileSystem::GetPlatformFileSystem().ReadBinaryFile(path);
+        return buffer ? Checksum((*buffer)->GetView()) : 0;
+    }
+
+    uint64_t ReadMapped(std::string const& path, Anemone::Flags<Anemone::MemoryMappedFileViewOption> options)
+    {
+        using namespace Anemone;
+
+        Reference<MemoryMappedFile> const file = MemoryMappedFile::Create(path, FileMode::Open, 0, MemoryMappedFileAccess::Read);
+
+        if (not file)
+        {
+            return 0;
+        }
+
+        Reference<MemoryMappedFileView> const view = file->CreateView(MemoryMappedFileAccess::Read, 0, 0, options);
+        return view ? Checksum(std::as_const(*view).GetData()) : 0;
+    }
+}
+
+TEST_CASE("Storage / MemoryMappedFile - Throughput", "[benchmark][storage]")
+{
+    using namespace Anemone;
+
+    std::string path{Environment::GetTemporaryPath()};
+    FilePath::PushFragment(path, "Anemone.MemoryMappedFile.Benchmark.bin");
+
+    {
+        Reference<MemoryMappedFile> const file = MemoryMappedFile::Create(path, FileMode::Create, FileSize, MemoryMappedFileAccess::ReadWrite);
+        REQUIRE(file);
+
+        Reference<MemoryMappedFileView> const view = file->CreateView(MemoryMappedFileAccess::ReadWrite);
+        REQUIRE(view);
+
+        std::span<std::byte> const data = view->GetData();
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<std::byte>(i * 131u);
+        }
+    }
+
+    struct Variant final
+    {
+        char const* Name;
+        Flags<MemoryMappedFileViewOption> Options;
+    };
+
+    Variant const variants[]{
+        {"mapped", MemoryMappedFileViewOption::None},
+        {"mapped / populate", MemoryMappedFileViewOption::Populate},
+        {"mapped / sequential + will need", Flags{MemoryMappedFileViewOption::SequentialAccess} | MemoryMappedFileViewOption::WillNeed},
+        {"mapped / huge pages", MemoryMappedFileViewOption::HugePages},
+    };
+
+    uint64_t const expected = ReadCopied(path);
+
+    for (bool const cold : {false, true})
+    {
+        char const* const cache = cold ? "cold" : "warm";
+
+        BENCHMARK_ADVANCED(fmt::format("read copied / {} / {} MiB", cache, FileSize >> 20u))(Catch::Benchmark::Chronometer meter)
+        {
+            if (cold)
+            {
+                EvictFromPageCache(path);
+            }
+
+            meter.measure([&]
+            {
+                return ReadCopied(path);
+            });
+        };
+
+        for (Variant const& variant : variants)
+        {
+            BENCHMARK_ADVANCED(fmt::format("{} / {} / {} MiB", variant.Name, cache, FileSize >> 20u))(Catch::Benchmark::Chronometer meter)
+            {
+                if (cold)
+                {
+                    EvictFromPageCache(path);
+                }
+
+                meter.measure([&]
+                {
+                    return ReadMapped(path, variant.Options);
+                });
+            };
+
+            REQUIRE(ReadMapped(path, variant.Options) == expected);
+        }
+    }
+
+    REQUIRE(FileSystem::GetPlatformFileSystem().FileDelete(path));
+}
@@ -0,0 +1,189 @@
+#include "AnemoneRuntime.Storage/PackageFileSystem.hxx"
+#include "AnemoneRuntime.Storage/PackageWriter.hxx"
+#include "AnemoneRuntime.Storage/FilePath.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr size_t FileCount = 2000;
+    constexpr size_t DirectoryCount = 40;
+    constexpr size_t FileSize = 4096;
+
+    class CountingVisitor final : public Anemone::FileSystemVisitor
+    {
+    public:
+        size_t Count{};
+
+        void Visit(std::string_view path, std::string_view name, Anemone::FileInfo const& info) override
+        {
+            (void)path;
+            (void)name;
+            (void)info;
+            ++this->Count;
+        }
+    };
+
+    size_t OpenAndRead(Anemone::FileSystem& fileSystem, std::vector<std::string> const& paths, std::vector<std::byte>& buffer)
+    {
+        size_t result = 0;
+
+        for (std::string const& path : paths)
+        {
+            if (auto handle = fileSystem.CreateFileReader(path))
+            {
+                result += (*handle)->ReadAt(buffer, 0).value_or(0);
+            }
+        }
+
+        return result;
+    }
+
+    size_t OpenOnly(Anemone::FileSystem& fileSystem, std::vector<std::string> const& paths)
+    {
+        size_t result = 0;
+
+        for (std::string const& path : paths)
+        {
+            if (auto handle = fileSystem.CreateFileReader(path))
+            {
+                ++result;
+            }
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("Storage / Package - Open", "[benchmark][storage]")
+{
+    using namespace Anemone;
+
+    FileSystem& platform = FileSystem::GetPlatformFileSystem();
+
+    std::string root{Environment::GetTemporaryPath()};
+    FilePath::PushFragment(root, "Anemone.Package.Benchmark");
+
+    (void)platform.DirectoryDeleteRecursive(root);
+
+    std::string loose = root;
+    FilePath::PushFragment(loose, "Loose");
+
+    std::string packagePath = root;
+    FilePath::PushFragment(packagePath, "Content.apak");
+
+    std::string mountPoint = root;
+    FilePath::PushFragment(mountPoint, "Mounted");
+
+    // Same tree as loose files and as package.
+    std::vector<std::string> relatives{};
+    std::vector<std::byte> content(FileSize);
+
+    {
+        PackageWriter writer{};
+
+        for (size_t i = 0; i < FileCount; ++i)
+        {
+            std::string& relative = relatives.emplace_back(fmt::format("Directory{:02}/Asset{:04}.bin", i % DirectoryCount, i));
+
+            std::string path = loose;
+            FilePath::PushFragment(path, relative);
+
+            if (i < DirectoryCount)
+            {
+                std::string directory = path;
+                FilePath::PopFragment(directory);
+                REQUIRE(platform.DirectoryCreateRecursive(directory));
+            }
+
+            std::ranges::fill(content, static_cast<std::byte>(i));
+
+            auto buffer = MemoryBuffer::Create(content);
+            REQUIRE(buffer);
+            REQUIRE(platform.WriteBinaryFile(path, **buffer));
+
+            REQUIRE(writer.AddFile(relative, content));
+        }
+
+        REQUIRE(writer.Save(platform, packagePath));
+    }
+
+    auto makePaths = [&](std::string_view base)
+    {
+        std::vector<std::string> result{};
+
+        for (std::string const& relative : relatives)
+        {
+            std::string& path = result.emplace_back(base);
+            FilePath::PushFragment(path, relative);
+        }
+
+        return result;
+    };
+
+    std::vector<std::string> const loosePaths = makePaths(loose);
+    std::vector<std::string> const packagePaths = makePaths(mountPoint);
+
+    auto mounted = PackageFileSystem::Mount(packagePath, mountPoint, &platform);
+    REQUIRE(mounted);
+
+    PackageFileSystem& package = **mounted;
+
+    std::vector<std::byte> buffer(FileSize);
+
+    REQUIRE(OpenAndRead(platform, loosePaths, buffer) == (FileCount * FileSize));
+    REQUIRE(OpenAndRead(package, packagePaths, buffer) == (FileCount * FileSize));
+
+    BENCHMARK(fmt::format("mount / entries = {}", package.GetEntryCount()))
+    {
+        return PackageFileSystem::Mount(packagePath, mountPoint, &platform).has_value();
+    };
+
+    BENCHMARK(fmt::format("loose / open / files = {}", FileCount))
+    {
+        return OpenOnly(platform, loosePaths);
+    };
+
+    BENCHMARK(fmt::format("package / open / files = {}", FileCount))
+    {
+        return OpenOnly(package, packagePaths);
+    };
+
+    BENCHMARK(fmt::format("loose / open and read / files = {}", FileCount))
+    {
+        return OpenAndRead(platform, loosePaths, buffer);
+    };
+
+    BENCHMARK(fmt::format("package / open and read / files = {}", FileCount))
+    {
+        return OpenAndRead(package, packagePaths, buffer);
+    };
+
+    BENCHMARK(fmt::format("loose / enumerate recursive / files = {}", FileCount))
+    {
+        CountingVisitor visitor{};
+        (void)platform.DirectoryEnumerateRecursive(loose, visitor);
+        return visitor.Count;
+    };
+
+    BENCHMARK(fmt::format("package / enumerate recursive / files = {}", FileCount))
+    {
+        CountingVisitor visitor{};
+        (void)package.DirectoryEnumerateRecursive(mountPoint, visitor);
+        return visitor.Count;
+    };
+
+    mounted->reset();
+
+    REQUIRE(platform.DirectoryDeleteRecursive(root));
+}
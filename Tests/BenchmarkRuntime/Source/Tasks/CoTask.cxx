@@ -0,0 +1,153 @@
+#include "AnemoneRuntime.Tasks/CoTask.hxx"
+#include "AnemoneRuntime.Tasks/DefaultTaskScheduler.hxx"
+#include "AnemoneRuntime.System/ProcessorProperties.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    // Continuation implemented as task: each step schedules next one and waits for it.
+    class StepTask final : public Anemone::Task
+    {
+    private:
+        uint64_t& m_Value;
+
+    public:
+        explicit StepTask(uint64_t& value)
+            : m_Value{value}
+        {
+        }
+
+    protected:
+        void OnExecute() override
+        {
+            this->m_Value = (this->m_Value * 6364136223846793005u) + 1442695040888963407u;
+        }
+    };
+
+    uint64_t RunTaskChain(Anemone::TaskScheduler& scheduler, size_t steps)
+    {
+        using namespace Anemone;
+
+        uint64_t value{};
+
+        for (size_t i = 0; i < steps; ++i)
+        {
+            TaskAwaiterHandle const none = MakeReference<TaskAwaiter>();
+            TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+
+            TaskHandle const task = MakeReference<StepTask>(value);
+            scheduler.Schedule(*task, join, none, TaskPriority::Normal);
+            scheduler.Wait(join);
+        }
+
+        return value;
+    }
+
+    Anemone::CoTask<uint64_t> Step(uint64_t value)
+    {
+        co_return (value * 6364136223846793005u) + 1442695040888963407u;
+    }
+
+    Anemone::CoTask<uint64_t> CoroutineChain(size_t steps)
+    {
+        uint64_t value{};
+
+        for (size_t i = 0; i < steps; ++i)
+        {
+            value = co_await Step(value);
+        }
+
+        co_return value;
+    }
+
+    Anemone::CoTask<uint64_t> YieldingChain(size_t steps)
+    {
+        uint64_t value{};
+
+        for (size_t i = 0; i < steps; ++i)
+        {
+            co_await Anemone::CoYield();
+            value = (value * 6364136223846793005u) + 1442695040888963407u;
+        }
+
+        co_return value;
+    }
+}
+
+TEST_CASE("Tasks / CoTask - Continuation Chain", "[benchmark][tasks]")
+{
+    using namespace Anemone;
+
+    constexpr size_t steps = 1024;
+
+    size_t const cores = std::max<size_t>(1, ProcessorProperties::GetLogicalCoresCount());
+
+    DefaultTaskScheduler scheduler{cores - 1};
+
+    BENCHMARK(fmt::format("task + wait / steps = {}", steps))
+    {
+        return RunTaskChain(scheduler, steps);
+    };
+
+    BENCHMARK(fmt::format("co_await CoTask / steps = {}", steps))
+    {
+        CoTask<uint64_t> task = CoroutineChain(steps);
+        scheduler.Wait(task.Start(scheduler));
+        return task.GetResult();
+    };
+
+    BENCHMARK(fmt::format("co_await CoYield / steps = {}", steps))
+    {
+        CoTask<uint64_t> task = YieldingChain(steps);
+        scheduler.Wait(task.Start(scheduler));
+        return task.GetResult();
+    };
+}
+
+TEST_CASE("Tasks / CoTask - In Flight", "[benchmark][tasks]")
+{
+    using namespace Anemone;
+
+    constexpr size_t steps = 16;
+
+    size_t const cores = std::max<size_t>(1, ProcessorProperties::GetLogicalCoresCount());
+
+    DefaultTaskScheduler scheduler{cores - 1};
+
+    for (size_t count : {1'000uz, 10'000uz})
+    {
+        BENCHMARK(fmt::format("coroutines = {} / yields = {} / threads = {}", count, steps, cores))
+        {
+            std::vector<CoTask<uint64_t>> tasks{};
+            std::vector<TaskAwaiterHandle> awaiters{};
+            tasks.reserve(count);
+            awaiters.reserve(count);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                tasks.push_back(YieldingChain(steps));
+                awaiters.push_back(tasks.back().Start(scheduler));
+            }
+
+            uint64_t result{};
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                scheduler.Wait(awaiters[i]);
+                result += tasks[i].GetResult();
+            }
+
+            return result;
+        };
+    }
+}
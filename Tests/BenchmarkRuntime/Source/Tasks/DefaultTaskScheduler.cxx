@@ -0,0 +1,372 @@
+#include "AnemoneRuntime.Tasks/DefaultTaskScheduler.hxx"
+#include "AnemoneRuntime.Tasks/Task.hxx"
+#include "AnemoneRuntime.Tasks/TaskAwaiter.hxx"
+#include "AnemoneRuntime.System/ProcessorProperties.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
+#include "AnemoneRuntime.Threading/CurrentThread.hxx"
+#include "AnemoneRuntime.Base/Instant.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    // Binary fork/join tree; leaves perform small amount of work to keep tasks fine-grained.
+    class ForkJoinTask final : public Anemone::Task
+    {
+    private:
+        Anemone::TaskScheduler& m_Scheduler;
+        std::atomic_uint64_t& m_Checksum;
+        uint32_t m_Depth;
+
+    public:
+        ForkJoinTask(Anemone::TaskScheduler& scheduler, std::atomic_uint64_t& checksum, uint32_t depth)
+            : m_Scheduler{scheduler}
+            , m_Checksum{checksum}
+            , m_Depth{depth}
+        {
+        }
+
+    protected:
+        void OnExecute() override
+        {
+            using namespace Anemone;
+
+            if (this->m_Depth == 0)
+            {
+                uint64_t value = this->GetId();
+
+                for (size_t i = 0; i < 256; ++i)
+                {
+                    value = (value * 6364136223846793005u) + 1442695040888963407u;
+                }
+
+                this->m_Checksum.fetch_add(value, std::memory_order::relaxed);
+                return;
+            }
+
+            TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+            TaskAwaiterHandle const fork = MakeReference<TaskAwaiter>();
+
+            for (size_t i = 0; i < 2; ++i)
+            {
+                TaskHandle const child = MakeReference<ForkJoinTask>(this->m_Scheduler, this->m_Checksum, this->m_Depth - 1);
+                this->m_Scheduler.Schedule(*child, join, fork, TaskPriority::Normal);
+            }
+
+            this->m_Scheduler.Wait(join);
+        }
+    };
+
+    uint64_t RunForkJoin(Anemone::TaskScheduler& scheduler, uint32_t depth)
+    {
+        using namespace Anemone;
+
+        std::atomic_uint64_t checksum{};
+
+        TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+        TaskAwaiterHandle const fork = MakeReference<TaskAwaiter>();
+
+        TaskHandle const root = MakeReference<ForkJoinTask>(scheduler, checksum, depth);
+        scheduler.Schedule(*root, join, fork, TaskPriority::Normal);
+        scheduler.Wait(join);
+
+        return checksum.load(std::memory_order::relaxed);
+    }
+
+    // Spins for a while to keep scheduler busy with low priority work.
+    class BusyTask final : public Anemone::Task
+    {
+    private:
+        std::atomic_uint64_t& m_Checksum;
+
+    public:
+        explicit BusyTask(std::atomic_uint64_t& checksum)
+            : m_Checksum{checksum}
+        {
+        }
+
+    protected:
+        void OnExecute() override
+        {
+            uint64_t value = this->GetId();
+
+            for (size_t i = 0; i < 4096; ++i)
+            {
+                value = (value * 6364136223846793005u) + 1442695040888963407u;
+            }
+
+            this->m_Checksum.fetch_add(value, std::memory_order::relaxed);
+        }
+    };
+
+    // Records time when execution started.
+    class TimestampTask final : public Anemone::Task
+    {
+    private:
+        Anemone::Instant& m_Started;
+
+    public:
+        explicit TimestampTask(Anemone::Instant& started)
+            : m_Started{started}
+        {
+        }
+
+    protected:
+        void OnExecute() override
+        {
+            this->m_Started = Anemone::Instant::Now();
+        }
+    };
+
+    // Runs wide DAG: every layer waits for all tasks of previous one, so each layer is released at once.
+    uint64_t RunWideDag(Anemone::TaskScheduler& scheduler, size_t layers, size_t width)
+    {
+        using namespace Anemone;
+
+        std::atomic_uint64_t checksum{};
+
+        TaskAwaiterHandle dependency = MakeReference<TaskAwaiter>();
+
+        for (size_t layer = 0; layer < layers; ++layer)
+        {
+            TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+
+            for (size_t i = 0; i < width; ++i)
+            {
+                TaskHandle const task = MakeReference<ForkJoinTask>(scheduler, checksum, 0);
+                scheduler.Schedule(*task, join, dependency, TaskPriority::Normal);
+            }
+
+            dependency = join;
+        }
+
+        scheduler.Wait(dependency);
+
+        return checksum.load(std::memory_order::relaxed);
+    }
+
+    // Schedules single task from outside of scheduler and spins until worker executes it.
+    Anemone::Duration MeasureWakeToRun(Anemone::TaskScheduler& scheduler)
+    {
+        using namespace Anemone;
+
+        Instant started{};
+
+        TaskAwaiterHandle const none = MakeReference<TaskAwaiter>();
+        TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+
+        TaskHandle const task = MakeReference<TimestampTask>(started);
+
+        Instant const scheduled = Instant::Now();
+        scheduler.Schedule(*task, join, none, TaskPriority::Normal);
+
+        // Don't help with execution; we want to measure how long it takes to wake up a worker.
+        while (not join->IsCompleted())
+        {
+        }
+
+        return started - scheduled;
+    }
+
+    // Thread counts to measure: powers of two up to number of logical cores, plus all cores.
+    std::vector<size_t> GetScalingSteps()
+    {
+        size_t const cores = std::max<size_t>(1, Anemone::ProcessorProperties::GetLogicalCoresCount());
+
+        std::vector<size_t> result{};
+
+        for (size_t threads = 1; threads < cores; threads *= 2)
+        {
+            result.push_back(threads);
+        }
+
+        result.push_back(cores);
+        return result;
+    }
+}
+
+TEST_CASE("Tasks / DefaultTaskScheduler - Fork Join Scaling", "[benchmark][tasks]")
+{
+    using namespace Anemone;
+
+    // 2^13 - 1 tasks per iteration.
+    constexpr uint32_t depth = 12;
+
+    for (size_t threads : GetScalingSteps())
+    {
+        // Calling thread contributes while waiting.
+        DefaultTaskScheduler scheduler{threads - 1};
+
+        BENCHMARK(fmt::format("fork-join / depth = {} / threads = {}", depth, threads))
+        {
+            return RunForkJoin(scheduler, depth);
+        };
+
+        DefaultTaskSchedulerStatistics const statistics = scheduler.GetStatistics();
+
+        uint64_t steals = statistics.External.Steals;
+        Duration busy = statistics.External.BusyTime;
+        Duration idle{};
+
+        for (TaskWorkerStatistics const& worker : statistics.Workers)
+        {
+            steals += worker.Steals;
+            busy += worker.BusyTime;
+            idle += worker.IdleTime;
+        }
+
+        fmt::println(
+            "threads = {}: steals = {}, busy = {} ms, idle = {} ms, normal queue high-water = {}",
+            threads,
+            steals,
+            busy.ToMilliseconds(),
+            idle.ToMilliseconds(),
+            statistics.QueueHighWater[static_cast<size_t>(TaskPriority::Normal)]);
+    }
+}
+
+TEST_CASE("Tasks / DefaultTaskScheduler - Wide DAG", "[benchmark][tasks]")
+{
+    using namespace Anemone;
+
+    constexpr size_t layers = 8;
+
+    size_t const cores = std::max<size_t>(1, ProcessorProperties::GetLogicalCoresCount());
+
+    DefaultTaskScheduler scheduler{cores - 1};
+
+    for (size_t width : {64uz, 1024uz, 8192uz})
+    {
+        BENCHMARK(fmt::format("wide dag / layers = {} / width = {} / threads = {}", layers, width, cores))
+        {
+            return RunWideDag(scheduler, layers, width);
+        };
+    }
+
+    TaskLatencySnapshot const histogram = scheduler.GetDependencyLatencyHistogram();
+
+    fmt::println(
+        "dependency release: samples = {}, p50 <= {} us, p99 <= {} us",
+        histogram.GetCount(),
+        histogram.GetPercentile(0.50).ToMicroseconds(),
+        histogram.GetPercentile(0.99).ToMicroseconds());
+}
+
+TEST_CASE("Tasks / DefaultTaskScheduler - Critical Latency Under Background Load", "[benchmark][tasks]")
+{
+    using namespace Anemone;
+
+    constexpr size_t flood = 1024;
+
+    size_t const cores = std::max<size_t>(1, ProcessorProperties::GetLogicalCoresCount());
+
+    DefaultTaskScheduler scheduler{cores - 1};
+
+    std::atomic_uint64_t checksum{};
+
+    BENCHMARK(fmt::format("critical latency / background = {} / threads = {}", flood, cores))
+    {
+        TaskAwaiterHandle const none = MakeReference<TaskAwaiter>();
+        TaskAwaiterHandle const background = MakeReference<TaskAwaiter>();
+        TaskAwaiterHandle const critical = MakeReference<TaskAwaiter>();
+
+        for (size_t i = 0; i < flood; ++i)
+        {
+            TaskHandle const task = MakeReference<BusyTask>(checksum);
+            scheduler.Schedule(*task, background, none, TaskPriority::Background);
+        }
+
+        TaskHandle const task = MakeReference<BusyTask>(checksum);
+        scheduler.Schedule(*task, critical, none, TaskPriority::Critical);
+
+        scheduler.Wait(critical);
+        scheduler.Wait(background);
+
+        return checksum.load(std::memory_order::relaxed);
+    };
+
+    for (TaskPriority priority : {TaskPriority::Critical, TaskPriority::Background})
+    {
+        TaskLatencySnapshot const histogram = scheduler.GetLatencyHistogram(priority);
+
+        fmt::println(
+            "priority {}: samples = {}, p50 <= {} us, p99 <= {} us",
+            static_cast<uint32_t>(priority),
+            histogram.GetCount(),
+            histogram.GetPercentile(0.50).ToMicroseconds(),
+            histogram.GetPercentile(0.99).ToMicroseconds());
+    }
+}
+
+TEST_CASE("Tasks / DefaultTaskScheduler - Idle And Wakeup", "[benchmark][tasks]")
+{
+    using namespace Anemone;
+
+    // At least one worker is required to measure wakeups.
+    size_t const workers = std::max<size_t>(1, ProcessorProperties::GetLogicalCoresCount() - 1);
+
+    DefaultTaskScheduler scheduler{workers};
+
+    //
+    // Idle CPU burn: all workers should be parked, so process should not consume CPU time.
+    //
+    {
+        CurrentThread::Sleep(Duration::FromMilliseconds(50));
+
+        ProcessorUsage const before = Environment::GetProcessorUsage();
+        Instant const started = Instant::Now();
+
+        CurrentThread::Sleep(Duration::FromMilliseconds(250));
+
+        Duration const wall = started.QueryElapsed();
+        ProcessorUsage const after = Environment::GetProcessorUsage();
+
+        Duration const cpu = (after.UserTime - before.UserTime) + (after.KernelTime - before.KernelTime);
+
+        fmt::println(
+            "idle: workers = {}, cpu = {} us, wall = {} us, utilization = {:.2f}%",
+            workers,
+            cpu.ToMicroseconds(),
+            wall.ToMicroseconds(),
+            100.0 * static_cast<double>(cpu.ToMicroseconds()) / static_cast<double>(wall.ToMicroseconds()));
+    }
+
+    //
+    // Wake-to-run latency of parked worker.
+    //
+    {
+        TaskLatencyHistogram histogram{};
+
+        for (size_t i = 0; i < 64; ++i)
+        {
+            // Give workers time to finish spinning and park.
+            CurrentThread::Sleep(Duration::FromMilliseconds(2));
+
+            histogram.Record(MeasureWakeToRun(scheduler));
+        }
+
+        fmt::println(
+            "wake parked: samples = {}, p50 <= {} us, p99 <= {} us",
+            histogram.GetCount(),
+            histogram.GetPercentile(0.50).ToMicroseconds(),
+            histogram.GetPercentile(0.99).ToMicroseconds());
+    }
+
+    //
+    // Wake-to-run latency of back-to-back tasks; workers are usually still spinning.
+    //
+
+    BENCHMARK(fmt::format("wake-to-run / workers = {}", workers))
+    {
+        return MeasureWakeToRun(scheduler).ToMicroseconds();
+    };
+}
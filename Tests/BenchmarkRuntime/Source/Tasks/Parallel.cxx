@@ -0,0 +1,310 @@
+#include "AnemoneRuntime.Tasks/Parallel.hxx"
+#include "AnemoneRuntime.Tasks/TaskScheduler.hxx"
+#include "AnemoneRuntime.Tasks/Task.hxx"
+#include "AnemoneRuntime.Tasks/TaskAwaiter.hxx"
+#include "AnemoneRuntime.Tasks/DefaultTaskScheduler.hxx"
+#include "AnemoneRuntime.System/ProcessorProperties.hxx"
+#include "AnemoneRuntime.Base/Instant.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    // Previous Parallel::For implementation: fixed fan-out of at most 32 tasks, all claiming batches from single shared counter.
+    void SharedCounterFor(size_t count, size_t batch, Anemone::FunctionRef<void(size_t index, size_t count)> callback)
+    {
+        using namespace Anemone;
+
+        TaskScheduler& scheduler = TaskScheduler::Get();
+
+        struct Partitioner final
+        {
+            FunctionRef<void(size_t index, size_t count)> Callback;
+            size_t Count;
+            size_t Batch;
+            std::atomic_size_t CurrentIndex{};
+
+            void Execute()
+            {
+                while (true)
+                {
+                    size_t const first = this->CurrentIndex.fetch_add(this->Batch, std::memory_order::relaxed);
+
+                    if (first >= this->Count)
+                    {
+                        break;
+                    }
+
+                    this->Callback(first, std::min(this->Batch, this->Count - first));
+                }
+            }
+        };
+
+        class PartitionerTask final : public Task
+        {
+        private:
+            Partitioner& m_Partitioner;
+
+        public:
+            explicit PartitionerTask(Partitioner& partitioner)
+                : m_Partitioner{partitioner}
+            {
+            }
+
+        protected:
+            void OnExecute() override
+            {
+                this->m_Partitioner.Execute();
+            }
+        };
+
+        Partitioner partitioner{callback, count, batch};
+
+        size_t const workers = std::min<size_t>({std::max<size_t>(1, scheduler.GetThreadsCount()), (count / batch) + 1, 32});
+
+        TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+        TaskAwaiterHandle const fork = MakeReference<TaskAwaiter>();
+
+        for (size_t i = 0; i < workers; ++i)
+        {
+            TaskHandle const task = MakeReference<PartitionerTask>(partitioner);
+            scheduler.Schedule(*task, join, fork, TaskPriority::Normal);
+        }
+
+        partitioner.Execute();
+        scheduler.Wait(join);
+    }
+
+    uint64_t Work(size_t index, size_t iterations)
+    {
+        uint64_t value = index;
+
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            value = (value * 6364136223846793005u) + 1442695040888963407u;
+        }
+
+        return value;
+    }
+
+    // Uniform: every item costs the same.
+    size_t UniformCost(size_t)
+    {
+        return 64;
+    }
+
+    // Skewed: cost grows quadratically towards end of range.
+    size_t SkewedCost(size_t index)
+    {
+        size_t const bucket = (index * 64) / 65536;
+        return 1 + ((bucket * bucket) / 8);
+    }
+}
+
+TEST_CASE("Tasks / Parallel - For", "[benchmark][tasks]")
+{
+    using namespace Anemone;
+
+    constexpr size_t count = 65536;
+    constexpr size_t batch = 16;
+
+    struct Workload final
+    {
+        char const* Name;
+        size_t (*Cost)(size_t index);
+    };
+
+    for (Workload const& workload : {Workload{"uniform", UniformCost}, Workload{"skewed", SkewedCost}})
+    {
+        auto body = [&](std::atomic_uint64_t& checksum)
+        {
+            return [&, cost = workload.Cost](size_t index, size_t n)
+            {
+                uint64_t partial = 0;
+
+                for (size_t i = index; i < (index + n); ++i)
+                {
+                    partial += Work(i, cost(i));
+                }
+
+                checksum.fetch_add(partial, std::memory_order::relaxed);
+            };
+        };
+
+        BENCHMARK(fmt::format("shared counter / {} / count = {}", workload.Name, count))
+        {
+            std::atomic_uint64_t checksum{};
+            SharedCounterFor(count, batch, body(checksum));
+            return checksum.load();
+        };
+
+        BENCHMARK(fmt::format("lazy splitting / {} / count = {}", workload.Name, count))
+        {
+            std::atomic_uint64_t checksum{};
+            Parallel::For(count, batch, body(checksum));
+            return checksum.load();
+        };
+    }
+}
+
+TEST_CASE("Tasks / Parallel - Nested For", "[benchmark][tasks]")
+{
+    using namespace Anemone;
+
+    constexpr size_t outer = 64;
+    constexpr size_t inner = 4096;
+
+    BENCHMARK(fmt::format("nested / outer = {} / inner = {}", outer, inner))
+    {
+        std::atomic_uint64_t checksum{};
+
+        Parallel::For(outer, 1, [&](size_t first, size_t n)
+        {
+            for (size_t i = first; i < (first + n); ++i)
+            {
+                Parallel::For(inner, 16, [&](size_t index, size_t m)
+                {
+                    uint64_t partial = 0;
+
+                    for (size_t j = index; j < (index + m); ++j)
+                    {
+                        partial += Work(i * inner + j, 16);
+                    }
+
+                    checksum.fetch_add(partial, std::memory_order::relaxed);
+                });
+            }
+        });
+
+        return checksum.load();
+    };
+}
+
+TEST_CASE("Tasks / Parallel - Reduce And Scan", "[benchmark][tasks]")
+{
+    using namespace Anemone;
+
+    constexpr size_t count = 1 << 20;
+
+    std::vector<uint64_t> input(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        input[i] = Work(i, 1) & 0xFFFF;
+    }
+
+    std::vector<uint64_t> output(count);
+
+    BENCHMARK(fmt::format("reduce / count = {}", count))
+    {
+        return Parallel::Reduce(count, 256, uint64_t{}, [&](size_t index, size_t n)
+        {
+            uint64_t partial = 0;
+
+            for (size_t i = index; i < (index + n); ++i)
+            {
+                partial += input[i];
+            }
+
+            return partial;
+        },
+            [](uint64_t left, uint64_t right)
+        {
+            return left + right;
+        });
+    };
+
+    BENCHMARK(fmt::format("scan / count = {}", count))
+    {
+        Parallel::Scan<uint64_t>(input, output, 0, [](uint64_t left, uint64_t right)
+        {
+            return left + right;
+        });
+
+        return output.back();
+    };
+}
+
+TEST_CASE("Tasks / Parallel - Memory Bandwidth", "[benchmark][tasks]")
+{
+    using namespace Anemone;
+
+    // Large enough to not fit in last level cache.
+    constexpr size_t count = size_t{256} << 20u >> 3u;
+    constexpr size_t bytes = count * sizeof(uint64_t);
+
+    size_t const cores = std::max<size_t>(1, ProcessorProperties::GetLogicalCoresCount());
+
+    fmt::println(
+        "topology: logical = {}, physical = {}, cache domains = {}, numa nodes = {}",
+        ProcessorProperties::GetLogicalCoresCount(),
+        ProcessorProperties::GetPhysicalCoresCount(),
+        ProcessorProperties::GetCacheDomainsCount(),
+        ProcessorProperties::GetNumaNodesCount());
+
+    for (TaskWorkerPlacement placement : {TaskWorkerPlacement::Unpinned, TaskWorkerPlacement::Topology})
+    {
+        char const* const name = (placement == TaskWorkerPlacement::Topology) ? "topology" : "unpinned";
+
+        DefaultTaskScheduler scheduler{cores - 1, placement};
+
+        // Uninitialized; pages are first touched by workers, so they are allocated on NUMA nodes of these workers.
+        std::unique_ptr<uint64_t[]> const buffer{new uint64_t[count]};
+
+        Parallel::For(scheduler, count, 4096, [&](size_t index, size_t n)
+        {
+            std::fill_n(buffer.get() + index, n, index);
+        }, [](size_t)
+        {
+        });
+
+        auto sum = [&]
+        {
+            std::atomic_uint64_t total{};
+
+            Parallel::For(scheduler, count, 4096, [&](size_t index, size_t n)
+            {
+                uint64_t partial = 0;
+
+                for (size_t i = index; i < (index + n); ++i)
+                {
+                    partial += buffer[i];
+                }
+
+                total.fetch_add(partial, std::memory_order::relaxed);
+            }, [](size_t)
+            {
+            });
+
+            return total.load(std::memory_order::relaxed);
+        };
+
+        BENCHMARK(fmt::format("read / {} / size = {} MiB / threads = {}", name, bytes >> 20u, cores))
+        {
+            return sum();
+        };
+
+        Instant const started = Instant::Now();
+        constexpr size_t passes = 8;
+
+        for (size_t i = 0; i < passes; ++i)
+        {
+            sum();
+        }
+
+        double const seconds = static_cast<double>(started.QueryElapsed().ToNanoseconds()) * 1e-9;
+
+        fmt::println("{}: {:.2f} GiB/s", name, static_cast<double>(bytes * passes) / seconds / static_cast<double>(size_t{1} << 30u));
+    }
+}
@@ -0,0 +1,96 @@
+#include "AnemoneRuntime.Tasks/TaskAllocator.hxx"
+#include "AnemoneRuntime.Tasks/DefaultTaskScheduler.hxx"
+#include "AnemoneRuntime.Tasks/Task.hxx"
+#include "AnemoneRuntime.Tasks/TaskAwaiter.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <array>
+#include <new>
+
+namespace
+{
+    constexpr size_t BlockCount = 1024;
+
+    template <typename AllocateT, typename DeallocateT>
+    size_t AllocateAndRelease(size_t size, AllocateT&& allocate, DeallocateT&& deallocate)
+    {
+        std::array<void*, BlockCount> blocks;
+
+        for (void*& block : blocks)
+        {
+            block = allocate(size);
+        }
+
+        size_t checksum = 0;
+
+        for (void* block : blocks)
+        {
+            checksum += reinterpret_cast<uintptr_t>(block);
+            deallocate(block, size);
+        }
+
+        return checksum;
+    }
+}
+
+TEST_CASE("Tasks / TaskAllocator - Throughput", "[benchmark][tasks]")
+{
+    using namespace Anemone;
+
+    for (size_t size : {64uz, 192uz, 512uz})
+    {
+        BENCHMARK(fmt::format("task allocator / size = {} / count = {}", size, BlockCount))
+        {
+            return AllocateAndRelease(size, TaskAllocator::Allocate, TaskAllocator::Deallocate);
+        };
+
+        BENCHMARK(fmt::format("global heap / size = {} / count = {}", size, BlockCount))
+        {
+            return AllocateAndRelease(
+                size,
+                [](size_t n)
+            {
+                return ::operator new(n, std::align_val_t{TaskAllocator::Granularity});
+            },
+                [](void* p, size_t)
+            {
+                ::operator delete(p, std::align_val_t{TaskAllocator::Granularity});
+            });
+        };
+    }
+}
+
+TEST_CASE("Tasks / TaskAllocator - Scheduler Statistics", "[benchmark][tasks]")
+{
+    using namespace Anemone;
+
+    DefaultTaskScheduler scheduler{0};
+
+    DefaultTaskSchedulerStatistics const before = scheduler.GetStatistics();
+
+    TaskAwaiterHandle const none = MakeReference<TaskAwaiter>();
+    TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        TaskHandle const task = MakeReference<Task>();
+        scheduler.Schedule(*task, join, none, TaskPriority::Normal);
+    }
+
+    scheduler.Wait(join);
+
+    DefaultTaskSchedulerStatistics const after = scheduler.GetStatistics();
+
+    fmt::println(
+        "10000 tasks: allocations = {}, heap allocations = {}, transfers = {}",
+        after.Allocator.Allocations - before.Allocator.Allocations,
+        after.Allocator.HeapAllocations - before.Allocator.HeapAllocations,
+        after.Allocator.Transfers - before.Allocator.Transfers);
+}
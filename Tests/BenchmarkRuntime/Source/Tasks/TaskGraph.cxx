@@ -0,0 +1,145 @@
+#include "AnemoneRuntime.Tasks/TaskGraph.hxx"
+#include "AnemoneRuntime.Tasks/DefaultTaskScheduler.hxx"
+#include "AnemoneRuntime.Tasks/Task.hxx"
+#include "AnemoneRuntime.Tasks/TaskAwaiter.hxx"
+#include "AnemoneRuntime.System/ProcessorProperties.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace
+{
+    // Shape of synthetic frame: layers of jobs, every job depends on two jobs of previous layer.
+    constexpr size_t Layers = 8;
+    constexpr size_t Width = 32;
+
+    uint64_t SimulateJob(uint64_t seed)
+    {
+        uint64_t value = seed;
+
+        for (size_t i = 0; i < 256; ++i)
+        {
+            value = (value * 6364136223846793005u) + 1442695040888963407u;
+        }
+
+        return value;
+    }
+
+    class JobTask final : public Anemone::Task
+    {
+    private:
+        std::atomic_uint64_t& m_Checksum;
+
+    public:
+        explicit JobTask(std::atomic_uint64_t& checksum)
+            : m_Checksum{checksum}
+        {
+        }
+
+    protected:
+        void OnExecute() override
+        {
+            this->m_Checksum.fetch_add(SimulateJob(this->GetId()), std::memory_order::relaxed);
+        }
+    };
+
+    // Rebuilds frame every time through Schedule calls; layers are joined through awaiters.
+    uint64_t RunRebuilt(Anemone::TaskScheduler& scheduler)
+    {
+        using namespace Anemone;
+
+        std::atomic_uint64_t checksum{};
+
+        TaskAwaiterHandle dependency = MakeReference<TaskAwaiter>();
+
+        for (size_t layer = 0; layer < Layers; ++layer)
+        {
+            TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+
+            for (size_t i = 0; i < Width; ++i)
+            {
+                TaskHandle const task = MakeReference<JobTask>(checksum);
+                scheduler.Schedule(*task, join, dependency, TaskPriority::Normal);
+            }
+
+            dependency = join;
+        }
+
+        scheduler.Wait(dependency);
+
+        return checksum.load(std::memory_order::relaxed);
+    }
+}
+
+TEST_CASE("Tasks / TaskGraph - Frame", "[benchmark][tasks]")
+{
+    using namespace Anemone;
+
+    size_t const cores = std::max<size_t>(1, ProcessorProperties::GetLogicalCoresCount());
+
+    DefaultTaskScheduler scheduler{cores - 1};
+
+    std::atomic_uint64_t checksum{};
+
+    TaskGraph graph{};
+
+    {
+        std::vector<TaskGraphNode> previous{};
+
+        for (size_t layer = 0; layer < Layers; ++layer)
+        {
+            std::vector<TaskGraphNode> current{};
+
+            for (size_t i = 0; i < Width; ++i)
+            {
+                TaskGraphNode const node = graph.AddNode(fmt::format("job {}.{}", layer, i), [&checksum, seed = (layer * Width) + i]
+                {
+                    checksum.fetch_add(SimulateJob(seed), std::memory_order::relaxed);
+                });
+
+                if (not previous.empty())
+                {
+                    graph.AddEdge(previous[i], node);
+                    graph.AddEdge(previous[(i + 1) % Width], node);
+                }
+
+                current.push_back(node);
+            }
+
+            previous = std::move(current);
+        }
+
+        graph.Compile();
+    }
+
+    BENCHMARK(fmt::format("rebuilt / jobs = {} / threads = {}", Layers * Width, cores))
+    {
+        return RunRebuilt(scheduler);
+    };
+
+    BENCHMARK(fmt::format("task graph / jobs = {} / threads = {}", Layers * Width, cores))
+    {
+        graph.Run(scheduler);
+        return checksum.load(std::memory_order::relaxed);
+    };
+
+    graph.ReportCriticalPath();
+
+    TaskGraphCriticalPath const path = graph.GetCriticalPath();
+
+    fmt::println(
+        "critical path: nodes = {}, length = {} us, work = {} us, elapsed = {} us",
+        path.Nodes.size(),
+        path.Length.ToMicroseconds(),
+        path.Work.ToMicroseconds(),
+        path.Elapsed.ToMicroseconds());
+}
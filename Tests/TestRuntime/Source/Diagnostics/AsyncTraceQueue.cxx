@@ -0,0 +1,311 @@
+#include "AnemoneRuntime.Diagnostics/TraceDispatcher.hxx"
+#include "AnemoneRuntime.Threading/CriticalSection.hxx"
+#include "AnemoneRuntime.Threading/CurrentThread.hxx"
+#include "AnemoneRuntime.Threading/Lock.hxx"
+#include "AnemoneRuntime.Threading/ManualResetEvent.hxx"
+#include "AnemoneRuntime.Threading/Runnable.hxx"
+#include "AnemoneRuntime.Threading/Thread.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    class CapturingTraceListener final : public Anemone::TraceListener
+    {
+    private:
+        Anemone::CriticalSection m_Lock{};
+        std::vector<std::string> m_Messages{};
+
+    public:
+        Anemone::ThreadId LastThread{};
+        std::atomic_size_t Flushes{};
+        std::atomic_size_t Unterminated{};
+
+        //! When set, first record blocks sink thread until gate is opened.
+        Anemone::ManualResetEvent* Gate{};
+
+    public:
+        void TraceEvent(Anemone::TraceLevel level, const char* message, size_t size) override
+        {
+            (void)level;
+
+            // Records are passed with null terminator.
+            if (message[size] != '\0')
+            {
+                ++this->Unterminated;
+            }
+
+            if (this->Gate != nullptr)
+            {
+                this->Gate->Wait();
+            }
+
+            Anemone::UniqueLock scope{this->m_Lock};
+            this->m_Messages.emplace_back(message, size);
+            this->LastThread = Anemone::CurrentThread::Id();
+        }
+
+        void Flush() override
+        {
+            ++this->Flushes;
+        }
+
+        std::vector<std::string> GetMessages()
+        {
+            Anemone::UniqueLock scope{this->m_Lock};
+            return this->m_Messages;
+        }
+
+        //! Number of records starting with given prefix.
+        size_t CountRecords(std::string_view prefix)
+        {
+            Anemone::UniqueLock scope{this->m_Lock};
+
+            return static_cast<size_t>(std::count_if(this->m_Messages.begin(), this->m_Messages.end(), [&](std::string const& message)
+            {
+                return message.starts_with(prefix);
+            }));
+        }
+    };
+}
+
+TEST_CASE("Diagnostics / AsyncTraceQueue - Ordering")
+{
+    using namespace Anemone;
+
+    constexpr size_t ThreadCount = 4;
+    constexpr size_t MessageCount = 2000;
+
+    CapturingTraceListener listener{};
+    TraceDispatcher dispatcher{};
+    dispatcher.Register(listener);
+
+    dispatcher.EnableAsync(AsyncTraceOptions{
+        .RingCapacity = 16u << 10u,
+        .OverflowPolicy = TraceOverflowPolicy::Block,
+    });
+
+    REQUIRE(dispatcher.GetAsyncQueue() != nullptr);
+
+    std::vector<Reference<Thread>> threads{};
+
+    for (size_t t = 0; t < ThreadCount; ++t)
+    {
+        threads.push_back(Thread::Start(ThreadStart{
+            .Name = "TraceProducer",
+            .Callback = MakeRunnable([&dispatcher, t]
+            {
+                for (size_t i = 0; i < MessageCount; ++i)
+                {
+                    dispatcher.TraceInformation("thread {} message {}", t, i);
+                }
+            }),
+        }));
+    }
+
+    for (Reference<Thread> const& thread : threads)
+    {
+        thread->Join();
+    }
+
+    dispatcher.Flush();
+
+    CHECK(dispatcher.GetAsyncQueue()->GetDroppedCount() == 0);
+    CHECK(listener.Flushes.load() != 0);
+    CHECK(listener.Unterminated.load() == 0);
+
+    std::vector<std::string> const messages = listener.GetMessages();
+    REQUIRE(messages.size() == ThreadCount * MessageCount);
+
+    // Records of each thread are delivered in order.
+    std::vector<size_t> expected(ThreadCount);
+
+    for (std::string const& message : messages)
+    {
+        size_t thread{};
+        size_t index{};
+        REQUIRE(std::sscanf(message.c_str(), "[I] thread %zu message %zu", &thread, &index) == 2);
+        REQUIRE(thread < ThreadCount);
+        REQUIRE(index == expected[thread]);
+        ++expected[thread];
+    }
+
+    dispatcher.DisableAsync();
+    dispatcher.Unregister(listener);
+}
+
+TEST_CASE("Diagnostics / AsyncTraceQueue - Overflow")
+{
+    using namespace Anemone;
+
+    constexpr size_t MessageCount = 400;
+
+    ManualResetEvent gate{false};
+
+    CapturingTraceListener listener{};
+    listener.Gate = &gate;
+
+    TraceDispatcher dispatcher{};
+    dispatcher.Register(listener);
+
+    SECTION("Drop")
+    {
+        dispatcher.EnableAsync(AsyncTraceOptions{
+            .RingCapacity = 4u << 10u,
+            .OverflowPolicy = TraceOverflowPolicy::Drop,
+        });
+
+        // Sink is stalled by listener, so ring fills up.
+        for (size_t i = 0; i < MessageCount; ++i)
+        {
+            dispatcher.TraceVerbose("message {:>48}", i);
+        }
+
+        uint64_t const dropped = dispatcher.GetAsyncQueue()->GetDroppedCount();
+        CHECK(dropped != 0);
+
+        gate.Set();
+        dispatcher.Flush();
+
+        CHECK((listener.CountRecords("[V] message") + dropped) == MessageCount);
+        CHECK(listener.CountRecords("[W] trace: dropped") != 0);
+    }
+
+    SECTION("Block")
+    {
+        dispatcher.EnableAsync(AsyncTraceOptions{
+            .RingCapacity = 4u << 10u,
+            .OverflowPolicy = TraceOverflowPolicy::Block,
+        });
+
+        std::atomic_bool finished{};
+
+        Reference<Thread> const producer = Thread::Start(ThreadStart{
+            .Name = "TraceProducer",
+            .Callback = MakeRunnable([&]
+            {
+                for (size_t i = 0; i < MessageCount; ++i)
+                {
+                    dispatcher.TraceVerbose("message {:>48}", i);
+                }
+
+                finished = true;
+            }),
+        });
+
+        // Producer waits for space while sink is stalled.
+        CurrentThread::Sleep(Duration::FromMilliseconds(50));
+        CHECK_FALSE(finished.load());
+
+        gate.Set();
+        producer->Join();
+        dispatcher.Flush();
+
+        CHECK(dispatcher.GetAsyncQueue()->GetDroppedCount() == 0);
+        CHECK(listener.CountRecords("[V] message") == MessageCount);
+    }
+
+    SECTION("Sample")
+    {
+        dispatcher.EnableAsync(AsyncTraceOptions{
+            .RingCapacity = 4u << 10u,
+            .OverflowPolicy = TraceOverflowPolicy::Sample,
+            .SampleRate = 4,
+        });
+
+        for (size_t i = 0; i < (MessageCount / 8); ++i)
+        {
+            dispatcher.TraceVerbose("message {:>48}", i);
+        }
+
+        uint64_t const dropped = dispatcher.GetAsyncQueue()->GetDroppedCount();
+        CHECK(dropped != 0);
+
+        // Warnings are not sampled, so it still fits into space left above high watermark.
+        dispatcher.TraceWarning("important");
+        CHECK(dispatcher.GetAsyncQueue()->GetDroppedCount() == dropped);
+
+        gate.Set();
+        dispatcher.Flush();
+
+        CHECK((listener.CountRecords("[V] message") + dropped) == (MessageCount / 8));
+        CHECK(listener.CountRecords("[W] important") == 1);
+    }
+
+    gate.Set();
+    dispatcher.DisableAsync();
+    dispatcher.Unregister(listener);
+}
+
+TEST_CASE("Diagnostics / AsyncTraceQueue - Flush barrier")
+{
+    using namespace Anemone;
+
+    CapturingTraceListener listener{};
+    TraceDispatcher dispatcher{};
+    dispatcher.Register(listener);
+
+    // Sink would not pick records up on its own during test.
+    dispatcher.EnableAsync(AsyncTraceOptions{
+        .DrainInterval = Duration::FromSeconds(60),
+    });
+
+    SECTION("Flush")
+    {
+        for (size_t i = 0; i < 10; ++i)
+        {
+            dispatcher.TraceInformation("message {}", i);
+        }
+
+        dispatcher.Flush();
+
+        std::vector<std::string> const messages = listener.GetMessages();
+        REQUIRE(messages.size() == 10);
+        CHECK(messages.back() == "[I] message 9");
+        CHECK(listener.Flushes.load() == 1);
+
+        // Flush runs on calling thread.
+        CHECK(listener.LastThread == CurrentThread::Id());
+    }
+
+    SECTION("Fatal")
+    {
+        dispatcher.TraceInformation("before");
+        dispatcher.TraceFatal("crash");
+
+        // Fatal records are delivered synchronously, after records traced before them.
+        std::vector<std::string> const messages = listener.GetMessages();
+        REQUIRE(messages.size() == 2);
+        CHECK(messages[0] == "[I] before");
+        CHECK(messages[1] == "[F] crash");
+    }
+
+    SECTION("Disable")
+    {
+        dispatcher.TraceInformation("pending");
+        dispatcher.DisableAsync();
+
+        CHECK(dispatcher.GetAsyncQueue() == nullptr);
+        CHECK(listener.CountRecords("[I] pending") == 1);
+
+        // Delivered synchronously again.
+        dispatcher.TraceInformation("synchronous");
+        CHECK(listener.CountRecords("[I] synchronous") == 1);
+    }
+
+    dispatcher.DisableAsync();
+    dispatcher.Unregister(listener);
+}
@@ -0,0 +1,204 @@
+#include "AnemoneRuntime.Diagnostics/Trace.hxx"
+#include "AnemoneRuntime.Threading/CriticalSection.hxx"
+#include "AnemoneRuntime.Threading/Lock.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <string>
+#include <vector>
+
+AE_DECLARE_TRACE_CATEGORY(Testing, Debug)
+AE_DEFINE_TRACE_CATEGORY(Testing, Information)
+
+AE_DECLARE_TRACE_CATEGORY(Disabled, None)
+AE_DEFINE_TRACE_CATEGORY(Disabled, Verbose)
+
+namespace
+{
+    class CapturingTraceListener final : public Anemone::TraceListener
+    {
+    private:
+        Anemone::CriticalSection m_Lock{};
+        std::vector<std::string> m_Messages{};
+
+    public:
+        void TraceEvent(Anemone::TraceLevel level, const char* message, size_t size) override
+        {
+            (void)level;
+
+            Anemone::UniqueLock scope{this->m_Lock};
+            this->m_Messages.emplace_back(message, size);
+        }
+
+        std::vector<std::string> GetMessages()
+        {
+            Anemone::UniqueLock scope{this->m_Lock};
+            return this->m_Messages;
+        }
+    };
+
+    int Evaluate(int& evaluations, int value)
+    {
+        ++evaluations;
+        return value;
+    }
+}
+
+TEST_CASE("Diagnostics / TraceCategory - Filtering")
+{
+    using namespace Anemone;
+
+    CapturingTraceListener listener{};
+    Trace::Get().Register(listener);
+
+    TraceCategories::Testing.SetLevel(TraceLevel::Information);
+
+    int evaluations = 0;
+
+    SECTION("Runtime level")
+    {
+        // Levels below TraceLevel::Default are removed from build; shipping and profiling builds keep only Error
+        // and Fatal.
+        constexpr bool information = TraceLevel::Default <= TraceLevel::Information;
+
+        AE_TRACE_CATEGORY(Testing, Debug, "hidden {}", Evaluate(evaluations, 1));
+        AE_TRACE_CATEGORY(Testing, Information, "shown {}", Evaluate(evaluations, 2));
+
+        // Arguments of rejected messages are not evaluated.
+        CHECK(evaluations == (information ? 1 : 0));
+
+        TraceCategories::Testing.SetLevel(TraceLevel::Warning);
+        AE_TRACE_CATEGORY(Testing, Information, "hidden {}", Evaluate(evaluations, 3));
+        AE_TRACE_CATEGORY(Testing, Error, "shown {}", Evaluate(evaluations, 4));
+
+        TraceCategories::Testing.SetLevel(TraceLevel::Fatal);
+        AE_TRACE_CATEGORY(Testing, Error, "hidden {}", Evaluate(evaluations, 5));
+        AE_TRACE_CATEGORY(Testing, Fatal, "shown {}", Evaluate(evaluations, 6));
+
+        TraceCategories::Testing.SetLevel(TraceLevel::None);
+        AE_TRACE_CATEGORY(Testing, Fatal, "hidden {}", Evaluate(evaluations, 7));
+
+        std::vector<std::string> const messages = listener.GetMessages();
+
+        if constexpr (information)
+        {
+            CHECK(evaluations == 3);
+            REQUIRE(messages.size() == 3);
+            CHECK(messages[0] == "[I] Testing: shown 2");
+            CHECK(messages[1] == "[E] Testing: shown 4");
+            CHECK(messages[2] == "[F] Testing: shown 6");
+        }
+        else
+        {
+            CHECK(evaluations == 2);
+            REQUIRE(messages.size() == 2);
+            CHECK(messages[0] == "[E] Testing: shown 4");
+            CHECK(messages[1] == "[F] Testing: shown 6");
+        }
+    }
+
+    SECTION("Build-time floor")
+    {
+        TraceCategories::Testing.SetLevel(TraceLevel::Verbose);
+        TraceCategories::Disabled.SetLevel(TraceLevel::Verbose);
+
+        // Removed from build regardless of runtime level.
+        AE_TRACE_CATEGORY(Testing, Verbose, "removed {}", Evaluate(evaluations, 1));
+        AE_TRACE_CATEGORY(Disabled, Fatal, "removed {}", Evaluate(evaluations, 2));
+
+        CHECK(evaluations == 0);
+        CHECK(listener.GetMessages().empty());
+
+        STATIC_CHECK(TraceCategories::TestingFloor == TraceLevel::Debug);
+        STATIC_CHECK(TraceCategories::DisabledFloor == TraceLevel::None);
+
+        // Level at floor is kept, unless it is below TraceLevel::Default.
+        AE_TRACE_CATEGORY(Testing, Debug, "kept {}", Evaluate(evaluations, 3));
+
+        std::vector<std::string> const messages = listener.GetMessages();
+
+        if constexpr (TraceLevel::Default <= TraceLevel::Debug)
+        {
+            CHECK(evaluations == 1);
+            REQUIRE(messages.size() == 1);
+            CHECK(messages[0] == "[D] Testing: kept 3");
+        }
+        else
+        {
+            CHECK(evaluations == 0);
+            CHECK(messages.empty());
+        }
+    }
+
+    SECTION("Console variable")
+    {
+        IConsoleVariable* const variable = ConsoleVariableRegistry::Get().FindByName("Trace.Testing");
+        REQUIRE(variable != nullptr);
+        CHECK(variable->ToString() == "Information");
+
+        CHECK(variable->FromString("Warning"));
+        CHECK(TraceCategories::Testing.GetLevel() == TraceLevel::Warning);
+        CHECK(variable->ToString() == "Warning");
+
+        CHECK_FALSE(variable->FromString("Loud"));
+        CHECK(TraceCategories::Testing.GetLevel() == TraceLevel::Warning);
+
+        AE_TRACE_CATEGORY(Testing, Information, "hidden");
+        AE_TRACE_CATEGORY(Testing, Warning, "shown");
+        AE_TRACE_CATEGORY(Testing, Error, "shown");
+
+        std::vector<std::string> const messages = listener.GetMessages();
+
+        if constexpr (TraceLevel::Default <= TraceLevel::Warning)
+        {
+            REQUIRE(messages.size() == 2);
+            CHECK(messages[0] == "[W] Testing: shown");
+            CHECK(messages[1] == "[E] Testing: shown");
+        }
+        else
+        {
+            REQUIRE(messages.size() == 1);
+            CHECK(messages[0] == "[E] Testing: shown");
+        }
+    }
+
+    TraceCategories::Testing.SetLevel(TraceLevel::Information);
+    Trace::Get().Unregister(listener);
+}
+
+TEST_CASE("Diagnostics / TraceCategory - Level names")
+{
+    using namespace Anemone;
+
+    for (TraceLevel const level : {TraceLevel::Verbose, TraceLevel::Debug, TraceLevel::Information, TraceLevel::Warning, TraceLevel::Error, TraceLevel::Fatal, TraceLevel::None})
+    {
+        CHECK(ParseTraceLevel(GetTraceLevelName(level)) == level);
+    }
+
+    CHECK_FALSE(ParseTraceLevel("information"));
+    CHECK_FALSE(ParseTraceLevel(""));
+}
+
+TEST_CASE("Diagnostics / TraceCategory - Console variable values")
+{
+    using namespace Anemone;
+
+    ConsoleVariable<int64_t> integer{"Testing.Integer", 4};
+    CHECK(integer.FromString("-17"));
+    CHECK(integer.Get() == -17);
+    CHECK_FALSE(integer.FromString("12ms"));
+    CHECK(integer.Get() == -17);
+
+    ConsoleVariable<bool> boolean{"Testing.Boolean"};
+    CHECK(boolean.FromString("true"));
+    CHECK(boolean.Get());
+    CHECK_FALSE(boolean.FromString("yes"));
+
+    ConsoleVariable<std::string> text{"Testing.Text"};
+    CHECK(text.FromString("value"));
+    CHECK(text.Get() == "value");
+}
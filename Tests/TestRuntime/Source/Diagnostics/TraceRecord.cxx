@@ -0,0 +1,467 @@
+#include "AnemoneRuntime.Diagnostics/BinaryTraceFormat.hxx"
+#include "AnemoneRuntime.Diagnostics/BinaryTraceListener.hxx"
+#include "AnemoneRuntime.Diagnostics/TraceDispatcher.hxx"
+#include "AnemoneRuntime.Base/MemoryBuffer.hxx"
+#include "AnemoneRuntime.Storage/MemoryOutputStream.hxx"
+#include "AnemoneRuntime.Threading/CriticalSection.hxx"
+#include "AnemoneRuntime.Threading/Lock.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Same as AE_TRACE, but targets given dispatcher.
+#define TEST_TRACE(dispatcher, level, format, ...) \
+    do \
+    { \
+        struct TestTraceSite final \
+        { \
+            static constexpr ::Anemone::TraceLevel Level() { return ::Anemone::TraceLevel::level; } \
+            static constexpr std::string_view Format() { return format; } \
+            static constexpr std::string_view File() { return __FILE__; } \
+            static constexpr uint32_t Line() { return __LINE__; } \
+        }; \
+        (dispatcher).TraceDeferred<TestTraceSite>(__VA_ARGS__); \
+    } while (false)
+
+namespace
+{
+    class RecordingTraceListener final : public Anemone::TraceListener
+    {
+    private:
+        Anemone::CriticalSection m_Lock{};
+        std::vector<std::string> m_Messages{};
+
+    public:
+        size_t Records{};
+
+    public:
+        void TraceEvent(Anemone::TraceLevel level, const char* message, size_t size) override
+        {
+            (void)level;
+
+            Anemone::UniqueLock scope{this->m_Lock};
+            this->m_Messages.emplace_back(message, size);
+        }
+
+        void TraceRecord(Anemone::TraceSite const& site, std::span<std::byte const> payload) override
+        {
+            {
+                Anemone::UniqueLock scope{this->m_Lock};
+                ++this->Records;
+            }
+
+            TraceListener::TraceRecord(site, payload);
+        }
+
+        std::vector<std::string> GetMessages()
+        {
+            Anemone::UniqueLock scope{this->m_Lock};
+            return this->m_Messages;
+        }
+    };
+
+    // Has formatter, but no binary representation.
+    struct Opaque final
+    {
+        int Value;
+    };
+
+    // Reads all events from binary log and formats them.
+    std::vector<std::string> DecodeBinaryTrace(std::span<std::byte const> log)
+    {
+        using namespace Anemone;
+
+        auto reader = BinaryTraceReader::Open(log);
+        REQUIRE(reader);
+
+        std::vector<std::string> result{};
+        BinaryTraceEvent event{};
+        fmt::memory_buffer line{};
+
+        while (true)
+        {
+            auto const next = reader->Next(event);
+            REQUIRE(next);
+
+            if (not *next)
+            {
+                break;
+            }
+
+            line.clear();
+            REQUIRE(BinaryTraceReader::Format(line, event));
+            result.emplace_back(line.data(), line.size());
+        }
+
+        return result;
+    }
+}
+
+namespace
+{
+    // Writes at most few bytes at once and fails when capacity is exhausted.
+    class LimitedOutputStream final : public Anemone::OutputStream
+    {
+    private:
+        Anemone::MemoryOutputStream m_Inner;
+        size_t m_Capacity;
+
+    public:
+        LimitedOutputStream(Anemone::Reference<Anemone::MemoryBuffer> buffer, size_t capacity)
+            : m_Inner{std::move(buffer)}
+            , m_Capacity{capacity}
+        {
+        }
+
+        std::expected<size_t, Anemone::Error> Write(std::span<std::byte const> data) override
+        {
+            if (this->m_Capacity == 0)
+            {
+                return std::unexpected(Anemone::Error::NotEnoughSpace);
+            }
+
+            size_t const size = std::min({data.size(), this->m_Capacity, size_t{7}});
+            this->m_Capacity -= size;
+            return this->m_Inner.Write(data.first(size));
+        }
+
+        std::expected<void, Anemone::Error> Flush() override
+        {
+            return this->m_Inner.Flush();
+        }
+
+        std::expected<void, Anemone::Error> SetPosition(uint64_t value) override
+        {
+            return this->m_Inner.SetPosition(value);
+        }
+
+        std::expected<uint64_t, Anemone::Error> GetPosition() const override
+        {
+            return this->m_Inner.GetPosition();
+        }
+
+        std::expected<uint64_t, Anemone::Error> GetLength() const override
+        {
+            return this->m_Inner.GetLength();
+        }
+    };
+}
+
+template <>
+struct fmt::formatter<Opaque> : fmt::formatter<int>
+{
+    auto format(Opaque const& value, format_context& context) const
+    {
+        return fmt::formatter<int>::format(value.Value, context);
+    }
+};
+
+TEST_CASE("Diagnostics / TraceRecord - Deferred formatting")
+{
+    using namespace Anemone;
+
+    RecordingTraceListener listener{};
+    TraceDispatcher dispatcher{};
+    dispatcher.Register(listener);
+
+    SECTION("Arguments")
+    {
+        int const* const pointer = reinterpret_cast<int const*>(uintptr_t{0x1234});
+        std::string const text{"text"};
+        char const* const empty = nullptr;
+
+        TEST_TRACE(dispatcher, Information, "{} {} {} {} {}", int8_t{-8}, uint16_t{16}, -32, uint64_t{1} << 63u, 'c');
+        TEST_TRACE(dispatcher, Warning, "{:.3f} {} {:>6}", 1.5f, 2.25, true);
+        TEST_TRACE(dispatcher, Error, "{} {} {} [{}] {}", "literal", std::string_view{"view"}, text, empty, static_cast<void const*>(pointer));
+
+        CHECK(listener.Records == 3);
+
+        std::vector<std::string> const messages = listener.GetMessages();
+        REQUIRE(messages.size() == 3);
+        CHECK(messages[0] == fmt::format("[I] {} {} {} {} {}", int8_t{-8}, uint16_t{16}, -32, uint64_t{1} << 63u, 'c'));
+        CHECK(messages[1] == "[W] 1.500 2.25   true");
+        CHECK(messages[2] == fmt::format("[E] literal view text [] {}", static_cast<void const*>(pointer)));
+    }
+
+    SECTION("Truncation")
+    {
+        std::string const text(2 * TracePayloadCapacity, 'x');
+
+        TEST_TRACE(dispatcher, Information, "{}:{}", text, 42);
+
+        std::vector<std::string> const messages = listener.GetMessages();
+        REQUIRE(messages.size() == 1);
+
+        // Fixed size arguments are always kept.
+        CHECK(messages[0].ends_with(":42"));
+        CHECK(messages[0].size() == (4 + TracePayloadCapacity - sizeof(uint32_t) - sizeof(int) + 3));
+        CHECK(messages[0].starts_with("[I] xxxx"));
+    }
+
+    SECTION("Fallback")
+    {
+        TEST_TRACE(dispatcher, Debug, "opaque {} {}", Opaque{7}, 3);
+
+        // Arguments without binary representation are formatted at call site.
+        CHECK(listener.Records == 0);
+
+        std::vector<std::string> const messages = listener.GetMessages();
+        REQUIRE(messages.size() == 1);
+        CHECK(messages[0] == "[D] opaque 7 3");
+    }
+
+    SECTION("Async")
+    {
+        dispatcher.EnableAsync(AsyncTraceOptions{
+            .OverflowPolicy = TraceOverflowPolicy::Block,
+        });
+
+        for (int i = 0; i < 100; ++i)
+        {
+            TEST_TRACE(dispatcher, Information, "message {} {}", i, "async");
+        }
+
+        dispatcher.Flush();
+
+        std::vector<std::string> const messages = listener.GetMessages();
+        REQUIRE(messages.size() == 100);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            CHECK(messages[i] == fmt::format("[I] message {} async", i));
+        }
+
+        dispatcher.DisableAsync();
+    }
+
+    dispatcher.Unregister(listener);
+}
+
+TEST_CASE("Diagnostics / TraceRecord - Site")
+{
+    using namespace Anemone;
+
+    struct Site final
+    {
+        static constexpr TraceLevel Level() { return TraceLevel::Information; }
+        static constexpr std::string_view Format() { return "value {}"; }
+        static constexpr std::string_view File() { return "File.cxx"; }
+        static constexpr uint32_t Line() { return 42; }
+    };
+
+    // Site identifier depends on argument types too.
+    constexpr uint64_t Int32Id = Internal::MakeTraceSiteId<Site, int32_t>();
+    constexpr uint64_t Int64Id = Internal::MakeTraceSiteId<Site, int64_t>();
+    STATIC_CHECK(Int32Id != Int64Id);
+    STATIC_CHECK(Int32Id == Internal::MakeTraceSiteId<Site, int32_t>());
+
+    std::array<TraceArgumentType, 1> const arguments{TraceArgumentType::Int32};
+
+    int32_t const value = 5;
+    std::array<std::byte, sizeof(value)> payload{};
+    std::memcpy(payload.data(), &value, sizeof(value));
+
+    fmt::memory_buffer buffer{};
+    CHECK(FormatTraceArguments(buffer, Site::Format(), arguments, payload));
+    CHECK(fmt::to_string(buffer) == "value 5");
+
+    // Payload must match argument types exactly.
+    buffer.clear();
+    CHECK_FALSE(FormatTraceArguments(buffer, Site::Format(), arguments, std::span{payload}.first(2)));
+
+    std::array<std::byte, sizeof(value) + 1> longer{};
+    CHECK_FALSE(FormatTraceArguments(buffer, Site::Format(), arguments, longer));
+}
+
+TEST_CASE("Diagnostics / BinaryTraceListener - Round trip")
+{
+    using namespace Anemone;
+
+    auto buffer = MemoryBuffer::Create(0);
+    REQUIRE(buffer);
+
+    RecordingTraceListener text{};
+
+    {
+        BinaryTraceListener binary{MakeReference<MemoryOutputStream>(*buffer)};
+
+        TraceDispatcher dispatcher{};
+        dispatcher.Register(text);
+        dispatcher.Register(binary);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            TEST_TRACE(dispatcher, Information, "iteration {} of {}", i, std::string_view{"loop"});
+        }
+
+        TEST_TRACE(dispatcher, Warning, "{:08x} {:.2f}", 0xBEEFu, 0.125);
+        TEST_TRACE(dispatcher, Debug, "opaque {}", Opaque{11});
+        dispatcher.TraceError("eager {}", 3);
+
+        dispatcher.Flush();
+        dispatcher.Unregister(binary);
+        dispatcher.Unregister(text);
+    }
+
+    std::span<std::byte const> const log = (*buffer)->GetView();
+
+    // Offline decoding gives same text as formatting in process.
+    std::vector<std::string> const decoded = DecodeBinaryTrace(log);
+    std::vector<std::string> const expected = text.GetMessages();
+    REQUIRE(expected.size() == 6);
+    CHECK(decoded == expected);
+
+    // Every site is defined once.
+    size_t definitions = 0;
+
+    for (size_t offset = sizeof(BinaryTraceHeader); offset < log.size();)
+    {
+        auto const kind = static_cast<BinaryTraceRecordKind>(log[offset]);
+
+        if (kind == BinaryTraceRecordKind::Site)
+        {
+            BinaryTraceSiteRecord record{};
+            std::memcpy(&record, log.data() + offset, sizeof(record));
+            offset += sizeof(record) + record.ArgumentCount + record.FormatLength + record.FileLength;
+            ++definitions;
+        }
+        else if (kind == BinaryTraceRecordKind::Event)
+        {
+            BinaryTraceEventRecord record{};
+            std::memcpy(&record, log.data() + offset, sizeof(record));
+            offset += sizeof(record) + record.PayloadSize;
+        }
+        else
+        {
+            REQUIRE(kind == BinaryTraceRecordKind::Text);
+            BinaryTraceTextRecord record{};
+            std::memcpy(&record, log.data() + offset, sizeof(record));
+            offset += sizeof(record) + record.Size;
+        }
+    }
+
+    CHECK(definitions == 2);
+}
+
+TEST_CASE("Diagnostics / BinaryTraceListener - Partial writes")
+{
+    using namespace Anemone;
+
+    auto buffer = MemoryBuffer::Create(0);
+    REQUIRE(buffer);
+
+    SECTION("Short writes")
+    {
+        RecordingTraceListener text{};
+
+        {
+            BinaryTraceListener binary{MakeReference<LimitedOutputStream>(*buffer, std::numeric_limits<size_t>::max())};
+
+            TraceDispatcher dispatcher{};
+            dispatcher.Register(text);
+            dispatcher.Register(binary);
+            TEST_TRACE(dispatcher, Information, "value {}", 1);
+            dispatcher.TraceError("eager {}", 2);
+            dispatcher.Unregister(binary);
+            dispatcher.Unregister(text);
+
+            CHECK_FALSE(binary.HasFailed());
+        }
+
+        // Records are written whole, even when stream accepts only part of them at once.
+        CHECK(DecodeBinaryTrace((*buffer)->GetView()) == text.GetMessages());
+    }
+
+    SECTION("Failure")
+    {
+        BinaryTraceListener binary{MakeReference<LimitedOutputStream>(*buffer, sizeof(BinaryTraceHeader) + 8)};
+
+        TraceDispatcher dispatcher{};
+        dispatcher.Register(binary);
+        dispatcher.TraceError("first");
+
+        // Listener stops after failed write, so truncated record is last one in log.
+        CHECK(binary.HasFailed());
+        dispatcher.TraceError("second");
+        dispatcher.Unregister(binary);
+
+        CHECK((*buffer)->GetView().size() == (sizeof(BinaryTraceHeader) + 8));
+    }
+}
+
+TEST_CASE("Diagnostics / BinaryTraceReader - Invalid logs")
+{
+    using namespace Anemone;
+
+    auto buffer = MemoryBuffer::Create(0);
+    REQUIRE(buffer);
+
+    {
+        BinaryTraceListener binary{MakeReference<MemoryOutputStream>(*buffer)};
+
+        TraceDispatcher dispatcher{};
+        dispatcher.Register(binary);
+        TEST_TRACE(dispatcher, Information, "value {}", 1);
+        TEST_TRACE(dispatcher, Information, "value {}", 2);
+        dispatcher.Unregister(binary);
+    }
+
+    std::vector<std::byte> log{(*buffer)->GetView().begin(), (*buffer)->GetView().end()};
+
+    SECTION("Header")
+    {
+        CHECK(BinaryTraceReader::Open(std::span{log}.first(4)).error() == Error::InvalidHeader);
+
+        log[0] = std::byte{'X'};
+        CHECK(BinaryTraceReader::Open(log).error() == Error::InvalidHeader);
+    }
+
+    SECTION("Version")
+    {
+        uint32_t const version = BinaryTraceVersion + 1;
+        std::memcpy(log.data() + offsetof(BinaryTraceHeader, Version), &version, sizeof(version));
+        CHECK(BinaryTraceReader::Open(log).error() == Error::NotSupported);
+    }
+
+    SECTION("Truncated")
+    {
+        auto reader = BinaryTraceReader::Open(std::span{log}.first(log.size() - 1));
+        REQUIRE(reader);
+
+        BinaryTraceEvent event{};
+        CHECK(reader->Next(event) == true);
+
+        auto const next = reader->Next(event);
+        REQUIRE_FALSE(next);
+        CHECK(next.error() == Error::InvalidData);
+    }
+
+    SECTION("Undefined site")
+    {
+        // Skip site definition.
+        BinaryTraceSiteRecord record{};
+        std::memcpy(&record, log.data() + sizeof(BinaryTraceHeader), sizeof(record));
+        size_t const size = sizeof(record) + record.ArgumentCount + record.FormatLength + record.FileLength;
+        log.erase(log.begin() + sizeof(BinaryTraceHeader), log.begin() + sizeof(BinaryTraceHeader) + size);
+
+        auto reader = BinaryTraceReader::Open(log);
+        REQUIRE(reader);
+
+        BinaryTraceEvent event{};
+        auto const next = reader->Next(event);
+        REQUIRE_FALSE(next);
+        CHECK(next.error() == Error::InvalidData);
+    }
+}
@@ -0,0 +1,151 @@
+#include "AnemoneRuntime.Base/Memory/MemoryTracking.hxx"
+#include "AnemoneRuntime.Base/Memory/TrackingAllocator.hxx"
+#include "AnemoneRuntime.Base/Memory/Allocator.hxx"
+#include "AnemoneRuntime.Base/ConsoleFunction.hxx"
+#include "AnemoneRuntime.Base/Bitwise.hxx"
+#include "AnemoneRuntime.Memory/RawMemoryArena.hxx"
+#include "AnemoneRuntime.Diagnostics/Trace.hxx"
+#include "AnemoneRuntime.Threading/CriticalSection.hxx"
+#include "AnemoneRuntime.Threading/Lock.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace
+{
+    class CapturingTraceListener final : public Anemone::TraceListener
+    {
+    private:
+        Anemone::CriticalSection m_Lock{};
+        std::vector<std::string> m_Messages{};
+
+    public:
+        void TraceEvent(Anemone::TraceLevel level, const char* message, size_t size) override
+        {
+            (void)level;
+
+            Anemone::UniqueLock scope{this->m_Lock};
+            this->m_Messages.emplace_back(message, size);
+        }
+
+        std::vector<std::string> GetMessages()
+        {
+            Anemone::UniqueLock scope{this->m_Lock};
+            return this->m_Messages;
+        }
+    };
+}
+
+TEST_CASE("Memory / MemoryTracking - Tags")
+{
+    using namespace Anemone;
+    using namespace Anemone::Memory;
+
+    if constexpr (not ANEMONE_FEATURE_MEMORY_TRACKING)
+    {
+        SKIP("Memory tracking is disabled");
+    }
+
+    Allocator& backing = GetDefaultAllocator();
+
+    MemoryTagStatistics const physicsBefore = MemoryTracking::CaptureSnapshot().Tags[static_cast<size_t>(MemoryTag::Physics)];
+    MemoryTagStatistics const toolsBefore = MemoryTracking::CaptureSnapshot().Tags[static_cast<size_t>(MemoryTag::Tools)];
+
+    SECTION("Explicit tag")
+    {
+        TrackingAllocator allocator{backing, MemoryTag::Physics};
+
+        std::vector<Allocation> allocations{};
+
+        for (size_t i = 0; i < 40; ++i)
+        {
+            allocations.push_back(allocator.Allocate(Layout{.Size = 16 << 10, .Alignment = 16}));
+        }
+
+        MemoryTagStatistics const during = MemoryTracking::CaptureSnapshot().Tags[static_cast<size_t>(MemoryTag::Physics)];
+        REQUIRE(during.Allocations - physicsBefore.Allocations == 40);
+        REQUIRE(during.Live - physicsBefore.Live >= 40 * (16 << 10));
+        REQUIRE(during.Peak >= during.Live);
+
+        for (Allocation const& allocation : allocations)
+        {
+            allocator.Deallocate(allocation);
+        }
+
+        MemoryTagStatistics const after = MemoryTracking::CaptureSnapshot().Tags[static_cast<size_t>(MemoryTag::Physics)];
+        REQUIRE(after.Live == physicsBefore.Live);
+        REQUIRE(after.Peak >= during.Live);
+    }
+
+    SECTION("Scoped tag")
+    {
+        TrackingAllocator allocator{backing};
+
+        Allocation allocation{};
+
+        {
+            MemoryTagScope scope{MemoryTag::Tools};
+            REQUIRE(MemoryTracking::GetCurrentTag() == MemoryTag::Tools);
+
+            allocation = allocator.Allocate(Layout{.Size = 1000, .Alignment = 64});
+            REQUIRE(allocation.Address != nullptr);
+            REQUIRE(IsAligned(static_cast<void const*>(allocation.Address), 64));
+
+            // Arena created inside scope accounts its memory to the same tag.
+            RawMemoryArena arena{};
+            (void)arena.Allocate(100, 8);
+
+            MemoryTagStatistics const during = MemoryTracking::CaptureSnapshot().Tags[static_cast<size_t>(MemoryTag::Tools)];
+            REQUIRE(during.Allocations - toolsBefore.Allocations == 2);
+            REQUIRE(during.Live - toolsBefore.Live >= 1000 + RawMemoryArena::DefaultSegmentSize);
+        }
+
+        REQUIRE(MemoryTracking::GetCurrentTag() == MemoryTag::Untagged);
+
+        // Tag is remembered by allocation, not taken from scope active at deallocation.
+        allocator.Deallocate(allocation);
+
+        MemoryTagStatistics const after = MemoryTracking::CaptureSnapshot().Tags[static_cast<size_t>(MemoryTag::Tools)];
+        REQUIRE(after.Live == toolsBefore.Live);
+    }
+
+    SECTION("Requested size")
+    {
+        TrackingAllocator allocator{backing, MemoryTag::Physics};
+
+        // Allocator may return more than requested; callers often pass back requested size.
+        Allocation const allocation = allocator.Allocate(Layout{.Size = 100, .Alignment = 8});
+        REQUIRE(allocation.Address != nullptr);
+
+        allocator.Deallocate(Allocation{.Address = allocation.Address, .Size = 100});
+
+        MemoryTagStatistics const after = MemoryTracking::CaptureSnapshot().Tags[static_cast<size_t>(MemoryTag::Physics)];
+        REQUIRE(after.Live == physicsBefore.Live);
+    }
+
+    SECTION("Console function")
+    {
+        TrackingAllocator allocator{backing, MemoryTag::Physics};
+        allocator.Deallocate(allocator.Allocate(Layout{.Size = 64, .Alignment = 8}));
+
+        IConsoleFunction* const function = ConsoleFunctionRegistry::Get().FindByName("Memory.Tags");
+        REQUIRE(function != nullptr);
+
+        CapturingTraceListener listener{};
+        Trace::Get().Register(listener);
+        function->Execute({});
+        Trace::Get().Unregister(listener);
+
+        REQUIRE(std::ranges::any_of(listener.GetMessages(), [](std::string const& message)
+        {
+            return message.find("Physics: live") != std::string::npos;
+        }));
+    }
+}
@@ -0,0 +1,77 @@
+#include "AnemoneRuntime.Memory/RawMemoryArena.hxx"
+#include "AnemoneRuntime.Base/Bitwise.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <cstring>
+
+TEST_CASE("Memory / RawMemoryArena - Virtual Reservation")
+{
+    using namespace Anemone;
+
+    constexpr size_t Granularity = size_t{64} << 10u;
+
+    RawMemoryArena arena{RawMemoryArenaReservation{
+        .Reserve = size_t{16} << 20u,
+        .CommitGranularity = Granularity,
+        .TrimAfterIdleResets = 3,
+    }};
+
+    REQUIRE(arena.IsVirtual());
+
+    // Allocations are contiguous and committed lazily.
+    auto* const first = static_cast<std::byte*>(arena.Allocate(100, 16));
+    auto* const second = static_cast<std::byte*>(arena.Allocate(Granularity * 3, 64));
+
+    REQUIRE(first != nullptr);
+    REQUIRE(second != nullptr);
+    REQUIRE(IsAligned(second, 64));
+    REQUIRE(second == first + 128);
+
+    std::memset(first, 0xAB, 100);
+    std::memset(second, 0xCD, Granularity * 3);
+
+    size_t reserved = 0;
+    size_t allocated = 0;
+    arena.QueryMemoryUsage(reserved, allocated);
+    REQUIRE(reserved == Granularity * 4);
+    REQUIRE(allocated == 128 + Granularity * 3);
+
+    // Reset rewinds without releasing committed memory.
+    arena.Reset();
+    REQUIRE(arena.Allocate(16, 16) == first);
+
+    reserved = 0;
+    allocated = 0;
+    arena.QueryMemoryUsage(reserved, allocated);
+    REQUIRE(reserved == Granularity * 4);
+    REQUIRE(allocated == 16);
+
+    // After enough light frames, unused top of committed range is decommitted.
+    for (size_t i = 0; i < 3; ++i)
+    {
+        arena.Reset();
+        (void)arena.Allocate(1000, 16);
+    }
+
+    arena.Reset();
+
+    reserved = 0;
+    allocated = 0;
+    arena.QueryMemoryUsage(reserved, allocated);
+    REQUIRE(reserved == Granularity);
+    REQUIRE(allocated == 0);
+
+    // Memory can be committed again.
+    auto* const large = static_cast<std::byte*>(arena.Allocate(Granularity * 2, 16));
+    REQUIRE(large == first);
+    std::memset(large, 0xEF, Granularity * 2);
+
+    // Allocation larger than reservation falls back to separate block.
+    void* const oversized = arena.Allocate(size_t{32} << 20u, 16);
+    REQUIRE(oversized != nullptr);
+}
@@ -0,0 +1,170 @@
+#include "AnemoneRuntime.Base/Memory/SlabAllocator.hxx"
+#include "AnemoneRuntime.Base/Memory/ConcurrentSlabAllocator.hxx"
+#include "AnemoneRuntime.Base/Memory/SystemAllocator.hxx"
+#include "AnemoneRuntime.Threading/Thread.hxx"
+#include "AnemoneRuntime.Threading/Runnable.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+TEST_CASE("Memory / SlabAllocator - Empty Slab Reserve")
+{
+    using namespace Anemone;
+    using namespace Anemone::Memory;
+
+    SystemAllocator backing{};
+    SlabAllocator allocator{&backing, 64, 16, 1};
+
+    size_t const capacity = allocator.GetSlabCapacity();
+
+    std::vector<void*> elements{};
+
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        elements.push_back(allocator.Allocate());
+    }
+
+    // Oscillate around slab boundary; reserved slab is reused.
+    for (size_t i = 0; i < 100; ++i)
+    {
+        void* const element = allocator.Allocate();
+        REQUIRE(element != nullptr);
+        allocator.Deallocate(element);
+    }
+
+    SlabAllocatorStatistics statistics = allocator.GetStatistics();
+    REQUIRE(statistics.SlabsCreated == 2);
+    REQUIRE(statistics.SlabsReleased == 0);
+    REQUIRE(statistics.FullSlabs == 1);
+    REQUIRE(statistics.PartialSlabs == 0);
+    REQUIRE(statistics.EmptySlabs == 1);
+    REQUIRE(statistics.Allocated == capacity);
+    REQUIRE(statistics.GetOccupancy() == 1.0);
+
+    // Free every other element; slab is half used.
+    for (size_t i = 0; i < elements.size(); i += 2)
+    {
+        allocator.Deallocate(elements[i]);
+        elements[i] = nullptr;
+    }
+
+    statistics = allocator.GetStatistics();
+    REQUIRE(statistics.PartialSlabs == 1);
+    REQUIRE(statistics.Allocated == capacity / 2);
+    REQUIRE(statistics.GetFragmentedSlabs() == 0);
+
+    for (void* element : elements)
+    {
+        if (element != nullptr)
+        {
+            allocator.Deallocate(element);
+        }
+    }
+
+    // Reserve holds single slab; second one is released.
+    statistics = allocator.GetStatistics();
+    REQUIRE(statistics.EmptySlabs == 1);
+    REQUIRE(statistics.SlabsReleased == 1);
+
+    allocator.SetEmptySlabReserve(0);
+    REQUIRE(allocator.GetStatistics().SlabsReleased == 2);
+}
+
+TEST_CASE("Memory / ConcurrentSlabAllocator - Threads")
+{
+    using namespace Anemone;
+    using namespace Anemone::Memory;
+
+    SystemAllocator backing{};
+    ConcurrentSlabAllocator allocator{&backing, 48, 16};
+
+    constexpr size_t ThreadCount = 4;
+    constexpr size_t Rounds = 64;
+    constexpr size_t Batch = 300;
+
+    // Each thread allocates batch and frees batch allocated by its neighbour in previous round.
+    std::array<std::vector<void*>, ThreadCount> batches{};
+    std::atomic_size_t failures{};
+
+    std::vector<Reference<Thread>> threads{};
+
+    for (size_t thread = 0; thread < ThreadCount; ++thread)
+    {
+        threads.push_back(Thread::Start(ThreadStart{
+            .Callback = MakeRunnable([&, thread]
+            {
+                std::vector<void*> local{};
+
+                for (size_t round = 0; round < Rounds; ++round)
+                {
+                    for (size_t i = 0; i < Batch; ++i)
+                    {
+                        auto* const element = static_cast<size_t*>(allocator.Allocate());
+
+                        if (element == nullptr)
+                        {
+                            failures.fetch_add(1);
+                            continue;
+                        }
+
+                        *element = thread;
+                        local.push_back(element);
+                    }
+
+                    for (void* element : local)
+                    {
+                        if (*static_cast<size_t*>(element) != thread)
+                        {
+                            failures.fetch_add(1);
+                        }
+
+                        allocator.Deallocate(element);
+                    }
+
+                    local.clear();
+                }
+
+                for (size_t i = 0; i < Batch; ++i)
+                {
+                    batches[thread].push_back(allocator.Allocate());
+                }
+            }),
+        }));
+    }
+
+    for (Reference<Thread> const& thread : threads)
+    {
+        thread->Join();
+    }
+
+    REQUIRE(failures.load() == 0);
+
+    ConcurrentSlabAllocatorStatistics statistics = allocator.GetStatistics();
+    REQUIRE(statistics.GetLive() == ThreadCount * Batch);
+
+    // Free remaining elements from this thread.
+    for (std::vector<void*> const& batch : batches)
+    {
+        for (void* element : batch)
+        {
+            allocator.Deallocate(element);
+        }
+    }
+
+    allocator.Flush();
+
+    statistics = allocator.GetStatistics();
+    REQUIRE(statistics.GetLive() == 0);
+    REQUIRE(statistics.Cached == 0);
+    REQUIRE(statistics.Slabs.Allocated == 0);
+    REQUIRE(statistics.Slabs.PartialSlabs == 0);
+    REQUIRE(statistics.Slabs.FullSlabs == 0);
+    REQUIRE(statistics.Slabs.EmptySlabs <= 1);
+}
@@ -0,0 +1,188 @@
+#include "AnemoneRuntime.Base/Memory/ThreadCachingAllocator.hxx"
+#include "AnemoneRuntime.Base/Memory/SystemAllocator.hxx"
+#include "AnemoneRuntime.Base/Bitwise.hxx"
+#include "AnemoneRuntime.Threading/Thread.hxx"
+#include "AnemoneRuntime.Threading/Runnable.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <cstring>
+#include <vector>
+
+TEST_CASE("Memory / ThreadCachingAllocator - Size Classes")
+{
+    using namespace Anemone;
+    using namespace Anemone::Memory;
+
+    SystemAllocator backing{};
+    ThreadCachingAllocator allocator{backing};
+
+    std::vector<Allocation> allocations{};
+
+    for (size_t size = 1; size <= 3 * ThreadCachingAllocator::MaxSmallSize; size += 37)
+    {
+        for (size_t alignment : {1uz, 16uz, 64uz, 4096uz})
+        {
+            Allocation const allocation = allocator.Allocate(Layout{.Size = size, .Alignment = alignment});
+
+            REQUIRE(allocation.Address != nullptr);
+            REQUIRE(allocation.Size >= size);
+            REQUIRE(IsAligned(allocation.Address, alignment));
+
+            std::memset(allocation.Address, static_cast<int>(size), size);
+            allocations.push_back(allocation);
+        }
+    }
+
+    ThreadCachingAllocatorStatistics const statistics = allocator.GetStatistics();
+    REQUIRE(statistics.Allocations + statistics.LargeAllocations == allocations.size());
+    REQUIRE(statistics.LargeAllocations != 0);
+    REQUIRE(statistics.Heaps == 1);
+
+    for (Allocation const& allocation : allocations)
+    {
+        allocator.Deallocate(allocation);
+    }
+
+    REQUIRE(allocator.GetStatistics().Deallocations == statistics.Allocations);
+}
+
+TEST_CASE("Memory / ThreadCachingAllocator - Reallocate")
+{
+    using namespace Anemone;
+    using namespace Anemone::Memory;
+
+    SystemAllocator backing{};
+    ThreadCachingAllocator allocator{backing};
+
+    Allocation allocation = allocator.Allocate(Layout{.Size = 24, .Alignment = 8});
+    std::memcpy(allocation.Address, "thread caching allocator", 24);
+
+    // Growth within same size class keeps block in place.
+    void* const original = allocation.Address;
+    allocation = allocator.Reallocate(allocation, Layout{.Size = allocation.Size, .Alignment = 8});
+    REQUIRE(allocation.Address == original);
+
+    // Growth through small and large sizes preserves content.
+    for (size_t size : {100uz, 5000uz, 100000uz, 64uz})
+    {
+        allocation = allocator.Reallocate(allocation, Layout{.Size = size, .Alignment = 8});
+        REQUIRE(allocation.Address != nullptr);
+        REQUIRE(allocation.Size >= size);
+        REQUIRE(std::memcmp(allocation.Address, "thread caching allocator", 24) == 0);
+    }
+
+    allocator.Deallocate(allocation);
+}
+
+TEST_CASE("Memory / ThreadCachingAllocator - Remote Deallocation")
+{
+    using namespace Anemone;
+    using namespace Anemone::Memory;
+
+    SystemAllocator backing{};
+    ThreadCachingAllocator allocator{backing};
+
+    constexpr size_t Count = 4096;
+
+    std::vector<Allocation> allocations(Count);
+
+    Reference<Thread> producer = Thread::Start(ThreadStart{
+        .Callback = MakeRunnable([&]
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                allocations[i] = allocator.Allocate(Layout{.Size = 16 + (i % 512), .Alignment = 16});
+            }
+        }),
+    });
+
+    producer->Join();
+
+    // Producer thread has exited; its heap is abandoned and still owns all blocks.
+    for (Allocation const& allocation : allocations)
+    {
+        REQUIRE(allocation.Address != nullptr);
+        allocator.Deallocate(allocation);
+    }
+
+    ThreadCachingAllocatorStatistics const statistics = allocator.GetStatistics();
+    REQUIRE(statistics.Allocations == Count);
+    REQUIRE(statistics.RemoteDeallocations == Count);
+
+    // Next allocation on this thread adopts abandoned heap and returns remotely freed blocks to its slabs.
+    Allocation const allocation = allocator.Allocate(Layout{.Size = 16, .Alignment = 16});
+    allocator.CollectRemoteFrees();
+
+    REQUIRE(allocator.GetStatistics().Heaps == 1);
+    REQUIRE(allocator.GetStatistics().Deallocations == Count);
+
+    allocator.Deallocate(allocation);
+}
+
+TEST_CASE("Memory / ThreadCachingAllocator - Large Allocations")
+{
+    using namespace Anemone;
+    using namespace Anemone::Memory;
+
+    // Tracks bytes held from system allocator.
+    class RecordingAllocator final : public Allocator
+    {
+    public:
+        SystemAllocator Backing{};
+        size_t Outstanding{};
+
+        Allocation Allocate(Layout const& layout) override
+        {
+            Allocation const result = this->Backing.Allocate(layout);
+            this->Outstanding += result.Size;
+            return result;
+        }
+
+        void Deallocate(Allocation const& allocation) override
+        {
+            this->Outstanding -= allocation.Size;
+            this->Backing.Deallocate(allocation);
+        }
+
+        Allocation Reallocate(Allocation const& allocation, Layout const& layout) override
+        {
+            return this->Backing.Reallocate(allocation, layout);
+        }
+    };
+
+    RecordingAllocator backing{};
+    ThreadCachingAllocator allocator{backing};
+
+    // Over-aligned allocations are mapped with size rounded to alignment; callers return requested size.
+    for (size_t alignment : {ThreadCachingAllocator::SpanSize, 4 * ThreadCachingAllocator::SpanSize})
+    {
+        size_t const size = ThreadCachingAllocator::MaxSmallSize + 1;
+
+        Allocation const allocation = allocator.Allocate(Layout{.Size = size, .Alignment = alignment});
+        REQUIRE(allocation.Address != nullptr);
+        REQUIRE(IsAligned(allocation.Address, alignment));
+        REQUIRE(backing.Outstanding >= size);
+
+        allocator.Deallocate(Allocation{.Address = allocation.Address, .Size = size});
+        REQUIRE(backing.Outstanding == 0);
+    }
+}
+
+TEST_CASE("Memory / ThreadCachingAllocator - Default Allocator")
+{
+    using namespace Anemone;
+    using namespace Anemone::Memory;
+
+    Allocator& allocator = GetDefaultAllocator();
+
+    Allocation const allocation = allocator.Allocate(Layout{.Size = 100, .Alignment = 16});
+    REQUIRE(allocation.Address != nullptr);
+    REQUIRE(IsAligned(allocation.Address, 16));
+
+    allocator.Deallocate(allocation);
+}
@@ -0,0 +1,32 @@
+#include "AnemoneRuntime.System/ProcessorProperties.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+TEST_CASE("System / ProcessorProperties - Topology")
+{
+    using namespace Anemone;
+
+    std::span<LogicalProcessorInfo const> const processors = ProcessorProperties::GetLogicalProcessors();
+
+    REQUIRE(processors.size() == ProcessorProperties::GetLogicalCoresCount());
+    REQUIRE(ProcessorProperties::GetCacheDomainsCount() >= 1);
+    REQUIRE(ProcessorProperties::GetNumaNodesCount() >= 1);
+
+    for (size_t i = 0; i < processors.size(); ++i)
+    {
+        LogicalProcessorInfo const& processor = processors[i];
+
+        if (i != 0)
+        {
+            REQUIRE(processors[i - 1].Index < processor.Index);
+        }
+
+        REQUIRE(processor.Core < ProcessorProperties::GetPhysicalCoresCount());
+        REQUIRE(processor.CacheDomain < ProcessorProperties::GetCacheDomainsCount());
+        REQUIRE(processor.NumaNode < ProcessorProperties::GetNumaNodesCount());
+    }
+}
@@ -0,0 +1,339 @@
+#include "AnemoneRuntime.Profiler/InstrumentationProfilerBackend.hxx"
+
+#if ANEMONE_BUILD_PROFILING
+
+#include "AnemoneRuntime.Base/MemoryBuffer.hxx"
+#include "AnemoneRuntime.Storage/MemoryOutputStream.hxx"
+#include "AnemoneRuntime.Tasks/DefaultTaskScheduler.hxx"
+#include "AnemoneRuntime.Tasks/Task.hxx"
+#include "AnemoneRuntime.Tasks/TaskAwaiter.hxx"
+#include "AnemoneRuntime.Threading/CurrentThread.hxx"
+#include "AnemoneRuntime.Threading/Runnable.hxx"
+#include "AnemoneRuntime.Threading/Thread.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    std::string ExportChromeTrace(Anemone::InstrumentationProfilerBackend& backend)
+    {
+        using namespace Anemone;
+
+        auto buffer = MemoryBuffer::Create(0);
+        REQUIRE(buffer);
+
+        MemoryOutputStream stream{*buffer};
+        REQUIRE(backend.WriteChromeTrace(stream));
+
+        std::span<std::byte const> const view = (*buffer)->GetView();
+        return std::string{reinterpret_cast<char const*>(view.data()), view.size()};
+    }
+
+    size_t CountOccurrences(std::string_view text, std::string_view pattern)
+    {
+        size_t result = 0;
+
+        for (size_t position = text.find(pattern); position != std::string_view::npos; position = text.find(pattern, position + pattern.size()))
+        {
+            ++result;
+        }
+
+        return result;
+    }
+
+    //! Timestamps of events recorded by given thread, in order of appearance.
+    std::vector<double> GetTimestamps(std::string_view trace, Anemone::ThreadId thread)
+    {
+        std::vector<double> result{};
+        std::string const suffix = fmt::format(",\"pid\":1,\"tid\":{}", thread);
+
+        for (size_t position = trace.find("\"ts\":"); position != std::string_view::npos; position = trace.find("\"ts\":", position + 1))
+        {
+            char* end{};
+            double const value = std::strtod(trace.data() + position + 5, &end);
+
+            if (std::string_view{end, suffix.size()} == suffix)
+            {
+                result.push_back(value);
+            }
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("Profiler / InstrumentationProfilerBackend - Chrome trace")
+{
+    using namespace Anemone;
+
+    ProfilerMarker outer{"Outer"};
+    ProfilerMarker inner{"Inner"};
+    ProfilerMarker tick{"Tick"};
+
+    InstrumentationProfilerBackend backend{};
+
+    backend.BeginFrame();
+    backend.BeginMarker(outer);
+    backend.BeginMarker(inner);
+    CurrentThread::Sleep(Duration::FromMilliseconds(5));
+    backend.EndMarker(inner);
+    backend.EventMarker(tick);
+    backend.EndMarker(outer);
+    backend.EndFrame();
+
+    ThreadId workerId{};
+
+    Reference<Thread> const worker = Thread::Start(ThreadStart{
+        .Name = "ProfilerWorker",
+        .Callback = MakeRunnable([&]
+        {
+            workerId = CurrentThread::Id();
+            backend.BeginMarker(outer);
+            backend.EndMarker(outer);
+        }),
+    });
+
+    worker->Join();
+
+    std::string const trace = ExportChromeTrace(backend);
+
+    CHECK(trace.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"));
+    CHECK(trace.ends_with("\n]}\n"));
+
+    // Thread names are taken from Thread.
+    CHECK(trace.find(fmt::format("\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"ProfilerWorker\"}}", workerId)) != std::string::npos);
+
+    CHECK(CountOccurrences(trace, "\"ph\":\"B\"") == 4);
+    CHECK(CountOccurrences(trace, "\"ph\":\"E\"") == 4);
+    CHECK(CountOccurrences(trace, "{\"name\":\"Tick\",\"ph\":\"i\",\"s\":\"t\"") == 1);
+    CHECK(CountOccurrences(trace, "{\"name\":\"Frame\",\"ph\":\"B\"") == 1);
+    CHECK(CountOccurrences(trace, "\"args\":{\"frame\":0}") == 1);
+
+    // Timestamps are converted to microseconds.
+    std::vector<double> const timestamps = GetTimestamps(trace, CurrentThread::Id());
+    REQUIRE(timestamps.size() == 7);
+    CHECK(std::ranges::is_sorted(timestamps));
+    CHECK((timestamps[3] - timestamps[2]) >= 4000.0);
+    CHECK((timestamps[3] - timestamps[2]) < 1000000.0);
+
+    CHECK(GetTimestamps(trace, workerId).size() == 2);
+    CHECK(backend.GetDroppedCount() == 0);
+}
+
+TEST_CASE("Profiler / InstrumentationProfilerBackend - Full buffer")
+{
+    using namespace Anemone;
+
+    ProfilerMarker marker{"Marker"};
+
+    InstrumentationProfilerBackend backend{InstrumentationProfilerOptions{
+        .ChunkCapacity = 4,
+        .MaxChunksPerThread = 2,
+    }};
+
+    for (size_t i = 0; i < 5; ++i)
+    {
+        backend.BeginMarker(marker);
+        backend.EndMarker(marker);
+    }
+
+    CHECK(backend.GetDroppedCount() == 2);
+
+    std::string const trace = ExportChromeTrace(backend);
+    CHECK(CountOccurrences(trace, "\"ph\":\"B\"") == 4);
+    CHECK(CountOccurrences(trace, "\"ph\":\"E\"") == 4);
+
+    // Export releases recorded events, so recording continues within budget.
+    backend.BeginMarker(marker);
+    backend.EndMarker(marker);
+
+    CHECK(backend.GetDroppedCount() == 2);
+
+    std::string const next = ExportChromeTrace(backend);
+    CHECK(CountOccurrences(next, "\"ph\":\"B\"") == 1);
+    CHECK(CountOccurrences(next, "\"ph\":\"E\"") == 1);
+}
+
+TEST_CASE("Profiler / InstrumentationProfilerBackend - Incremental export")
+{
+    using namespace Anemone;
+
+    ProfilerMarker outer{"Outer"};
+    ProfilerMarker inner{"Inner"};
+
+    InstrumentationProfilerBackend backend{};
+
+    backend.BeginMarker(outer);
+    backend.BeginMarker(inner);
+    backend.EndMarker(inner);
+
+    // Scope still running at export is closed.
+    std::string const first = ExportChromeTrace(backend);
+    CHECK(CountOccurrences(first, "{\"name\":\"Outer\",\"ph\":\"B\"") == 1);
+    CHECK(CountOccurrences(first, "{\"name\":\"Inner\",\"ph\":\"B\"") == 1);
+    CHECK(CountOccurrences(first, "\"ph\":\"E\"") == 2);
+
+    backend.EndMarker(outer);
+
+    // Next export reopens scope and contains only events recorded since previous export.
+    std::string const second = ExportChromeTrace(backend);
+    CHECK(CountOccurrences(second, "{\"name\":\"Outer\",\"ph\":\"B\"") == 1);
+    CHECK(CountOccurrences(second, "{\"name\":\"Inner\",\"ph\":\"B\"") == 0);
+    CHECK(CountOccurrences(second, "\"ph\":\"E\"") == 1);
+
+    std::vector<double> const timestamps = GetTimestamps(second, CurrentThread::Id());
+    REQUIRE(timestamps.size() == 2);
+    CHECK(timestamps[0] <= timestamps[1]);
+
+    std::string const third = ExportChromeTrace(backend);
+    CHECK(CountOccurrences(third, "\"ph\":\"B\"") == 0);
+    CHECK(CountOccurrences(third, "\"ph\":\"E\"") == 0);
+    CHECK(backend.GetDroppedCount() == 0);
+}
+
+namespace
+{
+    AE_DECLARE_PROFILE(ProfilerTestScope);
+}
+
+TEST_CASE("Profiler / InstrumentationProfilerBackend - Profiler")
+{
+    using namespace Anemone;
+
+    IProfilerBackend* const previous = Profiler::GetBackend();
+
+    // Built-in backend is installed by default.
+    CHECK(dynamic_cast<InstrumentationProfilerBackend*>(previous) != nullptr);
+    CHECK(Profiler::GetThreadName() == "Main");
+
+    InstrumentationProfilerBackend backend{};
+    Profiler::SetBackend(&backend);
+
+    Profiler::BeginFrame();
+    {
+        AE_PROFILE_SCOPE(ProfilerTestScope);
+    }
+    Profiler::EndFrame();
+
+    Profiler::SetBackend(previous);
+
+    std::string const trace = ExportChromeTrace(backend);
+    CHECK(trace.find("\"args\":{\"name\":\"Main\"}") != std::string::npos);
+    CHECK(CountOccurrences(trace, "{\"name\":\"ProfilerTestScope\",\"ph\":\"B\"") == 1);
+    CHECK(CountOccurrences(trace, "{\"name\":\"Frame\",\"ph\":\"B\"") == 1);
+    CHECK(CountOccurrences(trace, "\"ph\":\"E\"") == 2);
+}
+
+
+namespace
+{
+    AE_DECLARE_PROFILE(ProfilerTestMemory);
+    AE_DECLARE_PROFILE_COUNTER(ProfilerTestDepth, int64_t, Instantaneous);
+    AE_DECLARE_PROFILE_COUNTER(ProfilerTestBytes, double, Cumulative);
+
+    class EmptyTask final : public Anemone::Task
+    {
+    protected:
+        void OnExecute() override
+        {
+        }
+    };
+}
+
+TEST_CASE("Profiler / InstrumentationProfilerBackend - Counters, memory and flows")
+{
+    using namespace Anemone;
+
+    IProfilerBackend* const previous = Profiler::GetBackend();
+
+    InstrumentationProfilerBackend backend{};
+    Profiler::SetBackend(&backend);
+
+    SECTION("Counters")
+    {
+        AE_PROFILE_COUNTER_SET(ProfilerTestDepth, 7);
+        AE_PROFILE_COUNTER_SET(ProfilerTestDepth, -3);
+
+        // Cumulative counters report running total.
+        AE_PROFILE_COUNTER_ADD(ProfilerTestBytes, 1.5);
+        AE_PROFILE_COUNTER_ADD(ProfilerTestBytes, 2.0);
+
+        Profiler::SetBackend(previous);
+
+        CHECK(GProfilerCounter_ProfilerTestDepth.Value() == -3);
+        CHECK(GProfilerCounter_ProfilerTestBytes.Value() == 3.5);
+
+        std::string const trace = ExportChromeTrace(backend);
+        CHECK(CountOccurrences(trace, "{\"name\":\"ProfilerTestDepth\",\"ph\":\"C\"") == 2);
+        CHECK(trace.find("\"args\":{\"value\":7}}") != std::string::npos);
+        CHECK(trace.find("\"args\":{\"value\":-3}}") != std::string::npos);
+        CHECK(trace.find("\"args\":{\"value\":1.5}}") != std::string::npos);
+        CHECK(trace.find("\"args\":{\"value\":3.5}}") != std::string::npos);
+    }
+
+    SECTION("Memory")
+    {
+        std::array<std::byte, 48> storage{};
+
+        AE_PROFILE_ALLOCATE(ProfilerTestMemory, storage.data(), storage.size());
+        AE_PROFILE_FREE(ProfilerTestMemory, storage.data());
+
+        Profiler::SetBackend(previous);
+
+        std::string const trace = ExportChromeTrace(backend);
+        std::string const address = fmt::format("\"address\":\"{}\"", static_cast<void const*>(storage.data()));
+
+        CHECK(CountOccurrences(trace, "{\"name\":\"ProfilerTestMemory\",\"cat\":\"memory\",\"ph\":\"i\"") == 2);
+        CHECK(trace.find(fmt::format("\"operation\":\"allocate\",{},\"size\":48}}", address)) != std::string::npos);
+        CHECK(trace.find(fmt::format("\"operation\":\"free\",{}}}", address)) != std::string::npos);
+    }
+
+    SECTION("Task flows")
+    {
+        {
+            DefaultTaskScheduler scheduler{1};
+
+            TaskAwaiterHandle const none = MakeReference<TaskAwaiter>();
+            TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+
+            for (size_t i = 0; i < 4; ++i)
+            {
+                TaskHandle const task = MakeReference<EmptyTask>();
+                scheduler.Schedule(*task, join, none, TaskPriority::Normal);
+            }
+
+            scheduler.Wait(join);
+        }
+
+        Profiler::SetBackend(previous);
+
+        std::string const trace = ExportChromeTrace(backend);
+
+        // Each scheduled task is linked with its execution.
+        CHECK(CountOccurrences(trace, "{\"name\":\"TaskSchedule\",\"cat\":\"flow\",\"ph\":\"s\"") == 4);
+        CHECK(CountOccurrences(trace, "{\"name\":\"TaskSchedule\",\"cat\":\"flow\",\"ph\":\"f\",\"bp\":\"e\"") == 4);
+        CHECK(CountOccurrences(trace, "{\"name\":\"TaskExecute\",\"ph\":\"B\"") == 4);
+
+        // Workers sample number of tasks in flight; last sample is taken after all tasks completed.
+        size_t const sample = trace.rfind("{\"name\":\"TasksInFlight\",\"ph\":\"C\"");
+        REQUIRE(sample != std::string::npos);
+        CHECK(trace.find("\"args\":{\"value\":", sample) == trace.find("\"args\":{\"value\":0}}", sample));
+    }
+
+    Profiler::SetBackend(previous);
+}
+
+#endif
@@ -0,0 +1,340 @@
+#include "AnemoneRuntime.Storage/DirectIoBuffer.hxx"
+#include "AnemoneRuntime.Storage/FileIoQueue.hxx"
+#include "AnemoneRuntime.Storage/FilePath.hxx"
+#include "AnemoneRuntime.Storage/FileSystem.hxx"
+#include "AnemoneRuntime.Storage/PackageFileSystem.hxx"
+#include "AnemoneRuntime.Storage/PackageWriter.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
+#include "AnemoneRuntime.Tasks/DefaultTaskScheduler.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <vector>
+
+TEST_CASE("Storage / FileIoQueue")
+{
+    using namespace Anemone;
+
+    DefaultTaskScheduler scheduler{2};
+
+    bool const threadPool = GENERATE(false, true);
+
+    FileIoQueueOptions const options{
+        .QueueDepth = 8,
+        .ThreadCount = 3,
+    };
+
+    std::unique_ptr<FileIoQueue> const queue = threadPool
+        ? FileIoQueue::CreateThreadPool(scheduler, options)
+        : FileIoQueue::Create(scheduler, options);
+
+    REQUIRE(queue);
+    INFO("backend = " << queue->GetBackendName());
+
+    std::string path{Environment::GetTemporaryPath()};
+    FilePath::PushFragment(path, "Anemone.FileIoQueue.bin");
+
+    // More blocks than queue depth, so some of them wait in queue.
+    constexpr size_t BlockSize = 4096;
+    constexpr size_t BlockCount = 100;
+
+    std::vector<std::byte> source(BlockSize * BlockCount);
+
+    for (size_t i = 0; i < source.size(); ++i)
+    {
+        source[i] = static_cast<std::byte>((i * 7u) ^ (i >> 12u));
+    }
+
+    constexpr FileIoPriority priorities[]{FileIoPriority::High, FileIoPriority::Normal, FileIoPriority::Low};
+
+    {
+        auto writer = FileSystem::GetPlatformFileSystem().CreateFileWriter(path);
+        REQUIRE(writer);
+
+        std::vector<FileIoRequest> requests{};
+
+        for (size_t i = 0; i < BlockCount; ++i)
+        {
+            requests.push_back(FileIoRequest{
+                .Operation = FileIoOperation::Write,
+                .File = *writer,
+                .Position = i * BlockSize,
+                .Buffer = std::span{source}.subspan(i * BlockSize, BlockSize),
+                .Priority = priorities[i % std::size(priorities)],
+            });
+        }
+
+        scheduler.Wait(queue->Submit(requests));
+
+        REQUIRE((*writer)->GetLength().value_or(0) == source.size());
+    }
+
+    {
+        auto reader = FileSystem::GetPlatformFileSystem().CreateFileReader(path);
+        REQUIRE(reader);
+
+        std::vector<std::byte> destination(source.size() + BlockSize);
+
+        std::atomic_size_t transferred{};
+        std::atomic_size_t completed{};
+        std::atomic_size_t failures{};
+
+        std::vector<FileIoRequest> requests{};
+
+        // Last request reads past end of file.
+        for (size_t i = 0; i <= BlockCount; ++i)
+        {
+            requests.push_back(FileIoRequest{
+                .Operation = FileIoOperation::Read,
+                .File = *reader,
+                .Position = i * BlockSize,
+                .Buffer = std::span{destination}.subspan(i * BlockSize, BlockSize),
+                .Priority = priorities[i % std::size(priorities)],
+                .Completion = [&](std::expected<size_t, Error> result)
+                {
+                    if (result)
+                    {
+                        transferred.fetch_add(*result);
+                    }
+                    else
+                    {
+                        failures.fetch_add(1);
+                    }
+
+                    completed.fetch_add(1);
+                },
+            });
+        }
+
+        TaskAwaiterHandle const awaiter = queue->Submit(requests);
+
+        // Batch awaiter may be dependency of other tasks.
+        std::atomic_size_t observed{};
+
+        TaskAwaiterHandle const done = MakeReference<TaskAwaiter>();
+
+        class ObserveTask final : public Task
+        {
+        public:
+            std::atomic_size_t& Source;
+            std::atomic_size_t& Target;
+
+            ObserveTask(std::atomic_size_t& source, std::atomic_size_t& target)
+                : Source{source}
+                , Target{target}
+            {
+            }
+
+        protected:
+            void OnExecute() override
+            {
+                this->Target.store(this->Source.load());
+            }
+        };
+
+        TaskHandle const observer = MakeReference<ObserveTask>(completed, observed);
+        scheduler.Schedule(*observer, done, awaiter, TaskPriority::Normal);
+        scheduler.Wait(done);
+
+        REQUIRE(awaiter->IsCompleted());
+        REQUIRE(observed.load() == (BlockCount + 1));
+        REQUIRE(failures.load() == 0);
+        REQUIRE(transferred.load() == source.size());
+        REQUIRE(std::equal(source.begin(), source.end(), destination.begin()));
+    }
+
+    {
+        auto reader = FileSystem::GetPlatformFileSystem().CreateFileReader(path);
+        REQUIRE(reader);
+
+        class IncrementTask final : public Task
+        {
+        public:
+            std::atomic_size_t& Counter;
+
+            explicit IncrementTask(std::atomic_size_t& counter)
+                : Counter{counter}
+            {
+            }
+
+        protected:
+            void OnExecute() override
+            {
+                this->Counter.fetch_add(1);
+            }
+        };
+
+        // Single reads without completion callbacks; only completion of request releases dependent task.
+        for (size_t i = 0; i < 32; ++i)
+        {
+            std::vector<std::byte> destination(BlockSize);
+
+            FileIoRequest request{
+                .Operation = FileIoOperation::Read,
+                .File = *reader,
+                .Position = i * BlockSize,
+                .Buffer = destination,
+            };
+
+            TaskAwaiterHandle const awaiter = queue->Submit(std::span{&request, 1});
+
+            std::atomic_size_t executed{};
+            TaskAwaiterHandle const done = MakeReference<TaskAwaiter>();
+            TaskHandle const dependent = MakeReference<IncrementTask>(executed);
+            scheduler.Schedule(*dependent, done, awaiter, TaskPriority::Normal);
+            scheduler.Wait(done);
+
+            REQUIRE(executed.load() == 1);
+            REQUIRE(std::equal(destination.begin(), destination.end(), source.begin() + static_cast<ptrdiff_t>(i * BlockSize)));
+        }
+    }
+
+    // Empty batch completes immediately.
+    REQUIRE(queue->Submit(std::span<FileIoRequest>{})->IsCompleted());
+
+    REQUIRE(FileSystem::GetPlatformFileSystem().FileDelete(path));
+}
+
+TEST_CASE("Storage / FileIoQueue - Handles")
+{
+    using namespace Anemone;
+
+    DefaultTaskScheduler scheduler{2};
+
+    std::unique_ptr<FileIoQueue> const queue = FileIoQueue::Create(scheduler, FileIoQueueOptions{.QueueDepth = 8});
+    REQUIRE(queue);
+    INFO("backend = " << queue->GetBackendName());
+
+    FileSystem& platform = FileSystem::GetPlatformFileSystem();
+
+    std::string root{Environment::GetTemporaryPath()};
+    FilePath::PushFragment(root, "Anemone.FileIoQueue.Handles");
+
+    (void)platform.DirectoryDeleteRecursive(root);
+    REQUIRE(platform.DirectoryCreateRecursive(root));
+
+    std::vector<std::byte> source(100'000);
+
+    for (size_t i = 0; i < source.size(); ++i)
+    {
+        source[i] = static_cast<std::byte>((i * 13u) ^ (i >> 8u));
+    }
+
+    SECTION("Package")
+    {
+        std::string packagePath = root;
+        FilePath::PushFragment(packagePath, "Test.apak");
+
+        {
+            PackageWriter writer{PackageWriterOptions{.BlockSize = 16u << 10u}};
+            REQUIRE(writer.AddFile("Data.bin", source));
+            REQUIRE(writer.Save(platform, packagePath));
+        }
+
+        std::string mountPoint = root;
+        FilePath::PushFragment(mountPoint, "Content");
+
+        auto mounted = PackageFileSystem::Mount(packagePath, mountPoint, &platform);
+        REQUIRE(mounted);
+
+        std::string filePath = mountPoint;
+        FilePath::PushFragment(filePath, "Data.bin");
+
+        // Package handle has no native handle; queue executes its reads through handle.
+        auto reader = (*mounted)->CreateFileReader(filePath);
+        REQUIRE(reader);
+
+        std::vector<std::byte> destination(40'000);
+
+        FileIoRequest request{
+            .Operation = FileIoOperation::Read,
+            .File = *reader,
+            .Position = 30'001,
+            .Buffer = destination,
+        };
+
+        std::expected<size_t, Error> processed = std::unexpected(Error::Failure);
+        request.Completion = [&](std::expected<size_t, Error> result)
+        {
+            processed = result;
+        };
+
+        scheduler.Wait(queue->Submit(std::move(request)));
+
+        REQUIRE(processed);
+        REQUIRE(*processed == destination.size());
+        REQUIRE(std::ranges::equal(destination, std::span{source}.subspan(30'001, destination.size())));
+    }
+
+    SECTION("Unbuffered")
+    {
+        std::string path = root;
+        FilePath::PushFragment(path, "Data.bin");
+
+        {
+            auto writer = platform.CreateFileWriter(path);
+            REQUIRE(writer);
+            REQUIRE((*writer)->Write(source) == source.size());
+        }
+
+        auto reader = platform.CreateFileReader(path, FileOption::NoBuffering);
+
+        if (not reader and (reader.error() == Error::NotSupported))
+        {
+            SKIP("Unbuffered I/O is not supported");
+        }
+
+        REQUIRE(reader);
+
+        // Unaligned requests go through bounce buffer of handle; aligned request is issued directly.
+        std::vector<std::byte> unaligned(10'001);
+        DirectIoBuffer aligned{DirectIoBuffer::GetAlignment()};
+
+        std::array<std::expected<size_t, Error>, 2> processed{
+            std::unexpected(Error::Failure),
+            std::unexpected(Error::Failure),
+        };
+
+        std::array requests{
+            FileIoRequest{
+                .Operation = FileIoOperation::Read,
+                .File = *reader,
+                .Position = 777,
+                .Buffer = std::span{unaligned}.subspan(1),
+                .Completion = [&](std::expected<size_t, Error> result)
+                {
+                    processed[0] = result;
+                },
+            },
+            FileIoRequest{
+                .Operation = FileIoOperation::Read,
+                .File = *reader,
+                .Position = 0,
+                .Buffer = aligned.GetView(),
+                .Completion = [&](std::expected<size_t, Error> result)
+                {
+                    processed[1] = result;
+                },
+            },
+        };
+
+        scheduler.Wait(queue->Submit(requests));
+
+        REQUIRE(processed[0]);
+        REQUIRE(*processed[0] == 10'000);
+        REQUIRE(std::ranges::equal(std::span{unaligned}.subspan(1), std::span{source}.subspan(777, 10'000)));
+
+        REQUIRE(processed[1]);
+        REQUIRE(*processed[1] == aligned.GetView().size());
+        REQUIRE(std::ranges::equal(aligned.GetView(), std::span{source}.first(aligned.GetView().size())));
+    }
+
+    REQUIRE(platform.DirectoryDeleteRecursive(root));
+}
@@ -0,0 +1,236 @@
+#include "AnemoneRuntime.Storage/FileSystem.hxx"
+#include "AnemoneRuntime.Storage/FilePath.hxx"
+#include "AnemoneRuntime.Storage/DirectIoBuffer.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <fmt/format.h>
+
+#include <string>
+
+namespace
+{
+    Anemone::Reference<Anemone::MemoryBuffer> MakeContent(size_t size, size_t seed)
+    {
+        auto buffer = Anemone::MemoryBuffer::Create(size);
+        REQUIRE(buffer);
+
+        std::span<std::byte> const view = (*buffer)->GetView();
+
+        for (size_t i = 0; i < view.size(); ++i)
+        {
+            view[i] = static_cast<std::byte>((i * 13u) + seed);
+        }
+
+        return *buffer;
+    }
+
+    bool HasContent(std::string_view path, Anemone::MemoryBuffer const& expected)
+    {
+        auto const content = Anemone::FileSystem::GetPlatformFileSystem().ReadBinaryFile(path);
+
+        if (not content)
+        {
+            return false;
+        }
+
+        std::span<std::byte const> const actual = (*content)->GetView();
+        std::span<std::byte const> const reference = expected.GetView();
+        return std::ranges::equal(actual, reference);
+    }
+}
+
+TEST_CASE("Storage / FileSystem - Copy")
+{
+    using namespace Anemone;
+
+    FileSystem& fs = FileSystem::GetPlatformFileSystem();
+
+    std::string root{Environment::GetTemporaryPath()};
+    FilePath::PushFragment(root, "Anemone.FileSystem.Copy");
+
+    (void)fs.DirectoryDeleteRecursive(root);
+
+    std::string source = root;
+    FilePath::PushFragment(source, "Source/Nested/Deep");
+    REQUIRE(fs.DirectoryCreateRecursive(source));
+    REQUIRE(fs.DirectoryCreateRecursive(source));
+
+    FilePath::PopFragment(source);
+    FilePath::PopFragment(source);
+
+    // Empty, small, and larger than single copy chunk of buffered fallback.
+    constexpr size_t sizes[]{0, 1, 4097, (size_t{3} << 20u) + 5};
+    constexpr std::string_view directories[]{"", "Nested", "Nested/Deep"};
+
+    std::vector<std::pair<std::string, Reference<MemoryBuffer>>> files{};
+
+    for (std::string_view const directory : directories)
+    {
+        for (size_t i = 0; i < std::size(sizes); ++i)
+        {
+            std::string relative{directory};
+            FilePath::PushFragment(relative, fmt::format("File{}.bin", i));
+
+            std::string path = source;
+            FilePath::PushFragment(path, relative);
+
+            Reference<MemoryBuffer> content = MakeContent(sizes[i], files.size());
+            REQUIRE(fs.WriteBinaryFile(path, *content));
+
+            files.emplace_back(std::move(relative), std::move(content));
+        }
+    }
+
+    SECTION("File")
+    {
+        std::string const& from = files.back().first;
+
+        std::string sourcePath = source;
+        FilePath::PushFragment(sourcePath, from);
+
+        std::string destinationPath = root;
+        FilePath::PushFragment(destinationPath, "Copy.bin");
+
+        REQUIRE(fs.FileCopy(sourcePath, destinationPath, NameCollisionResolve::Fail));
+        REQUIRE(HasContent(destinationPath, *files.back().second));
+
+        REQUIRE_FALSE(fs.FileCopy(sourcePath, destinationPath, NameCollisionResolve::Fail));
+
+        // Overwriting truncates longer destination.
+        std::string smallPath = source;
+        FilePath::PushFragment(smallPath, files[1].first);
+
+        REQUIRE(fs.FileCopy(smallPath, destinationPath, NameCollisionResolve::Overwrite));
+        REQUIRE(HasContent(destinationPath, *files[1].second));
+    }
+
+    SECTION("Directory")
+    {
+        std::string destination = root;
+        FilePath::PushFragment(destination, "Destination/Tree");
+
+        REQUIRE(fs.DirectoryCopyRecursive(source, destination, NameCollisionResolve::Fail));
+
+        for (auto const& [relative, content] : files)
+        {
+            std::string path = destination;
+            FilePath::PushFragment(path, relative);
+
+            INFO("path = " << path);
+            REQUIRE(HasContent(path, *content));
+        }
+
+        REQUIRE_FALSE(fs.DirectoryCopyRecursive(source, destination, NameCollisionResolve::Fail));
+        REQUIRE(fs.DirectoryCopyRecursive(source, destination, NameCollisionResolve::Overwrite));
+    }
+
+    REQUIRE(fs.DirectoryDeleteRecursive(root));
+    REQUIRE_FALSE(fs.DirectoryExists(root));
+}
+
+TEST_CASE("Storage / FileSystem - Unbuffered")
+{
+    using namespace Anemone;
+
+    FileSystem& fs = FileSystem::GetPlatformFileSystem();
+
+    std::string path{Environment::GetTemporaryPath()};
+    FilePath::PushFragment(path, "Anemone.FileSystem.Unbuffered.bin");
+
+    constexpr size_t size = (size_t{3} << 20u) + 1234;
+    Reference<MemoryBuffer> const content = MakeContent(size, 7);
+
+    if (auto const probe = fs.CreateFileWriter(path, FileOption::NoBuffering); not probe and (probe.error() == Error::NotSupported))
+    {
+        SKIP("Unbuffered I/O is not supported");
+    }
+
+    SECTION("Read")
+    {
+        REQUIRE(fs.WriteBinaryFile(path, *content));
+
+        auto reader = fs.CreateFileReader(path, FileOption::NoBuffering);
+        REQUIRE(reader);
+
+        size_t const alignment = (*reader)->GetIoAlignment();
+        REQUIRE(alignment != 0);
+        REQUIRE(DirectIoBuffer::GetAlignment() % alignment == 0);
+
+        std::span<std::byte const> const expected = content->GetView();
+
+        // Aligned request goes directly to storage.
+        DirectIoBuffer aligned{size};
+        auto processed = (*reader)->ReadAt(aligned.GetView(), 0);
+        REQUIRE(processed);
+        REQUIRE(*processed == size);
+        REQUIRE(std::ranges::equal(aligned.GetView().first(size), expected));
+
+        // Unaligned offset, length and buffer address.
+        std::vector<std::byte> unaligned(size);
+
+        for (auto [offset, length] : {std::pair<size_t, size_t>{1, 17}, {4095, 2}, {513, (size_t{2} << 20u) + 3}, {size - 10, 100}})
+        {
+            processed = (*reader)->ReadAt(std::span{unaligned}.subspan(1, std::min(length, size - 1)), offset);
+            REQUIRE(processed);
+
+            size_t const available = std::min({length, size - 1, size - offset});
+            REQUIRE(*processed == available);
+            REQUIRE(std::ranges::equal(std::span{unaligned}.subspan(1, available), expected.subspan(offset, available)));
+        }
+
+        processed = (*reader)->ReadAt(std::span{unaligned}.first(16), size + 1);
+        REQUIRE(processed);
+        REQUIRE(*processed == 0);
+
+        // Sequential reads keep file position.
+        REQUIRE((*reader)->SetPosition(0));
+
+        std::span<std::byte> remaining{unaligned};
+
+        while (not remaining.empty())
+        {
+            processed = (*reader)->Read(remaining.first(std::min<size_t>(remaining.size(), 100'001)));
+            REQUIRE(processed);
+            REQUIRE(*processed != 0);
+            remaining = remaining.subspan(*processed);
+        }
+
+        REQUIRE(std::ranges::equal(unaligned, expected));
+        REQUIRE((*reader)->GetPosition() == size);
+    }
+
+    SECTION("Write")
+    {
+        {
+            auto writer = fs.CreateFileWriter(path, FileOption::NoBuffering);
+            REQUIRE(writer);
+
+            size_t const alignment = (*writer)->GetIoAlignment();
+
+            // Tail of file is written padded, then file is truncated to its length.
+            DirectIoBuffer buffer{size};
+            std::ranges::copy(content->GetView(), buffer.GetData());
+
+            size_t const padded = (size + alignment - 1) & ~(alignment - 1);
+            auto const processed = (*writer)->Write(buffer.GetView().first(padded));
+            REQUIRE(processed);
+            REQUIRE(*processed == padded);
+            REQUIRE((*writer)->SetLength(size));
+
+            if (alignment > 1)
+            {
+                REQUIRE_FALSE((*writer)->WriteAt(buffer.GetView().subspan(1, 10), 3));
+            }
+        }
+
+        REQUIRE(HasContent(path, *content));
+    }
+
+    REQUIRE(fs.FileDelete(path));
+}
@@ -0,0 +1,149 @@
+#include "AnemoneRuntime.Storage/MemoryMappedFile.hxx"
+#include "AnemoneRuntime.Storage/FilePath.hxx"
+#include "AnemoneRuntime.Storage/FileSystem.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <limits>
+#include <string>
+
+TEST_CASE("Storage / MemoryMappedFile")
+{
+    using namespace Anemone;
+
+    std::string path{Environment::GetTemporaryPath()};
+    FilePath::PushFragment(path, "Anemone.MemoryMappedFile.bin");
+
+    // Spans several huge pages and ends in middle of page.
+    constexpr size_t Capacity = (size_t{5} << 20u) + 1234;
+
+    auto pattern = [](size_t index)
+    {
+        return static_cast<std::byte>((index * 31u) ^ (index >> 12u));
+    };
+
+    {
+        Reference<MemoryMappedFile> const file = MemoryMappedFile::Create(path, FileMode::Create, Capacity, MemoryMappedFileAccess::ReadWrite);
+        REQUIRE(file);
+
+        Reference<MemoryMappedFileView> const view = file->CreateView(MemoryMappedFileAccess::ReadWrite);
+        REQUIRE(view);
+
+        std::span<std::byte> const data = view->GetData();
+        REQUIRE(data.size() == Capacity);
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = pattern(i);
+        }
+
+        view->Flush();
+        file->Flush();
+    }
+
+    SECTION("Read with hints")
+    {
+        Reference<MemoryMappedFile> const file = MemoryMappedFile::Create(path, FileMode::Open, 0, MemoryMappedFileAccess::Read);
+        REQUIRE(file);
+
+        // Read-only file can't be mapped for writing.
+        REQUIRE_FALSE(file->CreateView(MemoryMappedFileAccess::ReadWrite));
+
+        Flags<MemoryMappedFileViewOption> const options[]{
+            MemoryMappedFileViewOption::None,
+            MemoryMappedFileViewOption::Populate,
+            Flags{MemoryMappedFileViewOption::SequentialAccess} | MemoryMappedFileViewOption::WillNeed,
+            MemoryMappedFileViewOption::RandomAccess,
+            MemoryMappedFileViewOption::HugePages,
+        };
+
+        for (Flags<MemoryMappedFileViewOption> const option : options)
+        {
+            Reference<MemoryMappedFileView> const view = file->CreateView(MemoryMappedFileAccess::Read, 0, 0, option);
+            REQUIRE(view);
+
+            std::span<std::byte const> const data = std::as_const(*view).GetData();
+            REQUIRE(data.size() == Capacity);
+
+            view->Prefetch(Capacity / 2, Capacity / 4);
+
+            size_t mismatches = 0;
+
+            for (size_t i = 0; i < data.size(); ++i)
+            {
+                mismatches += (data[i] != pattern(i));
+            }
+
+            REQUIRE(mismatches == 0);
+        }
+    }
+
+    SECTION("Unaligned view")
+    {
+        Reference<MemoryMappedFile> const file = MemoryMappedFile::Create(path, FileMode::Open, 0, MemoryMappedFileAccess::Read);
+        REQUIRE(file);
+
+        constexpr size_t Offset = (size_t{2} << 20u) + 4097;
+
+        Reference<MemoryMappedFileView> const tail = file->CreateView(MemoryMappedFileAccess::Read, Offset, 0, MemoryMappedFileViewOption::HugePages);
+        REQUIRE(tail);
+        REQUIRE(tail->GetData().size() == (Capacity - Offset));
+        REQUIRE(tail->GetData().front() == pattern(Offset));
+        REQUIRE(tail->GetData().back() == pattern(Capacity - 1));
+
+        Reference<MemoryMappedFileView> const range = file->CreateView(MemoryMappedFileAccess::Read, 100, 1000);
+        REQUIRE(range);
+        REQUIRE(range->GetData().size() == 1000);
+        REQUIRE(range->GetData()[0] == pattern(100));
+        REQUIRE(range->GetData()[999] == pattern(1099));
+
+        REQUIRE_FALSE(file->CreateView(MemoryMappedFileAccess::Read, Capacity + 1));
+
+        // Views must be within file.
+        REQUIRE(file->CreateView(MemoryMappedFileAccess::Read, Capacity - 10, 10));
+        REQUIRE_FALSE(file->CreateView(MemoryMappedFileAccess::Read, Capacity - 10, 11));
+        REQUIRE_FALSE(file->CreateView(MemoryMappedFileAccess::Read, 0, Capacity + 1));
+        REQUIRE_FALSE(file->CreateView(MemoryMappedFileAccess::Read, 100, std::numeric_limits<size_t>::max()));
+    }
+
+    SECTION("Copy on write")
+    {
+        {
+            Reference<MemoryMappedFile> const file = MemoryMappedFile::Create(path, FileMode::Open, 0, MemoryMappedFileAccess::CopyOnWrite);
+            REQUIRE(file);
+
+            Reference<MemoryMappedFileView> const view = file->CreateView(MemoryMappedFileAccess::CopyOnWrite);
+            REQUIRE(view);
+
+            view->GetData()[0] = ~pattern(0);
+            REQUIRE(view->GetData()[0] == ~pattern(0));
+        }
+
+        // Private modifications are not written back.
+        auto const content = FileSystem::GetPlatformFileSystem().ReadBinaryFile(path);
+        REQUIRE(content);
+        REQUIRE((*content)->GetView().size() == Capacity);
+        REQUIRE((*content)->GetView()[0] == pattern(0));
+    }
+
+    // Create without write access is rejected before existing file is truncated.
+    for (MemoryMappedFileAccess const access : {MemoryMappedFileAccess::Read, MemoryMappedFileAccess::CopyOnWrite})
+    {
+        REQUIRE_FALSE(MemoryMappedFile::Create(path, FileMode::Create, Capacity, access));
+
+        auto const info = FileSystem::GetPlatformFileSystem().GetPathInfo(path);
+        REQUIRE(info);
+        REQUIRE(info->Size == Capacity);
+    }
+
+    REQUIRE(FileSystem::GetPlatformFileSystem().FileDelete(path));
+
+    // Missing file is not created by open.
+    REQUIRE_FALSE(MemoryMappedFile::Create(path, FileMode::Open, 0, MemoryMappedFileAccess::Read));
+    REQUIRE_FALSE(FileSystem::GetPlatformFileSystem().FileExists(path));
+}
@@ -0,0 +1,245 @@
+#include "AnemoneRuntime.Storage/PackageFileSystem.hxx"
+#include "AnemoneRuntime.Storage/PackageWriter.hxx"
+#include "AnemoneRuntime.Storage/FilePath.hxx"
+#include "AnemoneRuntime.System/Environment.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector<std::byte> MakeCompressible(size_t size)
+    {
+        std::vector<std::byte> result(size);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            result[i] = static_cast<std::byte>((i / 64) % 7);
+        }
+
+        return result;
+    }
+
+    std::vector<std::byte> MakeRandom(size_t size)
+    {
+        std::mt19937 generator{1234};
+        std::vector<std::byte> result(size);
+
+        for (std::byte& value : result)
+        {
+            value = static_cast<std::byte>(generator());
+        }
+
+        return result;
+    }
+
+    std::vector<std::byte> AsBytes(std::string_view value)
+    {
+        auto const bytes = std::as_bytes(std::span{value});
+        return {bytes.begin(), bytes.end()};
+    }
+
+    class CollectingVisitor final : public Anemone::FileSystemVisitor
+    {
+    public:
+        std::map<std::string, Anemone::FileType> Items{};
+
+        void Visit(std::string_view path, std::string_view name, Anemone::FileInfo const& info) override
+        {
+            std::string full{path};
+            Anemone::FilePath::PushFragment(full, name);
+            this->Items.emplace(std::move(full), info.Type);
+        }
+    };
+}
+
+TEST_CASE("Storage / Package - Path Normalization")
+{
+    using namespace Anemone;
+
+    auto normalize = [](std::string_view value)
+    {
+        std::string result{value};
+        NormalizePackagePath(result);
+        return result;
+    };
+
+    CHECK(normalize("") == "");
+    CHECK(normalize("/") == "");
+    CHECK(normalize("a") == "a");
+    CHECK(normalize("/a/b/") == "a/b");
+    CHECK(normalize("a//b\\c") == "a/b/c");
+    CHECK(normalize("./a/./b/.") == "a/b");
+    CHECK(normalize("a/b/../c") == "a/c");
+    CHECK(normalize("a/../../b") == "b");
+    CHECK(HashPackagePath(normalize("A/B")) != HashPackagePath(normalize("a/b")));
+}
+
+TEST_CASE("Storage / Package - File System")
+{
+    using namespace Anemone;
+
+    FileSystem& platform = FileSystem::GetPlatformFileSystem();
+
+    std::string root{Environment::GetTemporaryPath()};
+    FilePath::PushFragment(root, "Anemone.Package");
+
+    (void)platform.DirectoryDeleteRecursive(root);
+
+    std::string mountPoint = root;
+    FilePath::PushFragment(mountPoint, "Content");
+    REQUIRE(platform.DirectoryCreateRecursive(mountPoint + "/Shared"));
+
+    auto loosePath = [&](std::string_view relative)
+    {
+        std::string result = mountPoint;
+        FilePath::PushFragment(result, relative);
+        return result;
+    };
+
+    // Loose files, one of them shadowed by package.
+    REQUIRE(platform.WriteTextFile(loosePath("Loose.txt"), "loose"));
+    REQUIRE(platform.WriteTextFile(loosePath("Shared/Override.txt"), "loose version"));
+
+    std::map<std::string, std::vector<std::byte>> files{
+        {"Textures/Stone.bin", MakeCompressible(300'000)},
+        {"Textures/Noise.bin", MakeRandom(100'000)},
+        {"Config/Game.ini", AsBytes("[Game]\nName=Test\n")},
+        {"Shared/Override.txt", AsBytes("package version")},
+        {"Empty.bin", {}},
+    };
+
+    std::string packagePath = root;
+    FilePath::PushFragment(packagePath, "Test.apak");
+
+    {
+        PackageWriter writer{PackageWriterOptions{.BlockSize = 16u << 10u}};
+
+        for (auto const& [path, content] : files)
+        {
+            REQUIRE(writer.AddFile(path, content));
+        }
+
+        REQUIRE(writer.AddDirectory("Levels/Empty"));
+        REQUIRE_FALSE(writer.AddFile("Textures/Stone.bin", {}));
+        REQUIRE_FALSE(writer.AddFile("Config/Game.ini/Nested", {}));
+
+        REQUIRE(writer.Save(platform, packagePath));
+    }
+
+    auto mounted = PackageFileSystem::Mount(packagePath, mountPoint, &platform);
+    REQUIRE(mounted);
+
+    PackageFileSystem& package = **mounted;
+
+    SECTION("Lookup")
+    {
+        CHECK(package.FileExists(loosePath("Textures/Stone.bin")));
+        CHECK(package.FileExists(loosePath("./Textures//Stone.bin")));
+        CHECK_FALSE(package.FileExists(loosePath("Textures")));
+        CHECK(package.DirectoryExists(loosePath("Textures")));
+        CHECK(package.DirectoryExists(loosePath("Levels/Empty")));
+        CHECK(package.DirectoryExists(mountPoint));
+        CHECK_FALSE(package.FileExists(loosePath("Missing.bin")));
+
+        auto const info = package.GetPathInfo(loosePath("Textures/Noise.bin"));
+        REQUIRE(info);
+        CHECK(info->Type == FileType::File);
+        CHECK(info->Size == 100'000);
+        CHECK(info->ReadOnly);
+    }
+
+    SECTION("Read")
+    {
+        for (auto const& [path, content] : files)
+        {
+            INFO("path = " << path);
+
+            auto const buffer = package.ReadBinaryFile(loosePath(path));
+            REQUIRE(buffer);
+            REQUIRE(std::ranges::equal((*buffer)->GetView(), content));
+        }
+
+        std::vector<std::byte> const& expected = files["Textures/Stone.bin"];
+
+        auto handle = package.CreateFileReader(loosePath("Textures/Stone.bin"));
+        REQUIRE(handle);
+
+        // Reads within block and across block boundaries.
+        std::vector<std::byte> buffer(40'000);
+
+        for (auto [offset, length] : {std::pair<size_t, size_t>{0, 10}, {16'380, 10}, {5, 40'000}, {299'990, 100}})
+        {
+            auto const processed = (*handle)->ReadAt(std::span{buffer}.first(length), offset);
+            REQUIRE(processed);
+
+            size_t const available = std::min(length, expected.size() - offset);
+            REQUIRE(*processed == available);
+            REQUIRE(std::ranges::equal(std::span{buffer}.first(available), std::span{expected}.subspan(offset, available)));
+        }
+
+        REQUIRE_FALSE((*handle)->Write(std::as_bytes(std::span{buffer})));
+    }
+
+    SECTION("Overlay")
+    {
+        // Package shadows loose file.
+        CHECK(package.ReadTextFile(loosePath("Shared/Override.txt")) == "package version");
+
+        // Loose files are still visible.
+        CHECK(package.ReadTextFile(loosePath("Loose.txt")) == "loose");
+
+        // Package entries are read-only.
+        CHECK(package.CreateFileWriter(loosePath("Config/Game.ini")).error() == Error::AccessDenied);
+        CHECK(package.FileDelete(loosePath("Config/Game.ini")).error() == Error::AccessDenied);
+
+        // Writes outside of package go to underlying file system.
+        REQUIRE(package.WriteTextFile(loosePath("Saved.txt"), "saved"));
+        CHECK(platform.ReadTextFile(loosePath("Saved.txt")) == "saved");
+
+        CollectingVisitor shallow{};
+        REQUIRE(package.DirectoryEnumerate(mountPoint, shallow));
+
+        std::set<std::string> names{};
+
+        for (auto const& [path, type] : shallow.Items)
+        {
+            names.emplace(FilePath::GetFileName(path));
+        }
+
+        CHECK(names == std::set<std::string>{"Config", "Empty.bin", "Levels", "Loose.txt", "Saved.txt", "Shared", "Textures"});
+
+        CollectingVisitor deep{};
+        REQUIRE(package.DirectoryEnumerateRecursive(mountPoint, deep));
+
+        CHECK(deep.Items.size() == 12);
+        CHECK(deep.Items[loosePath("Textures/Noise.bin")] == FileType::File);
+        CHECK(deep.Items[loosePath("Levels/Empty")] == FileType::Directory);
+        CHECK(deep.Items.contains(loosePath("Shared/Override.txt")));
+    }
+
+    SECTION("Invalid Package")
+    {
+        std::string corruptedPath = root;
+        FilePath::PushFragment(corruptedPath, "Corrupted.apak");
+
+        REQUIRE(platform.WriteTextFile(corruptedPath, std::string(256, 'x')));
+
+        auto const corrupted = PackageFileSystem::Mount(corruptedPath, mountPoint);
+        REQUIRE_FALSE(corrupted);
+        CHECK(corrupted.error() == Error::InvalidHeader);
+    }
+
+    mounted->reset();
+
+    REQUIRE(platform.DirectoryDeleteRecursive(root));
+}
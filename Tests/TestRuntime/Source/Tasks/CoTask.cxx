@@ -0,0 +1,185 @@
+#include "AnemoneRuntime.Tasks/CoTask.hxx"
+#include "AnemoneRuntime.Tasks/DefaultTaskScheduler.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <atomic>
+#include <vector>
+
+namespace
+{
+    class IncrementTask final : public Anemone::Task
+    {
+    private:
+        std::atomic_size_t& m_Counter;
+
+    public:
+        explicit IncrementTask(std::atomic_size_t& counter)
+            : m_Counter{counter}
+        {
+        }
+
+    protected:
+        void OnExecute() override
+        {
+            this->m_Counter.fetch_add(1, std::memory_order::relaxed);
+        }
+    };
+
+    Anemone::CoTask<int> Square(int value)
+    {
+        co_return value * value;
+    }
+
+    Anemone::CoTask<int> SumOfSquares(int count)
+    {
+        int result = 0;
+
+        for (int i = 1; i <= count; ++i)
+        {
+            result += co_await Square(i);
+        }
+
+        co_return result;
+    }
+
+    Anemone::CoTask<> AwaitTasks(Anemone::TaskScheduler& scheduler, std::atomic_size_t& counter, size_t count, size_t& observed)
+    {
+        using namespace Anemone;
+
+        TaskAwaiterHandle const none = MakeReference<TaskAwaiter>();
+        TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            TaskHandle const task = MakeReference<IncrementTask>(counter);
+            scheduler.Schedule(*task, join, none, TaskPriority::Normal);
+        }
+
+        co_await join;
+
+        observed = counter.load(std::memory_order::relaxed);
+    }
+
+    Anemone::CoTask<size_t> YieldMany(size_t count)
+    {
+        size_t yields = 0;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            co_await Anemone::CoYield();
+            ++yields;
+        }
+
+        co_return yields;
+    }
+}
+
+TEST_CASE("Tasks / CoTask - Nested Await")
+{
+    using namespace Anemone;
+
+    DefaultTaskScheduler scheduler{0};
+
+    CoTask<int> task = SumOfSquares(10);
+    REQUIRE_FALSE(task.IsCompleted());
+
+    scheduler.Wait(task.Start(scheduler));
+
+    REQUIRE(task.IsCompleted());
+    REQUIRE(task.GetResult() == 385);
+}
+
+TEST_CASE("Tasks / CoTask - Await Task Awaiter")
+{
+    using namespace Anemone;
+
+    DefaultTaskScheduler scheduler{0};
+
+    std::atomic_size_t counter{};
+    size_t observed{};
+
+    CoTask<> task = AwaitTasks(scheduler, counter, 16, observed);
+    scheduler.Wait(task.Start(scheduler));
+
+    REQUIRE(task.IsCompleted());
+    REQUIRE(observed == 16);
+}
+
+TEST_CASE("Tasks / CoTask - Task Dependency")
+{
+    using namespace Anemone;
+
+    for (size_t workers : {0uz, 2uz})
+    {
+        DefaultTaskScheduler scheduler{workers};
+
+        for (size_t i = 0; i < 64; ++i)
+        {
+            std::atomic_size_t counter{};
+
+            CoTask<size_t> task = YieldMany(2);
+            TaskAwaiterHandle const completion = task.Start(scheduler);
+
+            // Task depending on coroutine is dispatched when coroutine finishes.
+            TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+            TaskHandle const dependent = MakeReference<IncrementTask>(counter);
+            scheduler.Schedule(*dependent, join, completion, TaskPriority::Normal);
+
+            scheduler.Wait(join);
+
+            REQUIRE(task.IsCompleted());
+            REQUIRE(counter.load() == 1);
+        }
+    }
+}
+
+TEST_CASE("Tasks / CoTask - Yield")
+{
+    using namespace Anemone;
+
+    DefaultTaskScheduler scheduler{0};
+
+    CoTask<size_t> task = YieldMany(8);
+    scheduler.Wait(task.Start(scheduler));
+
+    REQUIRE(task.GetResult() == 8);
+}
+
+TEST_CASE("Tasks / CoTask - Many In Flight")
+{
+    using namespace Anemone;
+
+    constexpr size_t count = 1000;
+
+    std::atomic_size_t counter{};
+    std::vector<size_t> observed(count);
+
+    std::vector<CoTask<>> tasks{};
+    std::vector<TaskAwaiterHandle> awaiters{};
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        tasks.push_back(AwaitTasks(TaskScheduler::Get(), counter, 4, observed[i]));
+        awaiters.push_back(tasks.back().Start());
+    }
+
+    for (TaskAwaiterHandle const& awaiter : awaiters)
+    {
+        TaskScheduler::Get().Wait(awaiter);
+    }
+
+    REQUIRE(counter.load() == count * 4);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        REQUIRE(tasks[i].IsCompleted());
+
+        // Each coroutine resumes only after its own tasks were executed.
+        REQUIRE(observed[i] >= 4);
+    }
+}
@@ -0,0 +1,489 @@
+#include "AnemoneRuntime.Tasks/DefaultTaskScheduler.hxx"
+#include "AnemoneRuntime.Tasks/Task.hxx"
+#include "AnemoneRuntime.Tasks/TaskAwaiter.hxx"
+#include "AnemoneRuntime.System/ProcessorProperties.hxx"
+#include "AnemoneRuntime.Base/ConsoleVariable.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <vector>
+
+namespace
+{
+    // Recursively spawns two children until depth is exhausted, then joins them.
+    class ForkJoinTask final : public Anemone::Task
+    {
+    private:
+        Anemone::TaskScheduler& m_Scheduler;
+        std::atomic_size_t& m_Executed;
+        uint32_t m_Depth;
+
+    public:
+        ForkJoinTask(Anemone::TaskScheduler& scheduler, std::atomic_size_t& executed, uint32_t depth)
+            : m_Scheduler{scheduler}
+            , m_Executed{executed}
+            , m_Depth{depth}
+        {
+        }
+
+    protected:
+        void OnExecute() override
+        {
+            using namespace Anemone;
+
+            this->m_Executed.fetch_add(1, std::memory_order::relaxed);
+
+            if (this->m_Depth != 0)
+            {
+                TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+                TaskAwaiterHandle const fork = MakeReference<TaskAwaiter>();
+
+                for (size_t i = 0; i < 2; ++i)
+                {
+                    TaskHandle const child = MakeReference<ForkJoinTask>(this->m_Scheduler, this->m_Executed, this->m_Depth - 1);
+                    this->m_Scheduler.Schedule(*child, join, fork, TaskPriority::Normal);
+                }
+
+                this->m_Scheduler.Wait(join);
+            }
+        }
+    };
+
+    // Records own priority in execution order.
+    class RecordPriorityTask final : public Anemone::Task
+    {
+    private:
+        std::vector<Anemone::TaskPriority>& m_Order;
+
+    public:
+        explicit RecordPriorityTask(std::vector<Anemone::TaskPriority>& order)
+            : m_Order{order}
+        {
+        }
+
+    protected:
+        void OnExecute() override
+        {
+            this->m_Order.push_back(this->GetPriority());
+        }
+    };
+
+    class CountTask final : public Anemone::Task
+    {
+    private:
+        std::atomic_size_t& m_Counter;
+
+    public:
+        explicit CountTask(std::atomic_size_t& counter)
+            : m_Counter{counter}
+        {
+        }
+
+    protected:
+        void OnExecute() override
+        {
+            this->m_Counter.fetch_add(1, std::memory_order::relaxed);
+        }
+    };
+
+    // Blocks worker until released, keeping dependent tasks pending.
+    class GateTask final : public Anemone::Task
+    {
+    private:
+        std::atomic_bool& m_Released;
+
+    public:
+        explicit GateTask(std::atomic_bool& released)
+            : m_Released{released}
+        {
+        }
+
+    protected:
+        void OnExecute() override
+        {
+            while (not this->m_Released.load())
+            {
+            }
+        }
+    };
+
+    // Schedules single child with inherited priority.
+    class InheritPriorityTask final : public Anemone::Task
+    {
+    private:
+        Anemone::TaskScheduler& m_Scheduler;
+        std::vector<Anemone::TaskPriority>& m_Order;
+
+    public:
+        InheritPriorityTask(Anemone::TaskScheduler& scheduler, std::vector<Anemone::TaskPriority>& order)
+            : m_Scheduler{scheduler}
+            , m_Order{order}
+        {
+        }
+
+    protected:
+        void OnExecute() override
+        {
+            using namespace Anemone;
+
+            TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+            TaskAwaiterHandle const none = MakeReference<TaskAwaiter>();
+
+            TaskHandle const child = MakeReference<RecordPriorityTask>(this->m_Order);
+            this->m_Scheduler.Schedule(*child, join, none, TaskPriority::Inherited);
+            this->m_Scheduler.Wait(join);
+        }
+    };
+}
+
+TEST_CASE("Tasks / DefaultTaskScheduler - Fork Join")
+{
+    using namespace Anemone;
+
+    constexpr uint32_t depth = 10;
+    constexpr size_t expected = (size_t{1} << (depth + 1)) - 1;
+
+    for (size_t workers : {0uz, 1uz, 3uz})
+    {
+        DefaultTaskScheduler scheduler{workers};
+
+        std::atomic_size_t executed{};
+
+        TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+        TaskAwaiterHandle const fork = MakeReference<TaskAwaiter>();
+
+        TaskHandle const root = MakeReference<ForkJoinTask>(scheduler, executed, depth);
+        scheduler.Schedule(*root, join, fork, TaskPriority::Normal);
+        scheduler.Wait(join);
+
+        REQUIRE(executed.load() == expected);
+    }
+}
+
+TEST_CASE("Tasks / DefaultTaskScheduler - Dependencies")
+{
+    using namespace Anemone;
+
+    // Without workers, tasks are executed only while waiting; this keeps dependent tasks pending until gate task completes.
+    DefaultTaskScheduler scheduler{0};
+
+    std::atomic_size_t executed{};
+
+    TaskAwaiterHandle const none = MakeReference<TaskAwaiter>();
+    TaskAwaiterHandle const gate = MakeReference<TaskAwaiter>();
+    TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+
+    TaskHandle const producer = MakeReference<ForkJoinTask>(scheduler, executed, 0);
+    scheduler.Schedule(*producer, gate, none, TaskPriority::Normal);
+
+    for (size_t i = 0; i < 64; ++i)
+    {
+        TaskHandle const consumer = MakeReference<ForkJoinTask>(scheduler, executed, 0);
+        scheduler.Schedule(*consumer, join, gate, TaskPriority::Normal);
+        REQUIRE(consumer->GetStatus() == TaskStatus::Pending);
+    }
+
+    REQUIRE(executed.load() == 0);
+
+    scheduler.Wait(join);
+
+    REQUIRE(executed.load() == 65);
+    REQUIRE(gate->IsCompleted());
+}
+
+TEST_CASE("Tasks / DefaultTaskScheduler - Priorities")
+{
+    using namespace Anemone;
+
+    // Without workers, tasks are executed only by waiting thread, in order picked by scheduler.
+    DefaultTaskScheduler scheduler{0};
+
+    std::vector<TaskPriority> order{};
+
+    TaskAwaiterHandle const none = MakeReference<TaskAwaiter>();
+    TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+
+    auto schedule = [&](TaskPriority priority, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            TaskHandle const task = MakeReference<RecordPriorityTask>(order);
+            scheduler.Schedule(*task, join, none, priority);
+        }
+    };
+
+    schedule(TaskPriority::Background, 4);
+    schedule(TaskPriority::Low, 4);
+    schedule(TaskPriority::Normal, 4);
+    schedule(TaskPriority::High, 4);
+    schedule(TaskPriority::Critical, 4);
+
+    scheduler.Wait(join);
+
+    REQUIRE(order.size() == 20);
+
+    // Tasks are executed well within aging thresholds, so strict priority order is expected.
+    REQUIRE(std::is_sorted(order.begin(), order.end()));
+    REQUIRE(order.front() == TaskPriority::Critical);
+
+    REQUIRE(scheduler.GetLatencyHistogram(TaskPriority::Critical).GetCount() == 4);
+    REQUIRE(scheduler.GetLatencyHistogram(TaskPriority::Background).GetCount() == 4);
+
+    scheduler.ResetLatencyHistograms();
+
+    REQUIRE(scheduler.GetLatencyHistogram(TaskPriority::Critical).GetCount() == 0);
+}
+
+TEST_CASE("Tasks / DefaultTaskScheduler - Inherited Priority")
+{
+    using namespace Anemone;
+
+    DefaultTaskScheduler scheduler{0};
+
+    std::vector<TaskPriority> order{};
+
+    TaskAwaiterHandle const none = MakeReference<TaskAwaiter>();
+    TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+
+    TaskHandle const parent = MakeReference<InheritPriorityTask>(scheduler, order);
+    scheduler.Schedule(*parent, join, none, TaskPriority::High);
+
+    // Outside of task, inherited priority resolves to Normal.
+    TaskHandle const orphan = MakeReference<RecordPriorityTask>(order);
+    scheduler.Schedule(*orphan, join, none, TaskPriority::Inherited);
+    REQUIRE(orphan->GetPriority() == TaskPriority::Normal);
+
+    scheduler.Wait(join);
+
+    REQUIRE(order.size() == 2);
+    REQUIRE(order[0] == TaskPriority::High);
+    REQUIRE(order[1] == TaskPriority::Normal);
+}
+
+TEST_CASE("Tasks / DefaultTaskScheduler - Affinity Hint")
+{
+    using namespace Anemone;
+
+    uint32_t const nodes = static_cast<uint32_t>(ProcessorProperties::GetNumaNodesCount());
+
+    // Hints of existing nodes, out of range node and no preference.
+    std::array<uint32_t, 4> const hints{0, nodes - 1, nodes, Task::AnyNumaNode};
+
+    for (TaskWorkerPlacement placement : {TaskWorkerPlacement::Unpinned, TaskWorkerPlacement::Topology})
+    {
+        DefaultTaskScheduler scheduler{2, placement};
+
+        std::atomic_size_t counter{};
+
+        TaskAwaiterHandle const none = MakeReference<TaskAwaiter>();
+        TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+
+        for (size_t i = 0; i < 256; ++i)
+        {
+            TaskHandle const task = MakeReference<CountTask>(counter);
+            task->SetAffinityHint(hints[i % hints.size()]);
+            scheduler.Schedule(*task, join, none, TaskPriority::Normal);
+        }
+
+        scheduler.Wait(join);
+
+        REQUIRE(counter.load() == 256);
+    }
+}
+
+TEST_CASE("Tasks / DefaultTaskScheduler - Oversubscribed Placement")
+{
+    using namespace Anemone;
+
+    size_t const processors = ProcessorProperties::GetLogicalProcessors().size();
+
+    // More workers than logical processors; one processor is left for thread creating scheduler.
+    size_t const workers = processors + 2;
+
+    DefaultTaskScheduler scheduler{workers, TaskWorkerPlacement::Topology};
+
+    std::vector<uint32_t> pinned{};
+
+    for (uint32_t i = 0; i < workers; ++i)
+    {
+        if (std::optional<LogicalProcessorInfo> const processor = scheduler.GetWorkerProcessor(i))
+        {
+            pinned.push_back(processor->Index);
+        }
+    }
+
+    REQUIRE(pinned.size() == (processors - 1));
+
+    // Every processor runs at most one pinned worker.
+    std::ranges::sort(pinned);
+    REQUIRE(std::ranges::adjacent_find(pinned) == pinned.end());
+
+    std::atomic_size_t counter{};
+
+    TaskAwaiterHandle const none = MakeReference<TaskAwaiter>();
+    TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+
+    for (size_t i = 0; i < 256; ++i)
+    {
+        TaskHandle const task = MakeReference<CountTask>(counter);
+        task->SetAffinityHint(static_cast<uint32_t>(i % 2));
+        scheduler.Schedule(*task, join, none, TaskPriority::Normal);
+    }
+
+    scheduler.Wait(join);
+
+    REQUIRE(counter.load() == 256);
+}
+
+TEST_CASE("Tasks / DefaultTaskScheduler - Statistics")
+{
+    using namespace Anemone;
+
+    DefaultTaskScheduler scheduler{2};
+
+    std::atomic_size_t counter{};
+
+    // Chain of stages; every stage waits for previous one, first stage waits for gate.
+    constexpr size_t stages = 8;
+    constexpr size_t tasks = 64;
+
+    std::atomic_bool released{};
+
+    TaskAwaiterHandle dependency = MakeReference<TaskAwaiter>();
+
+    {
+        TaskAwaiterHandle const gate = MakeReference<TaskAwaiter>();
+        TaskHandle const task = MakeReference<GateTask>(released);
+        scheduler.Schedule(*task, gate, dependency, TaskPriority::Normal);
+        dependency = gate;
+    }
+
+    for (size_t stage = 0; stage < stages; ++stage)
+    {
+        TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+
+        for (size_t i = 0; i < tasks; ++i)
+        {
+            TaskHandle const task = MakeReference<CountTask>(counter);
+            scheduler.Schedule(*task, join, dependency, TaskPriority::Normal);
+        }
+
+        dependency = join;
+    }
+
+    released.store(true);
+    scheduler.Wait(dependency);
+
+    REQUIRE(counter.load() == stages * tasks);
+
+    {
+        DefaultTaskSchedulerStatistics const statistics = scheduler.GetStatistics();
+
+        REQUIRE(statistics.Workers.size() == 2);
+
+        uint64_t executed = statistics.External.TasksExecuted;
+
+        for (TaskWorkerStatistics const& worker : statistics.Workers)
+        {
+            executed += worker.TasksExecuted;
+        }
+
+        REQUIRE(executed == (stages * tasks) + 1);
+        REQUIRE(statistics.TasksInFlight == 0);
+
+        // All stages waited for their dependency.
+        REQUIRE(statistics.DependencyResolutions == stages * tasks);
+    }
+
+    // Must not fail with scheduler in any state.
+    scheduler.ReportStatistics();
+
+    scheduler.ResetStatistics();
+
+    {
+        DefaultTaskSchedulerStatistics const statistics = scheduler.GetStatistics();
+
+        REQUIRE(statistics.External.TasksExecuted == 0);
+        REQUIRE(statistics.DependencyResolutions == 0);
+
+        for (uint64_t highWater : statistics.QueueHighWater)
+        {
+            REQUIRE(highWater == 0);
+        }
+    }
+}
+
+TEST_CASE("Tasks / DefaultTaskScheduler - Statistics Interval")
+{
+    using namespace Anemone;
+
+    IConsoleVariable* const variable = ConsoleVariableRegistry::Get().FindByName("Tasks.StatisticsInterval");
+    REQUIRE(variable != nullptr);
+    REQUIRE(variable->ToString() == "0");
+    REQUIRE_FALSE(variable->FromString("1ms"));
+
+    DefaultTaskScheduler scheduler{2};
+
+    std::atomic_size_t counter{};
+
+    TaskAwaiterHandle const none = MakeReference<TaskAwaiter>();
+    TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+
+    for (size_t i = 0; i < 256; ++i)
+    {
+        TaskHandle const task = MakeReference<CountTask>(counter);
+        scheduler.Schedule(*task, join, none, TaskPriority::Normal);
+
+        // Workers read interval while it changes.
+        if ((i % 64) == 0)
+        {
+            REQUIRE(variable->FromString(((i / 64) % 2) == 0 ? "1" : "0"));
+        }
+    }
+
+    scheduler.Wait(join);
+
+    REQUIRE(variable->FromString("0"));
+    REQUIRE(variable->ToString() == "0");
+    REQUIRE(counter.load() == 256);
+}
+
+TEST_CASE("Tasks / DefaultTaskScheduler - Wait List Race")
+{
+    using namespace Anemone;
+
+    // Dependent tasks are added while dependency is being completed by worker; none of them may be lost.
+    DefaultTaskScheduler scheduler{3};
+
+    constexpr size_t rounds = 256;
+    constexpr size_t consumers = 16;
+
+    std::atomic_size_t counter{};
+
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        TaskAwaiterHandle const none = MakeReference<TaskAwaiter>();
+        TaskAwaiterHandle const gate = MakeReference<TaskAwaiter>();
+        TaskAwaiterHandle const join = MakeReference<TaskAwaiter>();
+
+        TaskHandle const producer = MakeReference<CountTask>(counter);
+        scheduler.Schedule(*producer, gate, none, TaskPriority::Normal);
+
+        for (size_t i = 0; i < consumers; ++i)
+        {
+            TaskHandle const consumer = MakeReference<CountTask>(counter);
+            scheduler.Schedule(*consumer, join, gate, TaskPriority::Normal);
+        }
+
+        scheduler.Wait(join);
+    }
+
+    REQUIRE(counter.load() == rounds * (consumers + 1));
+}
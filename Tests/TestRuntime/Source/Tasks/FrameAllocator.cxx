@@ -0,0 +1,98 @@
+#include "AnemoneRuntime.Tasks/FrameAllocator.hxx"
+#include "AnemoneRuntime.Tasks/DefaultTaskScheduler.hxx"
+#include "AnemoneRuntime.Tasks/TaskGraph.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <array>
+#include <atomic>
+
+namespace
+{
+    struct FramePayload final
+    {
+        uint64_t Frame;
+        size_t Node;
+    };
+}
+
+TEST_CASE("Tasks / FrameAllocator - Frames")
+{
+    using namespace Anemone;
+
+    for (size_t buffers : {2uz, 3uz})
+    {
+        DefaultTaskScheduler scheduler{3};
+        FrameAllocator allocator{scheduler, buffers};
+        FrameAllocator::SetCurrent(&allocator);
+
+        constexpr size_t Nodes = 64;
+
+        // Every node allocates payload from arena of thread executing it.
+        std::array<FramePointer<FramePayload>, Nodes> payloads{};
+        std::atomic_size_t mismatches{};
+
+        TaskGraph graph{};
+
+        for (size_t i = 0; i < Nodes; ++i)
+        {
+            graph.AddNode("payload", [&, i]
+            {
+                FramePointer<FramePayload> const payload = FrameAlloc<FramePayload>(allocator.GetFrame(), i);
+
+                if ((payload->Node != i) or (payload->Frame != allocator.GetFrame()))
+                {
+                    mismatches.fetch_add(1);
+                }
+
+                payloads[i] = payload;
+            });
+        }
+
+        graph.Compile();
+
+        uint64_t firstFrame = 0;
+
+        for (size_t frame = 0; frame < 8; ++frame)
+        {
+            allocator.BeginFrame();
+
+            TaskAwaiterHandle const fence = graph.Start(scheduler);
+            allocator.EndFrame(fence);
+
+            scheduler.Wait(fence);
+
+            for (size_t i = 0; i < Nodes; ++i)
+            {
+                REQUIRE(payloads[i]->Node == i);
+                REQUIRE(payloads[i]->Frame == allocator.GetFrame());
+                allocator.ValidatePointer(payloads[i].Get());
+            }
+
+            if (frame == 0)
+            {
+                firstFrame = allocator.GetFrame();
+            }
+        }
+
+        REQUIRE(mismatches.load() == 0);
+
+        // Allocations of first frame were reclaimed long ago.
+        REQUIRE_FALSE(allocator.IsFrameAlive(firstFrame));
+        REQUIRE(allocator.IsFrameAlive(allocator.GetFrame()));
+        REQUIRE(allocator.IsFrameAlive(allocator.GetFrame() + 1 - buffers));
+        REQUIRE_FALSE(allocator.IsFrameAlive(allocator.GetFrame() - buffers));
+
+        size_t reserved = 0;
+        size_t allocated = 0;
+        allocator.QueryMemoryUsage(reserved, allocated);
+        REQUIRE(allocated >= Nodes * sizeof(FramePayload));
+        REQUIRE(reserved >= allocated);
+
+        FrameAllocator::SetCurrent(nullptr);
+    }
+}
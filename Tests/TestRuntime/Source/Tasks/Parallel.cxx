@@ -0,0 +1,120 @@
+#include "AnemoneRuntime.Tasks/Parallel.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+TEST_CASE("Tasks / Parallel - For Covers Range")
+{
+    using namespace Anemone;
+
+    for (size_t count : {1uz, 7uz, 1000uz, 100'000uz})
+    {
+        std::vector<std::atomic_uint32_t> visited(count);
+        std::atomic_size_t finalized{};
+
+        Parallel::For(count, 1, [&](size_t index, size_t n)
+        {
+            for (size_t i = index; i < (index + n); ++i)
+            {
+                visited[i].fetch_add(1, std::memory_order::relaxed);
+            }
+        }, [&](size_t n)
+        {
+            finalized = n;
+        });
+
+        REQUIRE(finalized == count);
+
+        for (std::atomic_uint32_t const& item : visited)
+        {
+            REQUIRE(item.load() == 1);
+        }
+    }
+}
+
+TEST_CASE("Tasks / Parallel - Nested For")
+{
+    using namespace Anemone;
+
+    constexpr size_t outer = 64;
+    constexpr size_t inner = 1000;
+
+    std::atomic_size_t total{};
+
+    Parallel::For(outer, 1, [&](size_t, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            // Inner loop runs on worker thread; it must help instead of blocking.
+            Parallel::For(inner, 16, [&](size_t, size_t m)
+            {
+                total.fetch_add(m, std::memory_order::relaxed);
+            });
+        }
+    });
+
+    REQUIRE(total.load() == outer * inner);
+}
+
+TEST_CASE("Tasks / Parallel - Reduce")
+{
+    using namespace Anemone;
+
+    constexpr size_t count = 1'000'000;
+
+    uint64_t const result = Parallel::Reduce(
+        count,
+        64,
+        uint64_t{},
+        [](size_t index, size_t n)
+    {
+        uint64_t partial = 0;
+
+        for (size_t i = index; i < (index + n); ++i)
+        {
+            partial += i;
+        }
+
+        return partial;
+    },
+        [](uint64_t left, uint64_t right)
+    {
+        return left + right;
+    });
+
+    REQUIRE(result == (uint64_t{count} * (count - 1)) / 2);
+}
+
+TEST_CASE("Tasks / Parallel - Scan")
+{
+    using namespace Anemone;
+
+    for (size_t count : {0uz, 1uz, 3uz, 1000uz, 123'457uz})
+    {
+        std::vector<uint64_t> input(count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            input[i] = (i * 7919u) % 101u;
+        }
+
+        std::vector<uint64_t> expected(count);
+        std::inclusive_scan(input.begin(), input.end(), expected.begin());
+
+        std::vector<uint64_t> output(count);
+
+        Parallel::Scan<uint64_t>(input, output, 0, [](uint64_t left, uint64_t right)
+        {
+            return left + right;
+        });
+
+        REQUIRE(output == expected);
+    }
+}
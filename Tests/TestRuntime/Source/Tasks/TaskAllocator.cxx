@@ -0,0 +1,135 @@
+#include "AnemoneRuntime.Tasks/TaskAllocator.hxx"
+#include "AnemoneRuntime.Tasks/Task.hxx"
+#include "AnemoneRuntime.Tasks/TaskAwaiter.hxx"
+#include "AnemoneRuntime.Threading/Thread.hxx"
+#include "AnemoneRuntime.Base/FunctionRef.hxx"
+#include "AnemoneRuntime.Base/Bitwise.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <cstring>
+#include <vector>
+
+TEST_CASE("Tasks / TaskAllocator - Size Classes")
+{
+    using namespace Anemone;
+
+    for (size_t size : {1uz, 24uz, 64uz, 65uz, 200uz, TaskAllocator::MaxPooledSize, TaskAllocator::MaxPooledSize + 1})
+    {
+        std::vector<void*> blocks{};
+
+        for (size_t i = 0; i < 300; ++i)
+        {
+            void* const block = TaskAllocator::Allocate(size);
+            REQUIRE(block != nullptr);
+            REQUIRE(IsAligned(block, TaskAllocator::Granularity));
+
+            // Make sure that whole block is writable and not shared with other blocks.
+            std::memset(block, static_cast<int>(i), size);
+            blocks.push_back(block);
+        }
+
+        for (size_t i = 0; i < blocks.size(); ++i)
+        {
+            REQUIRE(*static_cast<unsigned char*>(blocks[i]) == static_cast<unsigned char>(i));
+            TaskAllocator::Deallocate(blocks[i], size);
+        }
+    }
+}
+
+TEST_CASE("Tasks / TaskAllocator - Recycling")
+{
+    using namespace Anemone;
+
+    // Warm up thread cache for both size classes. When this test runs first on thread, first allocation of each
+    // size class carves new chunk from heap, so heap allocations are compared only after warm-up.
+    {
+        TaskAwaiterHandle const awaiter = MakeReference<TaskAwaiter>();
+        TaskHandle const task = MakeReference<Task>();
+    }
+
+    TaskAllocatorStatistics const before = TaskAllocator::GetStatistics();
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        TaskAwaiterHandle const awaiter = MakeReference<TaskAwaiter>();
+        TaskHandle const task = MakeReference<Task>();
+    }
+
+    TaskAllocatorStatistics const after = TaskAllocator::GetStatistics();
+
+    REQUIRE(after.Allocations - before.Allocations == 2000);
+    REQUIRE(after.Deallocations - before.Deallocations == 2000);
+
+    // Objects were recycled from thread cache.
+    REQUIRE(after.HeapAllocations == before.HeapAllocations);
+}
+
+TEST_CASE("Tasks / TaskAllocator - Cross Thread Deallocation")
+{
+    using namespace Anemone;
+
+    constexpr size_t count = 10000;
+
+    std::vector<void*> blocks{};
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        blocks.push_back(TaskAllocator::Allocate(128));
+    }
+
+    class Releaser final : public Runnable
+    {
+    private:
+        FunctionRef<void()> m_Callback;
+
+    public:
+        explicit Releaser(FunctionRef<void()> callback)
+            : m_Callback{callback}
+        {
+        }
+
+    protected:
+        void OnRun() override
+        {
+            this->m_Callback();
+        }
+    };
+
+    auto release = [&]
+    {
+        // Blocks freed here end up in shared pool when this thread exits.
+        for (void* block : blocks)
+        {
+            TaskAllocator::Deallocate(block, 128);
+        }
+    };
+
+    Reference<Thread> const thread = Thread::Start(ThreadStart{
+        .Name = "Releaser",
+        .Callback = MakeReference<Releaser>(release),
+    });
+
+    thread->Join();
+
+    TaskAllocatorStatistics const before = TaskAllocator::GetStatistics();
+
+    // Reallocate same amount of blocks; they must come from shared pool, not from heap.
+    for (size_t i = 0; i < count; ++i)
+    {
+        blocks[i] = TaskAllocator::Allocate(128);
+    }
+
+    TaskAllocatorStatistics const after = TaskAllocator::GetStatistics();
+
+    REQUIRE(after.HeapAllocations == before.HeapAllocations);
+
+    for (void* block : blocks)
+    {
+        TaskAllocator::Deallocate(block, 128);
+    }
+}
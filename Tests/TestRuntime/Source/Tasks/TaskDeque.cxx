@@ -0,0 +1,156 @@
+#include "AnemoneRuntime.Tasks/TaskDeque.hxx"
+#include "AnemoneRuntime.Tasks/Task.hxx"
+#include "AnemoneRuntime.Threading/Thread.hxx"
+#include "AnemoneRuntime.Base/FunctionRef.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <vector>
+
+TEST_CASE("Tasks / TaskDeque - Single Thread")
+{
+    using namespace Anemone;
+
+    // Deque only stores pointers; tasks are never executed here.
+    std::vector<Task> tasks(8);
+
+    TaskDeque deque{4};
+
+    REQUIRE(deque.GetCapacity() == 4);
+    REQUIRE(deque.IsEmpty());
+    REQUIRE(deque.Pop() == nullptr);
+    REQUIRE(deque.Steal() == nullptr);
+
+    REQUIRE(deque.Push(&tasks[0]));
+    REQUIRE(deque.Push(&tasks[1]));
+    REQUIRE(deque.Push(&tasks[2]));
+    REQUIRE(deque.Push(&tasks[3]));
+    REQUIRE_FALSE(deque.Push(&tasks[4]));
+    REQUIRE(deque.GetCount() == 4);
+
+    // Owner pops in LIFO order.
+    REQUIRE(deque.Pop() == &tasks[3]);
+
+    // Thieves steal in FIFO order.
+    REQUIRE(deque.Steal() == &tasks[0]);
+    REQUIRE(deque.Steal() == &tasks[1]);
+
+    REQUIRE(deque.Pop() == &tasks[2]);
+    REQUIRE(deque.IsEmpty());
+
+    // Indices wrap around capacity.
+    for (size_t i = 0; i < 16; ++i)
+    {
+        REQUIRE(deque.Push(&tasks[i % tasks.size()]));
+        REQUIRE(deque.Steal() == &tasks[i % tasks.size()]);
+    }
+
+    REQUIRE(deque.IsEmpty());
+}
+
+TEST_CASE("Tasks / TaskDeque - Concurrent Steal")
+{
+    using namespace Anemone;
+
+    constexpr size_t itemCount = 100000;
+    constexpr size_t thiefCount = 4;
+
+    // Use addresses inside array as unique items.
+    std::vector<Task> tasks(256);
+    Task* const base = tasks.data();
+
+    TaskDeque deque{256};
+
+    std::atomic_size_t consumed{};
+    std::atomic_size_t checksum{};
+    std::atomic_bool finished{};
+
+    auto consume = [&](Task* task)
+    {
+        checksum.fetch_add(static_cast<size_t>(task - base), std::memory_order::relaxed);
+        consumed.fetch_add(1, std::memory_order::relaxed);
+    };
+
+    class Thief final : public Runnable
+    {
+    private:
+        FunctionRef<void()> m_Callback;
+
+    public:
+        explicit Thief(FunctionRef<void()> callback)
+            : m_Callback{callback}
+        {
+        }
+
+    protected:
+        void OnRun() override
+        {
+            this->m_Callback();
+        }
+    };
+
+    auto steal = [&]
+    {
+        while (not finished.load(std::memory_order::acquire) or not deque.IsEmpty())
+        {
+            if (Task* task = deque.Steal())
+            {
+                consume(task);
+            }
+        }
+    };
+
+    std::vector<Reference<Thread>> thieves{};
+
+    for (size_t i = 0; i < thiefCount; ++i)
+    {
+        thieves.push_back(Thread::Start(ThreadStart{
+            .Name = "Thief",
+            .Callback = MakeReference<Thief>(steal),
+        }));
+    }
+
+    size_t expected = 0;
+
+    for (size_t i = 0; i < itemCount; ++i)
+    {
+        size_t const index = i % tasks.size();
+        expected += index;
+
+        while (not deque.Push(base + index))
+        {
+            // Deque is full; help draining it.
+            if (Task* task = deque.Pop())
+            {
+                consume(task);
+            }
+        }
+
+        if ((i % 3) == 0)
+        {
+            if (Task* task = deque.Pop())
+            {
+                consume(task);
+            }
+        }
+    }
+
+    while (Task* task = deque.Pop())
+    {
+        consume(task);
+    }
+
+    finished.store(true, std::memory_order::release);
+
+    for (Reference<Thread>& thief : thieves)
+    {
+        thief->Join();
+    }
+
+    REQUIRE(consumed.load() == itemCount);
+    REQUIRE(checksum.load() == expected);
+}
@@ -0,0 +1,211 @@
+#include "AnemoneRuntime.Tasks/TaskGraph.hxx"
+#include "AnemoneRuntime.Tasks/DefaultTaskScheduler.hxx"
+#include "AnemoneRuntime.Threading/CurrentThread.hxx"
+
+ANEMONE_EXTERNAL_HEADERS_BEGIN
+
+#include <catch_amalgamated.hpp>
+
+ANEMONE_EXTERNAL_HEADERS_END
+
+#include <array>
+#include <atomic>
+
+TEST_CASE("Tasks / TaskGraph - Dependencies")
+{
+    using namespace Anemone;
+
+    for (size_t workers : {0uz, 3uz})
+    {
+        DefaultTaskScheduler scheduler{workers};
+
+        // Diamond: a -> (b, c) -> d. Every node records its position in execution order.
+        std::atomic_uint32_t sequence{};
+        std::array<std::atomic_uint32_t, 4> order{};
+
+        TaskGraph graph{};
+
+        auto record = [&](size_t index)
+        {
+            return [&, index]
+            {
+                order[index].store(sequence.fetch_add(1) + 1);
+            };
+        };
+
+        TaskGraphNode const a = graph.AddNode("a", record(0));
+        TaskGraphNode const b = graph.AddNode("b", record(1));
+        TaskGraphNode const c = graph.AddNode("c", record(2));
+        TaskGraphNode const d = graph.AddNode("d", record(3));
+
+        graph.AddEdge(a, b);
+        graph.AddEdge(a, c);
+        graph.AddEdge(b, d);
+        graph.AddEdge(c, d);
+
+        graph.Compile();
+
+        REQUIRE(graph.GetTopologicalOrder().front() == a.Index);
+        REQUIRE(graph.GetTopologicalOrder().back() == d.Index);
+
+        // Compiled graph is reused across runs.
+        for (size_t run = 0; run < 16; ++run)
+        {
+            sequence.store(0);
+
+            graph.Run(scheduler);
+
+            REQUIRE(sequence.load() == 4);
+            REQUIRE(order[0].load() == 1);
+            REQUIRE(order[1].load() > order[0].load());
+            REQUIRE(order[2].load() > order[0].load());
+            REQUIRE(order[3].load() == 4);
+        }
+    }
+}
+
+TEST_CASE("Tasks / TaskGraph - Wide")
+{
+    using namespace Anemone;
+
+    DefaultTaskScheduler scheduler{3};
+
+    constexpr size_t width = 256;
+
+    std::atomic_size_t executed{};
+    std::atomic_size_t observed{};
+
+    TaskGraph graph{};
+
+    TaskGraphNode const source = graph.AddNode("source", [] { });
+    TaskGraphNode const sink = graph.AddNode("sink", [&]
+    {
+        observed.store(executed.load());
+    });
+
+    for (size_t i = 0; i < width; ++i)
+    {
+        TaskGraphNode const node = graph.AddNode("middle", [&]
+        {
+            executed.fetch_add(1);
+        });
+
+        graph.AddEdge(source, node);
+        graph.AddEdge(node, sink);
+    }
+
+    graph.Compile();
+
+    for (size_t run = 0; run < 8; ++run)
+    {
+        executed.store(0);
+
+        TaskAwaiterHandle const completion = graph.Start(scheduler);
+        scheduler.Wait(completion);
+
+        REQUIRE(executed.load() == width);
+
+        // All middle nodes were completed before sink started.
+        REQUIRE(observed.load() == width);
+    }
+}
+
+TEST_CASE("Tasks / TaskGraph - Dependent Task")
+{
+    using namespace Anemone;
+
+    class IncrementTask final : public Task
+    {
+    public:
+        std::atomic_size_t& Counter;
+
+        explicit IncrementTask(std::atomic_size_t& counter)
+            : Counter{counter}
+        {
+        }
+
+    protected:
+        void OnExecute() override
+        {
+            this->Counter.fetch_add(1);
+        }
+    };
+
+    DefaultTaskScheduler scheduler{3};
+
+    // Many trivial roots; workers finish them while Start is still dispatching the rest.
+    constexpr size_t width = 64;
+
+    std::atomic_size_t executed{};
+
+    TaskGraph graph{};
+
+    for (size_t i = 0; i < width; ++i)
+    {
+        graph.AddNode("root", [&]
+        {
+            executed.fetch_add(1);
+        });
+    }
+
+    graph.Compile();
+
+    for (size_t run = 0; run < 64; ++run)
+    {
+        executed.store(0);
+
+        std::atomic_size_t dependent{};
+
+        TaskAwaiterHandle const completion = graph.Start(scheduler);
+
+        // Task depending on graph is dispatched when graph completes, regardless of whether that happened already.
+        TaskAwaiterHandle const done = MakeReference<TaskAwaiter>();
+        TaskHandle const task = MakeReference<IncrementTask>(dependent);
+        scheduler.Schedule(*task, done, completion, TaskPriority::Normal);
+        scheduler.Wait(done);
+
+        REQUIRE(completion->IsCompleted());
+        REQUIRE(executed.load() == width);
+        REQUIRE(dependent.load() == 1);
+    }
+}
+
+TEST_CASE("Tasks / TaskGraph - Critical Path")
+{
+    using namespace Anemone;
+
+    DefaultTaskScheduler scheduler{0};
+
+    TaskGraph graph{};
+
+    // Two chains: slow one dominates critical path.
+    TaskGraphNode const fast = graph.AddNode("fast", [] { });
+    TaskGraphNode const slow1 = graph.AddNode("slow1", []
+    {
+        CurrentThread::Sleep(Duration::FromMilliseconds(5));
+    });
+    TaskGraphNode const slow2 = graph.AddNode("slow2", []
+    {
+        CurrentThread::Sleep(Duration::FromMilliseconds(5));
+    });
+    TaskGraphNode const join = graph.AddNode("join", [] { });
+
+    graph.AddEdge(slow1, slow2);
+    graph.AddEdge(slow2, join);
+    graph.AddEdge(fast, join);
+
+    graph.Compile();
+    graph.Run(scheduler);
+
+    TaskGraphCriticalPath const path = graph.GetCriticalPath();
+
+    REQUIRE(path.Nodes.size() == 3);
+    REQUIRE(path.Nodes[0].Index == slow1.Index);
+    REQUIRE(path.Nodes[1].Index == slow2.Index);
+    REQUIRE(path.Nodes[2].Index == join.Index);
+    REQUIRE(path.Length >= Duration::FromMilliseconds(10));
+    REQUIRE(path.Work >= path.Length);
+    REQUIRE(path.Elapsed >= path.Length);
+
+    graph.ReportCriticalPath();
+}
@@ -0,0 +1,124 @@
+#include "AnemoneRuntime.EntryPoint/EntryPoint.hxx"
+#include "AnemoneRuntime.Diagnostics/BinaryTraceFormat.hxx"
+#include "AnemoneRuntime.Storage/FileSystem.hxx"
+
+#include <cstdio>
+#include <iterator>
+#include <string_view>
+
+#include <fmt/format.h>
+
+// Converts binary trace logs written by BinaryTraceListener to text.
+//
+// Usage: AnemoneTraceDecoder [--timestamps] [--locations] <input file>
+
+namespace
+{
+    struct DecoderOptions final
+    {
+        std::string_view Input{};
+        bool Timestamps{};
+        bool Locations{};
+    };
+
+    bool ParseOptions(int argc, char** argv, DecoderOptions& options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string_view const argument{argv[i]};
+
+            if (argument == "--timestamps")
+            {
+                options.Timestamps = true;
+            }
+            else if (argument == "--locations")
+            {
+                options.Locations = true;
+            }
+            else if (argument.starts_with("--") or not options.Input.empty())
+            {
+                return false;
+            }
+            else
+            {
+                options.Input = argument;
+            }
+        }
+
+        return not options.Input.empty();
+    }
+}
+
+anemone_noinline int AnemoneMain(int argc, char** argv)
+{
+    using namespace Anemone;
+
+    DecoderOptions options{};
+
+    if (not ParseOptions(argc, argv, options))
+    {
+        fmt::println(stderr, "Usage: AnemoneTraceDecoder [--timestamps] [--locations] <input file>");
+        return 1;
+    }
+
+    auto const content = FileSystem::GetPlatformFileSystem().ReadBinaryFile(options.Input);
+
+    if (not content)
+    {
+        fmt::println(stderr, "Failed to read '{}': {}", options.Input, content.error());
+        return 1;
+    }
+
+    auto reader = BinaryTraceReader::Open((*content)->GetView());
+
+    if (not reader)
+    {
+        fmt::println(stderr, "'{}' is not a binary trace log: {}", options.Input, reader.error());
+        return 1;
+    }
+
+    fmt::memory_buffer line{};
+    BinaryTraceEvent event{};
+    size_t count = 0;
+
+    while (true)
+    {
+        auto const next = reader->Next(event);
+
+        if (not next)
+        {
+            fmt::println(stderr, "Log is corrupted after {} events: {}", count, next.error());
+            return 2;
+        }
+
+        if (not *next)
+        {
+            break;
+        }
+
+        line.clear();
+
+        if (options.Timestamps)
+        {
+            fmt::format_to(std::back_inserter(line), "[{:>14.6f}] ", static_cast<double>(event.Timestamp.ToNanoseconds()) / 1'000'000'000.0);
+        }
+
+        if (not BinaryTraceReader::Format(line, event))
+        {
+            fmt::println(stderr, "Event {} has malformed payload", count);
+            return 2;
+        }
+
+        if (options.Locations and (event.Site != nullptr))
+        {
+            fmt::format_to(std::back_inserter(line), " ({}:{})", event.Site->File, event.Site->Line);
+        }
+
+        line.push_back('\n');
+        std::fwrite(line.data(), 1, line.size(), stdout);
+
+        ++count;
+    }
+
+    return 0;
+}